@@ -0,0 +1,84 @@
+# Generates src/Core/SobolDirections.h/.cpp from the Joe & Kuo primitive polynomials
+# in bin/new-joe-kuo-6.21201, expanding only the dimensions the sampler uses.
+#
+# usage: python GenerateSobolDirections.py [dimensions] [bits]
+
+import os
+import sys
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..')
+
+dimensions = int(sys.argv[1]) if len(sys.argv) > 1 else 512
+bits = int(sys.argv[2]) if len(sys.argv) > 2 else 32
+
+header = '''/********************************************************/
+// FILE: %s
+// DESCRIPTION: Sobol direction numbers, generated by projects/scripts/GenerateSobolDirections.py
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)    
+/********************************************************/
+// This work is licensed under the Creative Commons 
+// Attribution-NonCommercial 3.0 Unported License. 
+// To view a copy of this license, visit 
+// http://creativecommons.org/licenses/by-nc/3.0/ or send 
+// a letter to Creative Commons, 444 Castro Street, 
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+'''
+
+def directions(s, a, m):
+	v = [0] * (bits + 1)
+	for i in range(1, min(s, bits) + 1):
+		v[i] = (m[i - 1] << (32 - i)) & 0xffffffff
+	for i in range(s + 1, bits + 1):
+		v[i] = v[i - s] ^ (v[i - s] >> s)
+		for k in range(1, s):
+			if (a >> (s - 1 - k)) & 1:
+				v[i] ^= v[i - k]
+	return v
+
+table = [[0] + [1 << (32 - i) for i in range(1, bits + 1)]]
+
+with open(os.path.join(root, 'bin', 'new-joe-kuo-6.21201')) as f:
+	next(f)
+	for line in f:
+		if len(table) >= dimensions:
+			break
+		values = [int(x) for x in line.split()]
+		d, s, a = values[0:3]
+		table.append(directions(s, a, values[3:3 + s]))
+
+assert len(table) == dimensions, 'not enough dimensions in the input'
+
+with open(os.path.join(root, 'src', 'Core', 'SobolDirections.h'), 'w') as f:
+	f.write(header % 'SobolDirections.h')
+	f.write('''
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_SOBOL_DIRECTIONS_GUARD
+#define RAYTRACE_SOBOL_DIRECTIONS_GUARD
+
+#include <RaytraceCommon.h>
+
+namespace Raytrace {
+
+static const size_t SobolDirectionDimensions = %d;
+static const size_t SobolDirectionBits = %d;
+
+// row d holds the direction numbers v_1 .. v_bits of dimension d at index 1 .. bits, index 0 is unused
+extern const u32 __data_sobolDirections[SobolDirectionDimensions][SobolDirectionBits+1];
+
+}
+
+#endif
+''' % (dimensions, bits))
+
+with open(os.path.join(root, 'src', 'Core', 'SobolDirections.cpp'), 'w') as f:
+	f.write(header % 'SobolDirections.cpp')
+	f.write('\n#include "SobolDirections.h"\n\nnamespace Raytrace {\n\n')
+	f.write('extern const u32 __data_sobolDirections[SobolDirectionDimensions][SobolDirectionBits+1] = {\n')
+	for i, row in enumerate(table):
+		f.write('\t{ ' + ','.join('0x%08x' % x for x in row) + ' }' + (',' if i + 1 < len(table) else '') + '\n')
+	f.write('};\n\n}\n')
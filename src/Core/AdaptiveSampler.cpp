@@ -0,0 +1,17 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "AdaptiveSampler.h"
+
+namespace Raytrace {
+
+template<class _SampleData,class _SceneReader> 
+typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateAdaptiveSampler()
+{
+	return boost::shared_ptr<ISampler<_SampleData,_SceneReader>>(new AdaptiveSampler<_SampleData,_SceneReader>());
+}
+
+template boost::shared_ptr<ISampler<DefaultEngine::SampleData,DefaultEngine::SceneReader>>	CreateAdaptiveSampler();
+
+}
\ No newline at end of file
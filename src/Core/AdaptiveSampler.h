@@ -0,0 +1,290 @@
+/********************************************************/
+// FILE: AdaptiveSampler.h
+// DESCRIPTION: Monte Carlo Sampler distributing samples by pixel variance
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_ADAPTIVE_SAMPLER_GUARD
+#define RAYTRACE_ADAPTIVE_SAMPLER_GUARD
+
+#include <RaytraceCommon.h>
+#include "SamplerBase.h"
+#include "CounterRandom.h"
+
+
+namespace Raytrace {
+
+// Samples every pixel a few times, then hands out further samples in rounds.
+// Each round a pixel earns credit proportional to its estimated error, pixels
+// below the threshold are masked as converged and never sampled again.
+// Sample indices keep the SamplerBase layout (multisample * pixels + pixel),
+// a round contains every pixel at most once.
+template<class _SampleData,class _SceneReader> struct AdaptiveSampler : public SamplerBase<_SampleData,_SceneReader>
+{
+	typedef _SampleData SampleData;
+	typedef _SceneReader SceneReader;
+
+	typedef SamplerBase<_SampleData,_SceneReader> Base;
+	typedef typename Base::FinalImageElement FinalImageElement;
+
+	// uniform samples per pixel before the error estimate is trusted
+	static const size_t MinSamplesPerPixel = 8;
+	// no pixel gets more than this multiple of the scene multisample count
+	static const size_t MaxSampleFactor = 4;
+
+	inline AdaptiveSampler() :
+		_convergenceThreshold(1.0f/256.0f),
+		_contrastWeight(0.5f)
+	{
+	}
+
+	inline ~AdaptiveSampler()
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const _SceneReader& scene,_SampleData& sampleData)
+	{
+		Base::InitializeSampler(numThreads,scene,sampleData,scene->getMultisampleCount());
+
+		Base::_sampleData->setSampleGenerator(this);
+
+		const size_t multisampleCount = std::max<size_t>(1,scene->getMultisampleCount());
+		_minSamples = std::min<size_t>(MinSamplesPerPixel,multisampleCount);
+		_maxSamples = multisampleCount*MaxSampleFactor;
+
+		const size_t size = Base::_finalImage.size();
+		_pixelSamples.assign(size,0);
+		_converged.assign(size,0);
+		_credit.assign(size,0.0f);
+		_luminance.assign(size,0.0f);
+		_priority.assign(size,0.0f);
+
+		_round.clear();
+		_roundOffset = 0;
+	}
+
+	virtual void GeneratePrepareST()
+	{
+		if(_roundOffset >= _round.size())
+			BuildRound();
+
+		up numDesiredSamples = (Base::_numDesiredSamples > Base::_numGeneratedSamples) ? Base::_numDesiredSamples - Base::_numGeneratedSamples : 0;
+		up numEffectiveSamples = std::min<up>(numDesiredSamples,Base::_maxGenerateSamples);
+		numEffectiveSamples = std::min<up>(numEffectiveSamples,_round.size() - _roundOffset);
+
+		Base::_nextGenerateSamples = (size_t)numEffectiveSamples;
+		Base::_nextGenerateBlock = 0;
+
+		for(auto it = Base::_threadStats.begin(); it != Base::_threadStats.end(); ++it)
+		{
+			it->_numGenerated = 0;
+			it->_numCompleted = 0;
+		}
+	}
+
+	virtual void GenerateMT(size_t threadId)
+	{
+		const size_t size = Base::_finalImage.size();
+
+		Base::ReadCompletedMT(threadId);
+
+		//write new, the next pixels of the current round
+
+		while(true)
+		{
+			const up block = InterlockedIncrement(Base::_nextGenerateBlock) - 1;
+
+			const size_t first = _roundOffset + (size_t)(block*_SampleData::NumSamplesPerBlock);
+			const size_t end = std::min<size_t>(_roundOffset + Base::_nextGenerateSamples,_roundOffset + (size_t)((block+1)*_SampleData::NumSamplesPerBlock));
+
+			if(first >= end)
+				break;
+
+			typename SampleData::SampleInput generated;
+
+			for(size_t i = first; i < end; ++i)
+			{
+				const u32 pixel = _round[i];
+				generated._index = (up)_pixelSamples[pixel]*(up)size + (up)pixel;
+				_pixelSamples[pixel]++;
+				Base::_sampleData->pushGeneratedSample(threadId,generated);
+			}
+			Base::_threadStats[threadId]._numGenerated += end - first;
+		}
+	}
+
+	virtual f32 GenerateCompleteST()
+	{
+		_roundOffset += Base::_nextGenerateSamples;
+
+		return Base::GenerateCompleteST();
+	}
+
+	virtual Result GatherPreview(IMAGE_FORMAT format,size_t xRes,size_t yRes,void* pDataOut) const
+	{
+		// samples land on scattered pixels, redraw the whole image whenever something completed
+		if(Base::_numDrawnSamples < Base::_numCompletedSamples)
+			Base::_numDrawnSamples = (Base::_numCompletedSamples > Base::_finalImage.size()) ? Base::_numCompletedSamples - Base::_finalImage.size() : 0;
+
+		return Base::GatherPreview(format,xRes,yRes,pDataOut);
+	}
+
+	typename SampleData::SampleValue2DType getSampleLocation2D(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
+	{
+		if(random_index == SampleData::SampleIndex2DImageXY)
+		{
+			size_t imageIndex = (size_t)(sample._index  % (up)Base::_finalImage.size());
+
+			Vector2i currentPixel((u32)(imageIndex % Base::_imageSize.x()), (u32)(imageIndex / Base::_imageSize.x()));
+			Vector2 current ( (float)(currentPixel.x()) * (float)Base::_pixelSize.x(), (float)(currentPixel.y()) * (float)Base::_pixelSize.y());
+
+			Vector2 jitter = _random.Uniform2D(sample._index,(u32)random_index);
+
+			return current + (jitter.array() * Base::_pixelSize.array()).matrix();
+		}
+		else
+		{
+			return _random.Uniform2D(sample._index,(u32)random_index);
+		}
+	}
+
+	typename SampleData::SampleValueType getSampleLocation(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
+	{
+		return _random.Uniform(sample._index,(u32)random_index);
+	}
+
+private:
+
+	// luminance after the same tone mapping Gather applies
+	static inline Real DisplayLuminance(const FinalImageElement& element)
+	{
+		if(!element._numSamples)
+			return 0.0f;
+		Vector4 mean = element.Mean();
+		Real l = std::max<Real>(0.0f,(mean.x() + mean.y() + mean.z()) / 3.0f);
+		return l / (l + 1.0f);
+	}
+
+	// standard error of the mean scaled by the slope of the tone mapping, plus local contrast
+	// that only fades with more samples so edges are not declared converged early
+	inline Real EstimateError(size_t pixel) const
+	{
+		const FinalImageElement& element = Base::_finalImage[pixel];
+		const size_t x = pixel % Base::_imageSize.x();
+		const size_t y = pixel / Base::_imageSize.x();
+		const Real n = (Real)element._numSamples;
+
+		Vector4 mean = element.Mean();
+		Real l = std::max<Real>(0.0f,(mean.x() + mean.y() + mean.z()) / 3.0f);
+		Real slope = 1.0f / ((1.0f + l)*(1.0f + l));
+		Real error = sqrt(std::max<Real>(0.0f,element.Variance()) / n) * slope;
+
+		Real contrast = 0.0f;
+		const Real center = _luminance[pixel];
+		if(x > 0)
+			contrast = std::max<Real>(contrast,fabs(center - _luminance[pixel - 1]));
+		if(x + 1 < Base::_imageSize.x())
+			contrast = std::max<Real>(contrast,fabs(center - _luminance[pixel + 1]));
+		if(y > 0)
+			contrast = std::max<Real>(contrast,fabs(center - _luminance[pixel - Base::_imageSize.x()]));
+		if(y + 1 < Base::_imageSize.y())
+			contrast = std::max<Real>(contrast,fabs(center - _luminance[pixel + Base::_imageSize.x()]));
+
+		return error + _contrastWeight * contrast / sqrt(n);
+	}
+
+	void BuildRound()
+	{
+		const size_t size = Base::_finalImage.size();
+
+		_round.clear();
+		_roundOffset = 0;
+
+		for(size_t i = 0; i < size; ++i)
+			_luminance[i] = DisplayLuminance(Base::_finalImage[i]);
+
+		Real maxPriority = 0.0f;
+
+		for(size_t i = 0; i < size; ++i)
+		{
+			_priority[i] = 0.0f;
+
+			if(_converged[i])
+				continue;
+
+			// uniform phase, continues until the results of those samples are in
+			if(_pixelSamples[i] < _minSamples || Base::_finalImage[i]._numSamples < std::max<size_t>(_minSamples,2))
+			{
+				_round.push_back((u32)i);
+				continue;
+			}
+
+			if(_pixelSamples[i] >= _maxSamples)
+			{
+				_converged[i] = 1;
+				continue;
+			}
+
+			Real priority = EstimateError(i);
+
+			if(!(priority >= _convergenceThreshold))
+			{
+				_converged[i] = 1;
+				continue;
+			}
+
+			_priority[i] = priority;
+			maxPriority = std::max<Real>(maxPriority,priority);
+		}
+
+		if(maxPriority <= 0.0f)
+			return;
+
+		// the noisiest pixel is sampled every round, the rest in proportion to their error
+		for(size_t i = 0; i < size; ++i)
+		{
+			if(_priority[i] <= 0.0f)
+				continue;
+
+			_credit[i] += _priority[i] / maxPriority;
+
+			if(_credit[i] >= 1.0f)
+			{
+				_credit[i] -= 1.0f;
+				_round.push_back((u32)i);
+			}
+		}
+	}
+
+	CounterRandom					_random;
+
+	Real							_convergenceThreshold;
+	Real							_contrastWeight;
+
+	size_t							_minSamples;
+	size_t							_maxSamples;
+
+	std::vector<u32>				_pixelSamples;
+	std::vector<u8>					_converged;
+	std::vector<Real>				_credit;
+	std::vector<Real>				_luminance;
+	std::vector<Real>				_priority;
+
+	std::vector<u32>				_round;
+	size_t							_roundOffset;
+};
+
+}
+#endif
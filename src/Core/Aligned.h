@@ -50,7 +50,8 @@ namespace Raytrace {
 	{
 	};
 
-	template <typename T> class AlignedAllocator {
+	// _Alignment can raise the alignment above the one of T, e.g. to keep arrays on separate cache lines
+	template <typename T,size_t _Alignment = 0> class AlignedAllocator {
 	public:
 
 		typedef T * pointer;
@@ -60,6 +61,8 @@ namespace Raytrace {
 		typedef T value_type;
 		typedef size_t size_type;
 		typedef ptrdiff_t difference_type;
+
+		static const size_t Alignment = (_Alignment > std::alignment_of<T>::value) ? _Alignment : std::alignment_of<T>::value;
  
 		T * address(T& r) const {
 			return &r;
@@ -76,7 +79,7 @@ namespace Raytrace {
  
 		// The following must be the same for all allocators.
 		template <typename U> struct rebind {
-			typedef AlignedAllocator<U> other;
+			typedef AlignedAllocator<U,_Alignment> other;
 		};
  
 		bool operator!=(const AlignedAllocator& other) const {
@@ -106,7 +109,7 @@ namespace Raytrace {
  
 		AlignedAllocator(const AlignedAllocator&) { }
  
-		template <typename U> AlignedAllocator(const AlignedAllocator<U>&) { }
+		template <typename U> AlignedAllocator(const AlignedAllocator<U,_Alignment>&) { }
  
 		~AlignedAllocator() { }
  
@@ -124,9 +127,9 @@ namespace Raytrace {
  
 			void* pv = nullptr;
 			#ifdef COMPILER_MSVC
-			pv = _aligned_malloc(n*sizeof(T), std::alignment_of<T>::value);
+			pv = _aligned_malloc(n*sizeof(T), Alignment);
 			#elif (defined COMPILER_GCC)
-			pv = _mm_malloc(n*sizeof(T), std::alignment_of<T>::value);
+			pv = _mm_malloc(n*sizeof(T), Alignment);
 			#endif
  
 			// Allocators should throw std::bad_alloc in the case of memory allocation failure.
@@ -0,0 +1,48 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "BVHIntersector.h"
+#include "AutotuneIntersector.h"
+
+namespace Raytrace {
+
+template<class _RayData,class _SceneReader>
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateAutotuneIntersector()
+{
+	typedef AutotuneIntersector<_RayData,_SceneReader> Autotune;
+	typedef typename Autotune::Candidate Candidate;
+	typedef typename Autotune::IntersectorConstructor Constructor;
+
+	// the intersector types the constructors below build
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1> Default;
+	typedef BVHIntersector<_RayData,_SceneReader,4,2,1> Children8;
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,2> Leaf8;
+	typedef BVHIntersector<_RayData,_SceneReader,4,2,2> Children8Leaf8;
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatFull,RayTriangleIntersectionMethodMoellerTrumbore> MoellerTrumbore;
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatFull,RayTriangleIntersectionMethodWatertight> Watertight;
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatFull,RayTriangleIntersectionMethodBaldwinWeber> BaldwinWeber;
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatFull,RayTriangleIntersectionMethodAnalytic> Analytic;
+
+	// node width, leaf size, splitting and triangle test are what differ most between scenes
+	std::vector<Candidate> candidates;
+	candidates.push_back( Candidate( String("BVH Intersector"), Constructor( &CreateBVHIntersector<_RayData,_SceneReader> ), &Autotune::template getAnalyticPrimitives<Default> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (8 Children)"), Constructor( &CreateConfiguredBVHIntersector<_RayData,_SceneReader,4,2,1> ), &Autotune::template getAnalyticPrimitives<Children8> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (8 per Leaf)"), Constructor( &CreateConfiguredBVHIntersector<_RayData,_SceneReader,4,1,2> ), &Autotune::template getAnalyticPrimitives<Leaf8> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (8 Children, 8 per Leaf)"), Constructor( &CreateConfiguredBVHIntersector<_RayData,_SceneReader,4,2,2> ), &Autotune::template getAnalyticPrimitives<Children8Leaf8> ) );
+#ifdef SIMD_AVX2
+	typedef BVHIntersector<_RayData,_SceneReader,8,1,1> Wide;
+	candidates.push_back( Candidate( String("BVH Intersector (8 wide)"), Constructor( &CreateWideBVHIntersector<_RayData,_SceneReader> ), &Autotune::template getAnalyticPrimitives<Wide> ) );
+#endif
+	candidates.push_back( Candidate( String("BVH Intersector (Early Split)"), Constructor( &CreateSplitBVHIntersector<_RayData,_SceneReader> ), &Autotune::template getAnalyticPrimitives<Default> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (Moeller-Trumbore)"), Constructor( &CreateTriangleMethodBVHIntersector<_RayData,_SceneReader,RayTriangleIntersectionMethodMoellerTrumbore> ), &Autotune::template getAnalyticPrimitives<MoellerTrumbore> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (Watertight)"), Constructor( &CreateTriangleMethodBVHIntersector<_RayData,_SceneReader,RayTriangleIntersectionMethodWatertight> ), &Autotune::template getAnalyticPrimitives<Watertight> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (Baldwin-Weber)"), Constructor( &CreateTriangleMethodBVHIntersector<_RayData,_SceneReader,RayTriangleIntersectionMethodBaldwinWeber> ), &Autotune::template getAnalyticPrimitives<BaldwinWeber> ) );
+	candidates.push_back( Candidate( String("BVH Intersector (Analytic Shapes)"), Constructor( &CreateTriangleMethodBVHIntersector<_RayData,_SceneReader,RayTriangleIntersectionMethodAnalytic> ), &Autotune::template getAnalyticPrimitives<Analytic> ) );
+
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new Autotune(candidates));
+}
+
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateAutotuneIntersector();
+
+}
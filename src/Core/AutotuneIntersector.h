@@ -0,0 +1,265 @@
+/********************************************************/
+// FILE: AutotuneIntersector.h
+// DESCRIPTION: Intersector picking the fastest of several candidates for the scene
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_AUTOTUNE_INTERSECTOR_GUARD
+#define RAYTRACE_AUTOTUNE_INTERSECTOR_GUARD
+
+#include <RaytraceCommon.h>
+#include <functional>
+#include <vector>
+#include <limits>
+#include <fstream>
+#include <boost/shared_ptr.hpp>
+#include "IIntersector.h"
+#include "BVHCache.h"
+#include "CacheFile.h"
+
+namespace Raytrace {
+
+// builds every candidate on a sample of the scene, times closest hit traversal on each
+// and then builds only the fastest one on the full scene, all other calls go to that one
+// the pick is kept in the cache directory so later renders of the scene skip the timing
+template<class _RayData,class _SceneReader> struct AutotuneIntersector : public IIntersector<_RayData,_SceneReader>
+{
+	typedef _RayData RayData;
+	typedef _SceneReader SceneReader;
+	typedef IIntersector<RayData,SceneReader> IIntersectorType;
+	typedef boost::shared_ptr<IIntersectorType> IntersectorType;
+	typedef std::function<IntersectorType()> IntersectorConstructor;
+	typedef bool (*CandidateQuery)();
+
+	// what a candidate supports is read from its type, only the picked one is ever constructed
+	struct Candidate
+	{
+		inline Candidate(const String& name,const IntersectorConstructor& construct,CandidateQuery analyticPrimitives) : _name(name),_construct(construct),_analyticPrimitives(analyticPrimitives)
+		{
+		}
+
+		String					_name;
+		IntersectorConstructor	_construct;
+		CandidateQuery			_analyticPrimitives;
+	};
+
+	template<class _Intersector> static bool getAnalyticPrimitives()
+	{
+		return _Intersector::AnalyticPrimitives;
+	}
+
+	// candidates are built on every n'th primitive so the sample holds about this many
+	static const size_t SamplePrimitiveCount = 1 << 16;
+
+	AutotuneIntersector(const std::vector<Candidate>& candidates) : _candidates(candidates),_selected(0)
+	{
+		RAY_ASSERT( !_candidates.empty() );
+	}
+
+	void InitializePrepareST(size_t numThreads,const SceneReader& scene,RayData& rayData)
+	{
+		const size_t stride = std::max<size_t>(scene->getNumPrimitives() / SamplePrimitiveCount,1);
+		const SceneReader sample(new typename SceneReader::element_type(*scene,stride));
+
+		const String cacheDirectory = scene->getCacheDirectory();
+		const String choicePath = cacheDirectory.empty() ? String() : CacheFile::getPath(cacheDirectory,getKey(*scene,*sample),".autotune");
+
+		// timings change from run to run, bit exact renders always use the first candidate
+		if(scene->isDeterministic())
+			_selected = getFirstUsable(scene->hasAnalyticPrimitives());
+		else if(!loadChoice(choicePath,scene->hasAnalyticPrimitives()))
+		{
+			_selected = measureCandidates(numThreads,sample,rayData);
+			saveChoice(choicePath);
+		}
+
+		_intersector = _candidates[_selected]._construct();
+		_intersector->InitializePrepareST(numThreads,scene,rayData);
+	}
+
+	void InitializeMT(size_t threadId)
+	{
+		_intersector->InitializeMT(threadId);
+	}
+
+	void InitializeCompleteST()
+	{
+		_intersector->InitializeCompleteST();
+	}
+
+	void IntersectPrepareST()
+	{
+		_intersector->IntersectPrepareST();
+	}
+
+	void IntersectMT(size_t threadId)
+	{
+		_intersector->IntersectMT(threadId);
+	}
+
+	void IntersectCompleteST()
+	{
+		_intersector->IntersectCompleteST();
+	}
+
+	bool SupportsAnalyticPrimitives() const
+	{
+		for(size_t i = 0; i < _candidates.size(); ++i)
+			if(_candidates[i]._analyticPrimitives())
+				return true;
+
+		return false;
+	}
+
+	Result GetStatistics(IntersectorStatistics& statisticsOut) const
+	{
+		if(!_intersector)
+			return Result::Failed;
+
+		return _intersector->GetStatistics(statisticsOut);
+	}
+
+	Result MeasureTraversal(const SceneReader& scene,f32& nanosecondsPerRayOut)
+	{
+		if(!_intersector)
+			return Result::Failed;
+
+		return _intersector->MeasureTraversal(scene,nanosecondsPerRayOut);
+	}
+
+private:
+
+	size_t measureCandidates(size_t numThreads,const SceneReader& sample,RayData& rayData)
+	{
+		f32 fastest = std::numeric_limits<f32>::infinity();
+		size_t selected = getFirstUsable(sample->hasAnalyticPrimitives());
+
+		for(size_t i = 0; i < _candidates.size(); ++i)
+		{
+			if(sample->hasAnalyticPrimitives() && !_candidates[i]._analyticPrimitives())
+				continue;
+
+			IntersectorType candidate = _candidates[i]._construct();
+
+			candidate->InitializePrepareST(numThreads,sample,rayData);
+			for(size_t t = 0; t < numThreads; ++t)
+				candidate->InitializeMT(t);
+			candidate->InitializeCompleteST();
+
+			f32 nanosecondsPerRay;
+			if(candidate->MeasureTraversal(sample,nanosecondsPerRay) == Result::Succeeded && nanosecondsPerRay < fastest)
+			{
+				fastest = nanosecondsPerRay;
+				selected = i;
+			}
+		}
+
+		return selected;
+	}
+
+	// the sampled geometry and the candidate list, a pick is only reused for the same choices on the same scene
+	u64 getKey(const typename SceneReader::element_type& scene,const typename SceneReader::element_type& sample) const
+	{
+		BVHCacheHasher hasher;
+
+		hasher.add((u32)scene.getNumPrimitives());
+
+		for(size_t i = 0; i < _candidates.size(); ++i)
+		{
+			hasher.add(_candidates[i]._name.data(),_candidates[i]._name.size());
+			hasher.add((u32)_candidates[i]._name.size());
+		}
+
+		for(size_t i = 0; i < sample.getNumPrimitives(); ++i)
+		{
+			typename SceneReader::element_type::PrimitiveType primitive;
+			int material;
+			sample.getPrimitive(i,primitive,material);
+
+			for(int p = 0; p < 3; ++p)
+				hasher.add(primitive.point(p).data(),sizeof(Real)*3);
+			hasher.add((u32)primitive.shape());
+		}
+
+		return hasher.value();
+	}
+
+	// candidates that would turn analytic shapes into triangles are never picked for a scene with them
+	size_t getFirstUsable(bool analytic) const
+	{
+		for(size_t i = 0; i < _candidates.size(); ++i)
+			if(!analytic || _candidates[i]._analyticPrimitives())
+				return i;
+
+		return 0;
+	}
+
+	// false if there is no stored pick or it names a candidate that no longer exists or cannot be used
+	bool loadChoice(const String& path,bool analytic)
+	{
+		if(path.empty())
+			return false;
+
+		std::ifstream stream(path.c_str());
+		String name;
+
+		if(!std::getline(stream,name))
+			return false;
+
+		for(size_t i = 0; i < _candidates.size(); ++i)
+		{
+			if(_candidates[i]._name == name && (!analytic || _candidates[i]._analyticPrimitives()))
+			{
+				_selected = i;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool saveChoice(const String& path) const
+	{
+		if(path.empty())
+			return false;
+
+		const String temporary = CacheFile::getTemporaryPath(path);
+
+		{
+			std::ofstream stream(temporary.c_str(),std::ios::out | std::ios::trunc);
+			if(!stream)
+				return false;
+
+			stream << _candidates[_selected]._name << std::endl;
+
+			stream.close();
+			if(stream.fail())
+			{
+				std::remove(temporary.c_str());
+				return false;
+			}
+		}
+
+		return CacheFile::replace(temporary,path);
+	}
+
+	std::vector<Candidate>	_candidates;
+	size_t					_selected;
+	IntersectorType			_intersector;
+};
+
+}
+
+#endif
@@ -11,6 +11,10 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include <list>
+#include <queue>
+#include <unordered_map>
+#include <type_traits>
 
 #ifdef min
 #undef min
@@ -23,6 +27,7 @@
 #include "Triangle.h"
 #include "AABB.h"
 #include "BVHConstructor.h"
+#include "BVHCache.h"
 #include "ArrayAdapter.h"
 
 #ifndef RAYTRACE_BVH_H_INCLUDED
@@ -30,6 +35,69 @@
 
 namespace Raytrace {
 	
+	// order in which the hierarchy is written to memory
+	enum BVHLayout
+	{
+		BVHLayoutBreadthFirst,
+		BVHLayoutDepthFirst,
+		BVHLayoutVanEmdeBoas,	// cache oblivious, recursive split at half the tree height
+		BVHLayoutTreelet,		// greedy by surface area into cache line aligned blocks
+	};
+
+	// fully associative LRU model of a data cache, used to compare layouts
+	struct BVHCacheSimulator
+	{
+		static const up LineSize = 64;
+
+		inline BVHCacheSimulator(size_t numLines) : _numLines(numLines),_accesses(0),_misses(0)
+		{
+		}
+
+		inline void touch(const void* address,size_t size)
+		{
+			const up first = (up)address / LineSize;
+			const up last = ((up)address + size - 1) / LineSize;
+
+			for(up line = first; line <= last; ++line)
+			{
+				++_accesses;
+
+				auto found = _lookup.find(line);
+				if(found != _lookup.end())
+				{
+					_lines.splice(_lines.begin(),_lines,found->second);
+					continue;
+				}
+
+				++_misses;
+				_lines.push_front(line);
+				_lookup[line] = _lines.begin();
+
+				if(_lines.size() > _numLines)
+				{
+					_lookup.erase(_lines.back());
+					_lines.pop_back();
+				}
+			}
+		}
+
+		inline size_t accesses() const
+		{
+			return _accesses;
+		}
+
+		inline size_t misses() const
+		{
+			return _misses;
+		}
+
+	private:
+		size_t													_numLines;
+		size_t													_accesses;
+		size_t													_misses;
+		std::list<up>											_lines;
+		std::unordered_map<up,std::list<up>::iterator>			_lookup;
+	};
 
 	template<class _Leaf,class _Volume,int _LeafSize = 2,int _NodeSize = 2,class _LeafContainer = std::array<_Leaf,_LeafSize>,class _VolumeContainer = std::array<_Volume,_NodeSize>> struct BVH
 	{
@@ -70,33 +138,46 @@ namespace Raytrace {
 		typedef std::array<OrderElement,NUM_ORDER_ELEMENTS> OrderHolder;*/
 
 
-		inline BVH(Constructor& init)
+		// treelets are filled up to a page but only start on a cache line, so one can straddle two pages
+		static const up TreeletSize = 4096;
+		static const up TreeletAlignment = BVHCacheSimulator::LineSize;
+		// every element starts on this, quantized nodes are not a multiple of the SIMD alignment of the leafs
+		static const up ElementAlignment = std::alignment_of<TreeElement>::value > std::alignment_of<LeafElement>::value ? std::alignment_of<TreeElement>::value : std::alignment_of<LeafElement>::value;
+
+		inline BVH(Constructor& init,BVHLayout layout = BVHLayoutBreadthFirst)
 		{
 			init.constructFinal();
 
-			size_t numLeafs = 0;
-			size_t numNodes = 1; // root node!
-
-			for(auto it = init._nodes.begin(); it != init._nodes.end(); ++it)
+			// the root is not part of _nodes, a scene fitting in one leaf has no other node
+			if(!init._sortedItems.empty())
 			{
-				if(it->_numChildNodes > 0)
-					numNodes ++;
-				else
-					numLeafs ++;
-			}
+				LayoutOrder order;
 
-			if(numLeafs != 0)
-			{
+				switch(layout)
+				{
+				case BVHLayoutDepthFirst:
+					orderDepthFirst(init._rootNode,init,order);
+					break;
+				case BVHLayoutVanEmdeBoas:
+					orderVanEmdeBoas(init._rootNode,init,getHeight(init._rootNode,init),order);
+					break;
+				case BVHLayoutTreelet:
+					orderTreelet(init._rootNode,init,order);
+					break;
+				default:
+					orderBreadthFirst(init._rootNode,init,order);
+					break;
+				}
 
 				_numUsed = 0;
-				_totalMem = numLeafs * sizeof(LeafElement) + numNodes * sizeof(TreeElement);
+				_totalMem = getLayoutSize(order);
 				#ifdef COMPILER_MSVC
 				_memory = _aligned_malloc( _totalMem, 64);
 				#else
-				assert(!"not implemented");
+				_memory = _mm_malloc( _totalMem, 64);
 				#endif
 
-				_root = encodeConstructorNodeBreadthFirst( init._rootNode, init );
+				_root = encodeConstructorNodes( order, init );
 			}
 			else
 			{
@@ -106,16 +187,75 @@ namespace Raytrace {
 				_root = encodeEmpty();
 			}
 
+			init.getStatistics(_statistics);
+			_statistics._memoryBytes = _totalMem;
+
 		}
 
 		inline ~BVH()
 		{
+			// memory of a loaded cache belongs to the file mapping
+			if(_cacheFile)
+				return;
+
 			#ifdef COMPILER_MSVC
 			_aligned_free(_memory);
 			#else
-			assert(!"not implemented");
+			_mm_free(_memory);
 			#endif
 		}
+
+		// maps a hierarchy written by saveCache back in, returns nullptr if the file is missing or was written with other settings
+		static inline BVH* loadCache(const String& path,u64 key)
+		{
+			boost::shared_ptr<BVHCacheFile> file = BVHCacheFile::open(path);
+
+			if(!file || !isCompatible(file->header(),key))
+				return nullptr;
+
+			return new BVH(file);
+		}
+
+		inline bool saveCache(const String& path,u64 key) const
+		{
+			BVHCacheHeader header;
+			fillHeader(header,key);
+			header._statisticsSize = sizeof(IntersectorStatistics);
+			header._dataOffset = BVHCacheFile::getDataOffset(header._statisticsSize);
+			header._dataSize = _numUsed;
+			header._root = makeRelative(_root);
+
+			// child links are stored relative to the start of the data block
+			std::vector<u8> data((const u8*)_memory,(const u8*)_memory + _numUsed);
+			std::deque<EncodedElement> nodes;
+
+			if(isValid(_root) && !isLeaf(_root))
+				nodes.push_back(_root);
+
+			while(!nodes.empty())
+			{
+				const EncodedElement current = nodes.front();
+				nodes.pop_front();
+
+				const TreeElement& node = getNode(current);
+				TreeElement& stored = *(TreeElement*)&data[current - (up)_memory];
+
+				for(size_t i = 0; i < NodeSize; ++i)
+				{
+					stored._children[i] = makeRelative(node._children[i]);
+
+					if(isValid(node._children[i]) && !isLeaf(node._children[i]))
+						nodes.push_back(node._children[i]);
+				}
+			}
+
+			return BVHCacheFile::write(path,header,&_statistics,data.empty() ? nullptr : &data[0]);
+		}
+
+		inline const IntersectorStatistics& statistics() const
+		{
+			return _statistics;
+		}
 		/*
 		struct traverseOrder
 		{
@@ -187,6 +327,16 @@ namespace Raytrace {
 				return nodeIterator(BVH::getNode(_encoded)._children[index]);
 			}
 
+			inline const void* address() const
+			{
+				return BVH::getData(_encoded);
+			}
+
+			inline size_t size() const
+			{
+				return isLeaf() ? sizeof(LeafElement) : sizeof(TreeElement);
+			}
+
 			inline void prefetch() const
 			{
 				_mm_prefetch( (char*)( &BVH::getNode(_encoded) ), _MM_HINT_T0 );
@@ -221,6 +371,82 @@ namespace Raytrace {
 		}
 
 	private:
+		
+		inline BVH(const boost::shared_ptr<BVHCacheFile>& file) : _cacheFile(file)
+		{
+			const BVHCacheHeader& header = file->header();
+
+			_memory = file->data();
+			_numUsed = (up)header._dataSize;
+			_totalMem = _numUsed;
+			_root = makeAbsolute((EncodedElement)header._root);
+			memcpy(&_statistics,file->statistics(),sizeof(IntersectorStatistics));
+
+			// relocate child links, the mapping is copy on write so this never touches the file
+			std::deque<EncodedElement> nodes;
+
+			if(isValid(_root) && !isLeaf(_root))
+				nodes.push_back(_root);
+
+			while(!nodes.empty())
+			{
+				TreeElement& node = *(TreeElement*)nodes.front();
+				nodes.pop_front();
+
+				for(size_t i = 0; i < NodeSize; ++i)
+				{
+					node._children[i] = makeAbsolute(node._children[i]);
+
+					if(isValid(node._children[i]) && !isLeaf(node._children[i]))
+						nodes.push_back(node._children[i]);
+				}
+			}
+		}
+
+		static inline void fillHeader(BVHCacheHeader& header,u64 key)
+		{
+			header._magic = BVHCacheHeader::Magic;
+			header._version = BVHCacheHeader::Version;
+			header._key = key;
+			header._pointerSize = sizeof(EncodedElement);
+			header._nodeSize = NodeSize;
+			header._leafSize = LeafSize;
+			header._treeElementSize = sizeof(TreeElement);
+			header._leafElementSize = sizeof(LeafElement);
+			header._statisticsSize = 0;
+			header._dataOffset = 0;
+			header._dataSize = 0;
+			header._root = 0;
+		}
+
+		static inline bool isCompatible(const BVHCacheHeader& header,u64 key)
+		{
+			BVHCacheHeader expected;
+			fillHeader(expected,key);
+
+			return	header._key == expected._key &&
+					header._pointerSize == expected._pointerSize &&
+					header._nodeSize == expected._nodeSize &&
+					header._leafSize == expected._leafSize &&
+					header._treeElementSize == expected._treeElementSize &&
+					header._leafElementSize == expected._leafElementSize &&
+					header._statisticsSize == sizeof(IntersectorStatistics);
+		}
+
+		inline EncodedElement makeRelative(EncodedElement element) const
+		{
+			if(!isValid(element))
+				return encodeEmpty();
+			return (element - (up)_memory) | BVHCacheHeader::RelativeValidMask;
+		}
+
+		inline EncodedElement makeAbsolute(EncodedElement element) const
+		{
+			if((element & BVHCacheHeader::RelativeValidMask) == 0)
+				return encodeEmpty();
+			return (element & ~BVHCacheHeader::RelativeValidMask) + (up)_memory;
+		}
+
 		static const EncodedElement LEAF_MASK = 0x00000001;
 		static const EncodedElement INVALID_ELEMENT = 0;
 		
@@ -272,48 +498,203 @@ namespace Raytrace {
 				std::array<size_t,NodeSize>	_childNodes;
 		*/
 
-		inline EncodedElement encodeConstructorNodeBreadthFirst(const typename Constructor::Node& root,const Constructor& constructor)
+		typedef typename Constructor::Node ConstructorNode;
+
+		struct LayoutItem
+		{
+			inline LayoutItem(const ConstructorNode* node,bool align) : _node(node),_align(align) {}
+
+			const ConstructorNode*	_node;
+			bool					_align;
+		};
+
+		typedef std::vector<LayoutItem> LayoutOrder;
+
+		static inline const ConstructorNode& getChild(const ConstructorNode& node,size_t i,const Constructor& constructor)
+		{
+			return constructor._nodes[ node._childNodes[i] ];
+		}
+
+		static inline void orderBreadthFirst(const ConstructorNode& root,const Constructor& constructor,LayoutOrder& order)
+		{
+			std::deque<const ConstructorNode*> nodes;
+			nodes.push_back(&root);
+
+			while(!nodes.empty())
+			{
+				const ConstructorNode& node = *nodes.front();
+				nodes.pop_front();
+				order.push_back(LayoutItem(&node,false));
+
+				for(size_t i = 0; i < node._numChildNodes; ++i)
+					nodes.push_back(&getChild(node,i,constructor));
+			}
+		}
+
+		static inline void orderDepthFirst(const ConstructorNode& root,const Constructor& constructor,LayoutOrder& order)
+		{
+			std::vector<const ConstructorNode*> nodes;
+			nodes.push_back(&root);
+
+			while(!nodes.empty())
+			{
+				const ConstructorNode& node = *nodes.back();
+				nodes.pop_back();
+				order.push_back(LayoutItem(&node,false));
+
+				// reversed so the first child is written directly after its parent
+				for(size_t i = node._numChildNodes; i > 0; --i)
+					nodes.push_back(&getChild(node,i-1,constructor));
+			}
+		}
+
+		static inline size_t getHeight(const ConstructorNode& node,const Constructor& constructor)
 		{
-			typedef std::pair<const typename Constructor::Node*,EncodedElement*> tempNode;
-			std::deque<tempNode> nodeStack;
-			nodeStack.push_back(tempNode(&root,nullptr));
-			EncodedElement result;
+			size_t height = 0;
+
+			for(size_t i = 0; i < node._numChildNodes; ++i)
+				height = std::max(height,getHeight(getChild(node,i,constructor),constructor));
+
+			return height + 1;
+		}
+
+		static inline void collectAtDepth(const ConstructorNode& node,const Constructor& constructor,size_t depth,std::vector<const ConstructorNode*>& result)
+		{
+			if(depth == 0)
+			{
+				result.push_back(&node);
+				return;
+			}
+
+			for(size_t i = 0; i < node._numChildNodes; ++i)
+				collectAtDepth(getChild(node,i,constructor),constructor,depth-1,result);
+		}
+
+		// top half of the levels first, then every bottom subtree, both recursively
+		static inline void orderVanEmdeBoas(const ConstructorNode& root,const Constructor& constructor,size_t levels,LayoutOrder& order)
+		{
+			if(levels <= 1)
+			{
+				order.push_back(LayoutItem(&root,false));
+				return;
+			}
+
+			const size_t top = levels / 2;
+			std::vector<const ConstructorNode*> bottom;
+
+			orderVanEmdeBoas(root,constructor,top,order);
+			collectAtDepth(root,constructor,top,bottom);
+
+			for(auto it = bottom.begin(); it != bottom.end(); ++it)
+				orderVanEmdeBoas(**it,constructor,levels - top,order);
+		}
+
+		static inline up getElementSize(const ConstructorNode& node)
+		{
+			return node._numChildNodes ? sizeof(TreeElement) : sizeof(LeafElement);
+		}
+
+		// grows each treelet from its root by always adding the candidate with the largest surface area,
+		// which is the one a ray entering the treelet most likely visits next
+		static inline void orderTreelet(const ConstructorNode& root,const Constructor& constructor,LayoutOrder& order)
+		{
+			typedef std::pair<Real,const ConstructorNode*> Candidate;
+
+			std::deque<const ConstructorNode*> treeletRoots;
+			treeletRoots.push_back(&root);
 
-			while(!nodeStack.empty())
+			while(!treeletRoots.empty())
 			{
-				const typename Constructor::Node& node = *nodeStack.front().first;
-				EncodedElement* parent = nodeStack.front().second;
-				nodeStack.pop_front();
+				std::priority_queue<Candidate> candidates;
+				up used = 0;
+				bool first = true;
+
+				candidates.push(Candidate(treeletRoots.front()->_bound.SAH(),treeletRoots.front()));
+				treeletRoots.pop_front();
+
+				while(!candidates.empty())
+				{
+					const ConstructorNode& node = *candidates.top().second;
+
+					if(!first && used + getElementSize(node) > TreeletSize)
+						break;
+
+					candidates.pop();
+					order.push_back(LayoutItem(&node,first));
+					used += getElementSize(node);
+					first = false;
+
+					for(size_t i = 0; i < node._numChildNodes; ++i)
+						candidates.push(Candidate(getChild(node,i,constructor)._bound.SAH(),&getChild(node,i,constructor)));
+				}
+
+				// whatever did not fit starts its own treelet, hottest first
+				while(!candidates.empty())
+				{
+					treeletRoots.push_back(candidates.top().second);
+					candidates.pop();
+				}
+			}
+		}
+
+		static inline up alignSize(up size,up alignment)
+		{
+			return ((size + alignment - 1) / alignment) * alignment;
+		}
+
+		static inline up getLayoutSize(const LayoutOrder& order)
+		{
+			up size = 0;
+
+			for(auto it = order.begin(); it != order.end(); ++it)
+			{
+				size = alignSize(size,it->_align ? TreeletAlignment : ElementAlignment);
+				size += getElementSize(*it->_node);
+			}
+
+			return size;
+		}
+
+		// places the elements in the given order, then links children to their final addresses
+		inline EncodedElement encodeConstructorNodes(const LayoutOrder& order,const Constructor& constructor)
+		{
+			std::unordered_map<const ConstructorNode*,EncodedElement> encoded;
+
+			for(auto it = order.begin(); it != order.end(); ++it)
+			{
+				_numUsed = alignSize(_numUsed,it->_align ? TreeletAlignment : ElementAlignment);
+
+				void* element = getMemory(getElementSize(*it->_node));
+				encoded[it->_node] = it->_node->_numChildNodes ? encodeNode(element) : encodeLeaf(element);
+			}
+
+			for(auto it = order.begin(); it != order.end(); ++it)
+			{
+				const ConstructorNode& node = *it->_node;
 
-				
 				if(node._numChildNodes)
 				{
 					//node
-					TreeElement* element = (TreeElement*)getMemory(sizeof(TreeElement));
+					TreeElement* element = (TreeElement*)getData(encoded[&node]);
 
 					std::array<VolumeItem,NodeSize> subvolumes;
 
 					for(size_t i = 0; i < node._numChildNodes; ++i)
-						subvolumes[i] = constructor._nodes[ node._childNodes[i] ]._bound;
+						subvolumes[i] = getChild(node,i,constructor)._bound;
 					for(size_t i = node._numChildNodes; i < NodeSize; ++i)
 						subvolumes[i] = VolumeItem::Empty();
 
 					new (element) TreeElement( ConstArrayWrapper<std::array<VolumeItem,NodeSize>>(subvolumes) );
-						
+
 					for(size_t i = 0; i < node._numChildNodes; ++i)
-						nodeStack.push_back(tempNode(&constructor._nodes[ node._childNodes[i] ],&element->_children[i]));
+						element->_children[i] = encoded[&getChild(node,i,constructor)];
 					for(size_t i = node._numChildNodes; i < NodeSize; ++i)
 						element->_children[i] = encodeEmpty();
-
-					if(parent)
-						*parent = encodeNode(element);
-					else
-						result = encodeNode(element);
 				}
 				else
 				{
 					//leaf
-					LeafElement* element = (LeafElement*)getMemory(sizeof(LeafElement));
+					LeafElement* element = (LeafElement*)getData(encoded[&node]);
 
 					std::array<LeafItem,LeafSize> leafs;
 
@@ -323,66 +704,10 @@ namespace Raytrace {
 						leafs[i] = LeafItem::Empty();
 
 					new (element) LeafElement( ConstArrayWrapper<std::array<LeafItem,LeafSize>>(leafs) );
-
-					if(parent)
-						*parent = encodeLeaf(element);
-					else
-						result = encodeLeaf(element);
 				}
 			}
-			return result;
-		}
-
-		inline EncodedElement encodeConstructorNodeDepthFirst(const typename Constructor::Node& root,const Constructor& constructor)
-		{
-			if(root._numChildNodes)
-			{
-				//node
-				TreeElement* element = (TreeElement*)getMemory(sizeof(TreeElement));
-				
-				std::array<VolumeItem,NodeSize> subvolumes;
-
-				for(size_t i = 0; i < root._numChildNodes; ++i)
-					subvolumes[i] = constructor._nodes[ root._childNodes[i] ]._bound;
-				for(size_t i = root._numChildNodes; i < NodeSize; ++i)
-					subvolumes[i] = VolumeItem::Empty();
-
-				new (element) TreeElement(subvolumes);
-						
-				for(size_t i = 0; i < root._numChildNodes; ++i)
-					element->_children[i] = encodeConstructorNode( constructor._nodes[ root._childNodes[i] ], constructor);
-				for(size_t i = root._numChildNodes; i < NodeSize; ++i)
-					element->_children[i] = encodeEmpty();
-				
-				//generate traverse order
-				/*
-				for(int i = 0; i < NUM_ORDER_ELEMENTS; ++i)
-				{
-					std::array<int,NodeSize> order = {0,1,2,3};
-					element->_childOrder[i] = 0;
 
-					for(int j = 0; j < NodeSize; ++j)
-						element->_childOrder[i] |= order[j] << (CHILD_NODE_INDEX_SIZE * j);
-				}*/
-
-				return encodeNode(element);
-			}
-			else
-			{
-				//leaf
-				LeafElement* element = (LeafElement*)getMemory(sizeof(LeafElement));
-				
-				std::array<LeafItem,LeafSize> leafs;
-
-				for(size_t i = 0; i < root._childItemEnd-root._childItemBegin; ++i)
-					leafs[i] = constructor._sortedItems[i+root._childItemBegin]->_item;
-				for(size_t i = root._childItemEnd-root._childItemBegin; i < LeafSize; ++i)
-					leafs[i] = LeafItem::Empty();
-				
-				new (element) LeafElement(leafs);
-
-				return encodeLeaf(element);
-			}
+			return encoded[order.front()._node];
 		}
 
 		inline void* getMemory(up size)
@@ -398,6 +723,8 @@ namespace Raytrace {
 		up								_numUsed;
 		up								_totalMem;
 		void*							_memory;
+		boost::shared_ptr<BVHCacheFile>	_cacheFile;
+		IntersectorStatistics			_statistics;
 
 		/*
 		std::vector<LeafElement,AlignedAllocator<LeafElement>>		_leaf;
@@ -0,0 +1,188 @@
+/********************************************************/
+// FILE: BVHCache.h
+// DESCRIPTION: On disk cache for constructed BVH's
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_BVH_CACHE_GUARD
+#define RAYTRACE_BVH_CACHE_GUARD
+
+#include <RaytraceCommon.h>
+#include "CacheFile.h"
+#include <fstream>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace Raytrace {
+
+	// FNV-1a, keys cache files on the scene geometry and all build settings
+	struct BVHCacheHasher
+	{
+		inline BVHCacheHasher() : _hash(14695981039346656037ULL)
+		{
+		}
+
+		inline void add(const void* data,size_t size)
+		{
+			const u8* bytes = (const u8*)data;
+			for(size_t i = 0; i < size; ++i)
+			{
+				_hash ^= (u64)bytes[i];
+				_hash *= 1099511628211ULL;
+			}
+		}
+
+		template<class _T> inline void add(const _T& value)
+		{
+			add(&value,sizeof(_T));
+		}
+
+		inline u64 value() const
+		{
+			return _hash;
+		}
+
+	private:
+		u64 _hash;
+	};
+
+	struct BVHCacheHeader
+	{
+		static const u32 Magic = 0x48564252; // "RBVH"
+		static const u32 Version = 4;
+
+		// offsets in the file are relative to the data block, this bit marks a valid element
+		static const up RelativeValidMask = 0x00000002;
+		static const up DataAlignment = 64;
+
+		u32		_magic;
+		u32		_version;
+		u64		_key;
+		u32		_pointerSize;
+		u32		_nodeSize;
+		u32		_leafSize;
+		u32		_treeElementSize;
+		u32		_leafElementSize;
+		u32		_statisticsSize;	// build statistics follow the header directly
+		u64		_dataOffset;
+		u64		_dataSize;
+		u64		_root;
+	};
+
+	// read only view of a cache file, mapped copy on write so the loader can relocate node pointers in place
+	struct BVHCacheFile
+	{
+		static inline String getPath(const String& directory,u64 key)
+		{
+			return CacheFile::getPath(directory,key,".bvh");
+		}
+
+		static inline boost::shared_ptr<BVHCacheFile> open(const String& path)
+		{
+			namespace ipc = boost::interprocess;
+
+			boost::shared_ptr<BVHCacheFile> result;
+
+			try
+			{
+				boost::shared_ptr<BVHCacheFile> file(new BVHCacheFile(path));
+
+				if(file->_region.get_size() < sizeof(BVHCacheHeader))
+					return result;
+
+				const BVHCacheHeader& header = file->header();
+
+				if(header._magic != BVHCacheHeader::Magic || header._version != BVHCacheHeader::Version)
+					return result;
+				if(header._dataOffset % BVHCacheHeader::DataAlignment != 0 || header._dataOffset + header._dataSize > file->_region.get_size())
+					return result;
+				if(sizeof(BVHCacheHeader) + header._statisticsSize > header._dataOffset)
+					return result;
+
+				result = file;
+			}
+			catch(const ipc::interprocess_exception&)
+			{
+				result.reset();
+			}
+
+			return result;
+		}
+
+		// other renders may be mapping path right now, so it is only ever replaced by a complete file
+		static inline bool write(const String& path,const BVHCacheHeader& header,const void* statistics,const void* data)
+		{
+			const String temporary = CacheFile::getTemporaryPath(path);
+
+			{
+				std::ofstream stream(temporary.c_str(),std::ios::out | std::ios::binary | std::ios::trunc);
+				if(!stream)
+					return false;
+
+				std::vector<char> padding((size_t)header._dataOffset - sizeof(BVHCacheHeader) - header._statisticsSize,0);
+
+				stream.write((const char*)&header,sizeof(BVHCacheHeader));
+				stream.write((const char*)statistics,header._statisticsSize);
+				if(!padding.empty())
+					stream.write(&padding[0],padding.size());
+				stream.write((const char*)data,(std::streamsize)header._dataSize);
+
+				stream.close();
+				if(stream.fail())
+				{
+					std::remove(temporary.c_str());
+					return false;
+				}
+			}
+
+			return CacheFile::replace(temporary,path);
+		}
+
+		static inline u64 getDataOffset(u32 statisticsSize)
+		{
+			return ((sizeof(BVHCacheHeader) + statisticsSize + BVHCacheHeader::DataAlignment - 1) / BVHCacheHeader::DataAlignment) * BVHCacheHeader::DataAlignment;
+		}
+
+		inline const BVHCacheHeader& header() const
+		{
+			return *(const BVHCacheHeader*)_region.get_address();
+		}
+
+		inline const void* statistics() const
+		{
+			return (const u8*)_region.get_address() + sizeof(BVHCacheHeader);
+		}
+
+		inline void* data()
+		{
+			return (u8*)_region.get_address() + header()._dataOffset;
+		}
+
+	private:
+		inline BVHCacheFile(const String& path) :
+			_file(path.c_str(),boost::interprocess::read_only),
+			_region(_file,boost::interprocess::copy_on_write)
+		{
+		}
+
+		boost::interprocess::file_mapping		_file;
+		boost::interprocess::mapped_region		_region;
+	};
+
+}
+
+#endif
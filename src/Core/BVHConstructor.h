@@ -11,6 +11,8 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #ifdef min
 #undef min
@@ -21,6 +23,8 @@
 #endif
 
 #include "AABB.h"
+#include "Triangle.h"
+#include "IIntersector.h"
 
 #ifndef RAYTRACE_BVH_CONSTRUCTOR_H_INCLUDED
 #define RAYTRACE_BVH_CONSTRUCTOR_H_INCLUDED
@@ -34,6 +38,28 @@ namespace Raytrace {
 #endif
 
 
+	// early split clipping, Ernst and Greiner 2007: primitives whose box surface area exceeds
+	// _areaRatio times their own area are cut into several references with tight boxes,
+	// at most _referenceBudget times the primitive count references are made in total
+	struct BVHSplitSettings
+	{
+		inline BVHSplitSettings() : _areaRatio(0.0f),_referenceBudget(1.0f)
+		{
+		}
+
+		inline BVHSplitSettings(Real areaRatio,Real referenceBudget) : _areaRatio(areaRatio),_referenceBudget(referenceBudget)
+		{
+		}
+
+		inline bool enabled() const
+		{
+			return _areaRatio > 0.0f && _referenceBudget > 1.0f;
+		}
+
+		Real	_areaRatio;
+		Real	_referenceBudget;
+	};
+
 	template<class _Leaf,class _Volume,int _NodeSize,int _LeafSize> struct BVHConstructor
 	{
 	public:
@@ -42,7 +68,10 @@ namespace Raytrace {
 		static const int NodeSize = _NodeSize;
 		static const int LeafSize = _LeafSize;
 
-		inline BVHConstructor(size_t binSize) : _binSize(binSize)
+		// no leaf ends up deeper than this, traversal stacks are sized for it
+		static const size_t MaxDepth = IntersectorStatistics::HistogramSize - 1;
+
+		inline BVHConstructor(size_t binSize) : _binSize(binSize),_numPrimitives(0)
 		{
 			_bins.resize( _binSize );
 		}
@@ -56,6 +85,67 @@ namespace Raytrace {
 			item._centroid = centroid;
 			item._volume = Volume(volume,centroid);
 			_items.push_back(item);
+			_numPrimitives++;
+		}
+
+		// run before the tree is built, the references of one primitive share its leaf item
+		void splitLargeElements(const BVHSplitSettings& settings,size_t numThreads)
+		{
+			if(!settings.enabled() || _items.empty())
+				return;
+
+			// worst offenders first, they get their references until the budget runs out
+			std::vector<std::pair<Real,size_t>> candidates;
+
+			for(size_t i = 0; i < _items.size(); ++i)
+			{
+				const Real area = triangleArea(_items[i]._item);
+				const Real ratio = area > 0.0f ? _items[i]._volume.SAH() / area : 0.0f;
+
+				if(ratio > settings._areaRatio)
+					candidates.push_back(std::make_pair(ratio,i));
+			}
+
+			std::sort(candidates.begin(),candidates.end(),std::greater<std::pair<Real,size_t>>());
+
+			size_t budget = (size_t)((settings._referenceBudget - 1.0f) * (Real)_items.size());
+			std::vector<SplitRequest> requests;
+
+			for(auto it = candidates.begin(); it != candidates.end() && budget > 0; ++it)
+			{
+				size_t pieces = 2;
+				while(pieces < MaxSplitPieces && (Real)pieces * settings._areaRatio < it->first)
+					pieces *= 2;
+				pieces = std::min(pieces,budget + 1);
+
+				SplitRequest request;
+				request._item = it->second;
+				request._pieces = pieces;
+				requests.push_back(request);
+
+				budget -= pieces - 1;
+			}
+
+			if(requests.empty())
+				return;
+
+			// every thread clips a contiguous run of requests, the extra references are
+			// appended in thread order so the result does not depend on scheduling
+			numThreads = std::max<size_t>(std::min(numThreads,requests.size()),1);
+			std::vector<std::vector<ConstructionItem>> references(numThreads);
+			boost::thread_group threads;
+
+			for(size_t t = 0; t < numThreads; ++t)
+			{
+				const size_t begin = requests.size() * t / numThreads;
+				const size_t end = requests.size() * (t + 1) / numThreads;
+				threads.create_thread(boost::bind(&BVHConstructor::splitRequests,this,&requests[0] + begin,&requests[0] + end,&references[t]));
+			}
+
+			threads.join_all();
+
+			for(size_t t = 0; t < numThreads; ++t)
+				_items.insert(_items.end(),references[t].begin(),references[t].end());
 		}
 			
 	private:
@@ -81,34 +171,7 @@ namespace Raytrace {
 			_rootNode._childItemEnd = _sortedItems.size();
 			_rootNode._bound = rootVolume;
 			_rootNode._splitDirection = -1;
-			makeMultiNode(_rootNode);
-			
-			size_t numLeafs=0,numNodes=0;
-			float leafUtilization = 0.0f,nodeUtilization = 0.0f;
-
-			for(auto it = _nodes.begin(); it != _nodes.end(); ++it)
-			{
-				if(it->_numChildNodes)
-				{
-					nodeUtilization += (float)(it->_numChildNodes);
-					++numNodes;
-				}
-				else
-				{
-					leafUtilization += (float)(it->_childItemEnd - it->_childItemBegin);
-					++numLeafs;
-				}
-			}
-
-			nodeUtilization /= (float)numNodes;
-			leafUtilization /= (float)numLeafs;
-
-			FILE* log = fopen("log.txt","w");
-
-			fprintf(log,"%u Nodes, %.2f full out of %u\n",numNodes,nodeUtilization,NodeSize);
-			fprintf(log,"%u Leaves, %.2f full out of %u\n",numLeafs,leafUtilization,LeafSize);
-
-			fclose(log);
+			makeMultiNode(_rootNode,0);
 		}
 
 		struct ConstructionItem
@@ -147,14 +210,30 @@ namespace Raytrace {
 			std::array<size_t,NodeSize>	_childNodes;
 		};
 
-		void makeMultiNode(Node& multi)
+		// levels below a node with this many items until every leaf fits, if every split halves it
+		static inline size_t getMedianLevels(size_t items)
+		{
+			size_t levels = 0;
+			while(items > LeafSize)
+			{
+				items = (items + 1) / 2;
+				++levels;
+			}
+			return levels;
+		}
+
+		void makeMultiNode(Node& multi,size_t depth)
 		{
 			if(!nodeWantsToSplit(multi))
 				return;
 
+			// SAH splits can peel off a single item per level, once that could go past MaxDepth
+			// only median splits are left, they halve every child and so always fit
+			const bool median = depth + 1 + getMedianLevels(multi._childItemEnd - multi._childItemBegin) > MaxDepth;
+
 			Node child = multi;
 			child._numChildNodes = 0;
-			initializeLeaf(child,child._childItemBegin,child._childItemEnd);
+			initializeLeaf(child,child._childItemBegin,child._childItemEnd,median);
 
 			size_t childId = _nodes.size();
 			_nodes.push_back(child);
@@ -173,13 +252,13 @@ namespace Raytrace {
 					break;
 				else
 				{
-					multi._childNodes[multi._numChildNodes] = splitNode( _nodes[multi._childNodes[splitChild]] );
+					multi._childNodes[multi._numChildNodes] = splitNode( _nodes[multi._childNodes[splitChild]],median );
 					multi._numChildNodes++;
 				}
 			}
 
 			for(size_t i = 0; i < multi._numChildNodes; ++i)
-				makeMultiNode( _nodes[multi._childNodes[i]] );
+				makeMultiNode( _nodes[multi._childNodes[i]],depth + 1 );
 
 			assert(multi._childItemEnd == 0 && multi._childItemBegin == 0);
 
@@ -300,7 +379,7 @@ namespace Raytrace {
 			return true;
 		}
 		
-		void initializeLeaf(Node& node,size_t itemBegin,size_t itemEnd)
+		void initializeLeaf(Node& node,size_t itemBegin,size_t itemEnd,bool median)
 		{
 			assert(node._numChildNodes == 0);
 
@@ -312,6 +391,12 @@ namespace Raytrace {
 				totalVolume = Volume( totalVolume, _sortedItems[i]->_volume );
 			}
 
+			if(median)
+			{
+				initializeMedianLeaf(node,itemBegin,itemEnd,centroidVolume,totalVolume);
+				return;
+			}
+
 			float newSah;
 			//float dominantSize = centroidVolume.size
 			size_t dominant = 0;
@@ -376,7 +461,39 @@ namespace Raytrace {
 			node._numChildNodes = 0;
 		}
 
-		inline size_t splitNode(Node& oldNode)
+		struct CentroidLess
+		{
+			inline CentroidLess(size_t axis) : _axis(axis) {}
+
+			inline bool operator()(const ConstructionItem* a,const ConstructionItem* b) const
+			{
+				return a->_centroid[_axis] < b->_centroid[_axis];
+			}
+
+			size_t	_axis;
+		};
+
+		// halves the items along the longest centroid axis, the split is picked by size instead of SAH
+		void initializeMedianLeaf(Node& node,size_t itemBegin,size_t itemEnd,const Volume& centroidVolume,const Volume& totalVolume)
+		{
+			size_t dominant = 0;
+			for(int i = 1; i < 3; ++i)
+				if(centroidVolume.max()[i] - centroidVolume.min()[i] > centroidVolume.max()[dominant] - centroidVolume.min()[dominant])
+					dominant = i;
+
+			const size_t center = (itemBegin + itemEnd) / 2;
+			std::nth_element(_sortedItems.begin() + itemBegin,_sortedItems.begin() + center,_sortedItems.begin() + itemEnd,CentroidLess(dominant));
+
+			node._childItemBegin = itemBegin;
+			node._childItemEnd = itemEnd;
+			node._bound = totalVolume;
+			node._splitDirection = dominant;
+			node._splitSAH = 1.0f;
+			node._childSplit = center;
+			node._numChildNodes = 0;
+		}
+
+		inline size_t splitNode(Node& oldNode,bool median)
 		{
 			Node newNode;
 			
@@ -384,8 +501,8 @@ namespace Raytrace {
 			size_t center = oldNode._childSplit;
 			size_t newEnd = oldNode._childItemEnd;
 			
-			initializeLeaf(oldNode,oldBegin,center);
-			initializeLeaf(newNode,center,newEnd);
+			initializeLeaf(oldNode,oldBegin,center,median);
+			initializeLeaf(newNode,center,newEnd,median);
 
 			_nodes.push_back(newNode);
 			return _nodes.size()-1;
@@ -448,12 +565,248 @@ namespace Raytrace {
 			return dominant;
 		}
 
+		// primitives sampled for the overlap estimate, overlap is found by walking the tree once per sample
+		static const size_t OverlapSampleCount = 1024;
+
+		void getStatistics(IntersectorStatistics& statistics) const
+		{
+			static const float LeafCost = LeafSize;
+			static const float NodeCost = NodeSize;
+
+			const Real rootArea = _rootNode._bound.SAH();
+
+			statistics._primitiveCount = (u32)_numPrimitives;
+			statistics._referenceCount = (u32)_items.size();
+
+			float nodeUtilization = 0.0f,leafUtilization = 0.0f;
+			std::vector<std::pair<const Node*,size_t>> stack;
+			stack.push_back(std::make_pair(&_rootNode,(size_t)0));
+
+			while(!stack.empty())
+			{
+				const Node& node = *stack.back().first;
+				const size_t depth = stack.back().second;
+				stack.pop_back();
+
+				const Real probability = rootArea > 0.0f ? node._bound.SAH() / rootArea : 1.0f;
+				statistics._maxDepth = std::max(statistics._maxDepth,(u32)depth);
+
+				if(node._numChildNodes)
+				{
+					statistics._nodeCount ++;
+					statistics._sahCost += probability * NodeCost;
+					nodeUtilization += (float)node._numChildNodes;
+
+					for(size_t i = 0; i < node._numChildNodes; ++i)
+						stack.push_back(std::make_pair(&_nodes[ node._childNodes[i] ],depth + 1));
+				}
+				else
+				{
+					const size_t items = node._childItemEnd - node._childItemBegin;
+
+					statistics._leafCount ++;
+					statistics._sahCost += probability * LeafCost;
+					leafUtilization += (float)items;
+
+					statistics._leafDepthHistogram[ std::min(depth,IntersectorStatistics::HistogramSize-1) ] ++;
+					statistics._leafFillHistogram[ std::min(items,IntersectorStatistics::HistogramSize-1) ] ++;
+				}
+			}
+
+			if(statistics._nodeCount)
+				statistics._nodeFill = nodeUtilization / (float)statistics._nodeCount;
+			if(statistics._leafCount)
+				statistics._leafFill = leafUtilization / (float)statistics._leafCount;
+
+			// EPO as in Aila et al. 2013, area of each primitive that lies inside nodes which do not hold it
+			const size_t step = std::max(_sortedItems.size() / OverlapSampleCount,(size_t)1);
+			Real overlap = 0.0f,area = 0.0f;
+
+			for(size_t i = 0; i < _sortedItems.size(); i += step)
+			{
+				const ConstructionItem& item = *_sortedItems[i];
+				std::array<Vector3,3> points = {{ item._item.point(0), item._item.point(1), item._item.point(2) }};
+
+				area += clippedArea(points,item._volume);
+				accumulateOverlap(_rootNode,i,points,item._volume,overlap);
+			}
+
+			statistics._epo = area > 0.0f ? overlap / area : 0.0f;
+		}
+
+		// returns true if the subtree holds the item
+		bool accumulateOverlap(const Node& node,size_t item,const std::array<Vector3,3>& points,const Volume& bound,Real& overlap) const
+		{
+			for(int d = 0; d < 3; ++d)
+				if(bound.min()[d] > node._bound.max()[d] || bound.max()[d] < node._bound.min()[d])
+					return false;
+
+			bool holds = false;
+
+			if(node._numChildNodes)
+			{
+				for(size_t i = 0; i < node._numChildNodes; ++i)
+					holds |= accumulateOverlap(_nodes[ node._childNodes[i] ],item,points,bound,overlap);
+			}
+			else
+				holds = item >= node._childItemBegin && item < node._childItemEnd;
+
+			if(!holds)
+				overlap += (node._numChildNodes ? (Real)NodeSize : (Real)LeafSize) * clippedArea(points,node._bound);
+
+			return holds;
+		}
+
+		// area of the part of a triangle inside a box
+		static Real clippedArea(const std::array<Vector3,3>& points,const Volume& box)
+		{
+			std::array<Vector3,9> polygon;
+			const size_t count = clipTriangle(points,box,polygon);
+
+			Vector3 normal(0.0f,0.0f,0.0f);
+			for(size_t i = 2; i < count; ++i)
+				normal += (polygon[i-1] - polygon[0]).cross(polygon[i] - polygon[0]);
+
+			return normal.norm() * 0.5f;
+		}
+
+		// Sutherland-Hodgman against the six planes of the box, returns the vertex count of the polygon
+		static size_t clipTriangle(const std::array<Vector3,3>& points,const Volume& box,std::array<Vector3,9>& polygon)
+		{
+			std::array<Vector3,9> clipped;
+			size_t count = 3;
+
+			for(size_t i = 0; i < 3; ++i)
+				polygon[i] = points[i];
+
+			for(int plane = 0; plane < 6 && count > 0; ++plane)
+			{
+				const int d = plane / 2;
+				const bool upper = (plane & 1) != 0;
+				const Real limit = upper ? box.max()[d] : box.min()[d];
+				size_t clippedCount = 0;
+
+				for(size_t i = 0; i < count; ++i)
+				{
+					const Vector3& a = polygon[i];
+					const Vector3& b = polygon[(i+1)%count];
+					const Real da = upper ? limit - a[d] : a[d] - limit;
+					const Real db = upper ? limit - b[d] : b[d] - limit;
+
+					if(da >= 0.0f)
+						clipped[clippedCount++] = a;
+					if((da >= 0.0f) != (db >= 0.0f))
+						clipped[clippedCount++] = a + (b - a) * (da / (da - db));
+				}
+
+				polygon = clipped;
+				count = clippedCount;
+			}
+
+			return count;
+		}
+
+		// more pieces than this per primitive rarely shrink the boxes any further
+		static const size_t MaxSplitPieces = 16;
+
+		struct SplitRequest
+		{
+			size_t	_item;
+			size_t	_pieces;
+		};
+
+		// clipping only handles triangles, analytic shapes keep their single box
+		static inline Real triangleArea(const LeafItem& item)
+		{
+			if(item.shape() != PrimitiveShapeTriangle)
+				return 0.0f;
+
+			return (item.point(1) - item.point(0)).cross(item.point(2) - item.point(0)).norm() * 0.5f;
+		}
+
+		// the first reference of every primitive replaces its item in place, the rest go to references
+		void splitRequests(const SplitRequest* begin,const SplitRequest* end,std::vector<ConstructionItem>* references)
+		{
+			std::vector<Volume> boxes;
+
+			for(const SplitRequest* request = begin; request != end; ++request)
+			{
+				ConstructionItem& item = _items[request->_item];
+				std::array<Vector3,3> points = {{ item._item.point(0), item._item.point(1), item._item.point(2) }};
+
+				boxes.clear();
+				splitBox(points,item._volume,request->_pieces,boxes);
+
+				for(size_t i = 0; i < boxes.size(); ++i)
+				{
+					ConstructionItem reference = item;
+					reference._centroid = (boxes[i].min() + boxes[i].max()) * 0.5f;
+					reference._volume = boxes[i];
+
+					if(i == 0)
+						item = reference;
+					else
+						references->push_back(reference);
+				}
+			}
+		}
+
+		// halves the box along its longest axis and shrinks both halves to the clipped triangle
+		static void splitBox(const std::array<Vector3,3>& points,const Volume& box,size_t pieces,std::vector<Volume>& boxes)
+		{
+			if(pieces < 2)
+			{
+				boxes.push_back(box);
+				return;
+			}
+
+			const Vector3 extent = box.max() - box.min();
+			int axis = 0;
+			if(extent.y() > extent[axis])
+				axis = 1;
+			if(extent.z() > extent[axis])
+				axis = 2;
+
+			const Real middle = (box.min()[axis] + box.max()[axis]) * 0.5f;
+			Volume halves[2] = { box, box };
+			halves[0].max()[axis] = middle;
+			halves[1].min()[axis] = middle;
+
+			std::array<Volume,2> tight;
+			std::array<bool,2> valid;
+
+			for(int h = 0; h < 2; ++h)
+			{
+				std::array<Vector3,9> polygon;
+				const size_t count = clipTriangle(points,halves[h],polygon);
+
+				valid[h] = count >= 3;
+				if(!valid[h])
+					continue;
+
+				tight[h] = Volume(polygon[0],polygon[0]);
+				for(size_t i = 1; i < count; ++i)
+					tight[h] = Volume(tight[h],polygon[i]);
+			}
+
+			if(!valid[0] || !valid[1])
+			{
+				// clipping lost a sliver to rounding, keep whatever is left as one piece
+				boxes.push_back(valid[0] ? tight[0] : (valid[1] ? tight[1] : box));
+				return;
+			}
+
+			splitBox(points,tight[0],pieces / 2,boxes);
+			splitBox(points,tight[1],pieces - pieces / 2,boxes);
+		}
+
 		const size_t					_binSize;
 		Node							_rootNode;
 		std::deque<Node>				_nodes;
 		std::vector<Bin>				_bins;
 		std::vector<ConstructionItem*>	_sortedItems;
 		std::vector<ConstructionItem>	_items;
+		size_t							_numPrimitives;		// items before splitLargeElements added references
 	};
 }
 
@@ -3,6 +3,7 @@
 #include "Engines.h"
 
 #include "BVHIntersector.h"
+#include <boost/integer.hpp>
 
 namespace Raytrace {
 	
@@ -12,6 +13,62 @@ typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateBVHInterse
 	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,4,1,1>());
 }
 
+template<class _RayData,class _SceneReader,BVHLayout _Layout> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateLayoutBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,4,1,1>(_Layout));
+}
+
+#ifdef SIMD_AVX2
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateWideBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,8,1,1>());
+}
+#endif
+
+template<class _RayData,class _SceneReader,int _QuantizationBits> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateQuantizedBVHIntersector()
+{
+	typedef typename boost::uint_t<_QuantizationBits>::least Quantized;
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatQuantized<Quantized>>());
+}
+
+template<class _RayData,class _SceneReader,class _TriangleMethod> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateTriangleMethodBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,4,1,1,BVHVolumeFormatFull,_TriangleMethod>());
+}
+
+// boxes over 16 times the triangle area are split, with at most 30% more references than triangles
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateSplitBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,4,1,1>(BVHLayoutBreadthFirst,BVHSplitSettings(16.0f,1.3f)));
+}
+
+template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int _LeafArraySize> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateConfiguredBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new BVHIntersector<_RayData,_SceneReader,_SimdWidth,_NodeArraySize,_LeafArraySize>());
+}
+
 template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateBVHIntersector();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateQuantizedBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,8>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateQuantizedBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,16>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateLayoutBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,BVHLayoutDepthFirst>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateLayoutBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,BVHLayoutVanEmdeBoas>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateLayoutBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,BVHLayoutTreelet>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateTriangleMethodBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,RayTriangleIntersectionMethodMoellerTrumbore>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateTriangleMethodBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,RayTriangleIntersectionMethodWatertight>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateTriangleMethodBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,RayTriangleIntersectionMethodBaldwinWeber>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateTriangleMethodBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,RayTriangleIntersectionMethodAnalytic>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateSplitBVHIntersector();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateConfiguredBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,4,2,1>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateConfiguredBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,4,1,2>();
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateConfiguredBVHIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader,4,2,2>();
+#ifdef SIMD_AVX2
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateWideBVHIntersector();
+#endif
 
 }
\ No newline at end of file
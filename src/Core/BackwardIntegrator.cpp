@@ -10,9 +10,20 @@ namespace Raytrace {
 template<class _SampleData,class _RayData,class _SceneReader> 
 typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateBackwardIntegrator()
 {
-	return boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>>(new BackwardIntegrator<_SampleData,_RayData,_SceneReader,64>());
+	return boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>>(new BackwardIntegrator<_SampleData,_RayData,_SceneReader,64,4>());
 }
 
+#ifdef SIMD_AVX2
+template<class _SampleData,class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateWideBackwardIntegrator()
+{
+	return boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>>(new BackwardIntegrator<_SampleData,_RayData,_SceneReader,64,8>());
+}
+#endif
+
 template boost::shared_ptr<IIntegrator<DefaultEngine::SampleData,DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateBackwardIntegrator();
+#ifdef SIMD_AVX2
+template boost::shared_ptr<IIntegrator<DefaultEngine::SampleData,DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateWideBackwardIntegrator();
+#endif
 
 }
\ No newline at end of file
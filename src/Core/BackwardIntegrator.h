@@ -21,12 +21,12 @@
 
 #include <RaytraceCommon.h>
 #include "IntegratorBase.h"
-#include "static_vector.h"
+#include "SIMDType.h"
 
 
 namespace Raytrace {
 	
-template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlock> struct BackwardIntegrator : public IntegratorBase<_SampleData,_RayData,_SceneReader>
+template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlock,int _ShadeWidth> struct BackwardIntegrator : public IntegratorBase<_SampleData,_RayData,_SceneReader>
 {
 	typedef Eigen::Array<Real,3,1> ColorArray;
 
@@ -45,6 +45,13 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 	static const size_t ChunkSize = 8*1024;
 
 	static const size_t NumPathsPerBlock = _NumPathsPerBlock;
+
+	// paths are shaded in groups of ShadeWidth, one per simd lane
+	static const int ShadeWidth = _ShadeWidth;
+
+	typedef SimdType<float,ShadeWidth>				Scalar_T;
+	typedef typename Scalar_T::Boolean				Boolean;
+	typedef typename Vector3v<ShadeWidth>::type		Vector3_T;
 	
 	struct DirectNode
 	{
@@ -74,22 +81,65 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 		ColorArray								_accumulatedRadiance;
 
 		Vector3									_parentDir;
+		Vector3									_origin;			// where the ray that found this intersection started
+		Real									_reflectedPdf;		// solid angle pdf that ray was sampled with, 0 for camera rays
 		ColorArray								_importance;
 		Real									_cumulativeRoulette;
 		Real									_rouletteThreshold;
+		Real									_time;
 	};
 	
-	
-	static const size_t MaxEstimators = 4;
-	
-	struct Estimator
+
+	// the reflection step of a group of paths in SoA form, lanes without a path stay zero
+	struct ShadingBatch
 	{
-		Vector3		_v;
-		ColorArray	_factor;
-		Real		_weight;
-		Real		_pdf;
-		Real		_pdfSum;
-		Real		_c;
+		std::array<Path*,ShadeWidth>			_paths;
+		std::array<PrimitiveData,ShadeWidth>	_primitives;
+
+		// roulette
+		Vector3_T		_importance;
+		Vector3_T		_diffuseColor;
+		Vector3_T		_specularColor;
+		Vector3_T		_refractedColor;
+		Scalar_T		_cumulativeRoulette;
+		Scalar_T		_rouletteThreshold;
+
+		// the sampled direction and the lobes it is weighted against
+		Vector3_T		_normal;
+		Vector3_T		_toViewer;
+		Vector3_T		_reflected;
+		Vector3_T		_vSpec;
+		Vector3_T		_vRef;
+		Scalar_T		_cDiffuse;
+		Scalar_T		_cSpecular;
+		Scalar_T		_cRefracted;
+		Scalar_T		_backgroundPdf;		// times the chance of the background lobe
+		Scalar_T		_sampledPdf;		// chance times pdf of the lobe _reflected came from, 0 if none
+		Scalar_T		_specularPower;
+		Scalar_T		_refractionPower;
+		Scalar_T		_indexOfRefraction;
+		Scalar_T		_transparency;
+
+		// inputs of the lobe sampling
+		Scalar_T		_u;
+		Scalar_T		_v;
+		Scalar_T		_random;
+		Scalar_T		_diffuseReflect;
+		Scalar_T		_specularReflect;
+
+		inline void clear()
+		{
+			_paths.fill(nullptr);
+
+			Vector3_T* vectors[] = { &_importance,&_diffuseColor,&_specularColor,&_refractedColor,&_normal,&_toViewer,&_reflected,&_vSpec,&_vRef };
+			for(size_t i = 0; i < sizeof(vectors)/sizeof(vectors[0]); ++i)
+				vectors[i]->x() = vectors[i]->y() = vectors[i]->z() = Scalar_T::Zero();
+
+			_cumulativeRoulette = _rouletteThreshold = Scalar_T::Zero();
+			_cDiffuse = _cSpecular = _cRefracted = _backgroundPdf = _sampledPdf = Scalar_T::Zero();
+			_specularPower = _refractionPower = _indexOfRefraction = _transparency = Scalar_T::Zero();
+			_u = _v = _random = _diffuseReflect = _specularReflect = Scalar_T::Zero();
+		}
 	};
 
 	typedef chunked_vector<DirectNode,ChunkSize> DirectNodeArray;
@@ -109,7 +159,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 	
 	void InitializePrepareST(size_t numThreads,const SceneReader& scene,SampleData& sampleData,RayData& rayData) 
 	{
-		InitializeSceneData(scene);
+		InitializeSceneData(numThreads,scene);
 		
 		_threads.resize(numThreads);
 		_pathArrays[_readPathArray].prepare(numThreads);
@@ -151,7 +201,9 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 			PathsArrayType& pathWrite = _pathArrays[_writePathArray];
 
 			// create a new indirect node
-			RayType cameraRay = _camera( _sampleData->getSampleValueImageXY(newSample,threadId));
+			newSample._imageXY = _sampleData->getSampleValueImageXY(newSample,threadId);
+			RayType cameraRay = _camera( newSample._imageXY );
+			cameraRay.setTime( _sampleData->getSampleValueTimeT(newSample,threadId));
 
 
 			// create a new sample
@@ -174,6 +226,9 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 			path->_firstDirect = -1;
 			path->_numDirect = 0;
 			path->_parentDir = -cameraRay.direction();
+			path->_origin = cameraRay.origin();
+			path->_reflectedPdf = 0.0f;
+			path->_time = cameraRay.time();
 			path->_importance = ColorArray(1.0f,1.0f,1.0f);
 			path->_cumulativeRoulette = 1.0f;
 			path->_rouletteThreshold = _sampleData->getSampleValueMisc(path->_sample,threadId);
@@ -188,14 +243,27 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 		// go to first element
 		pathRead.advanceElement(threadId);
 
+		// read blocks stay in place for the whole step, so paths can be collected before shading them
+		std::array<Path*,ShadeWidth> group;
+		size_t groupSize = 0;
+
 		Path* currPath;
 
 		while(currPath = pathRead.currElement(threadId))
 		{
-			processPath(*currPath,threadId);
+			group[groupSize++] = currPath;
+
+			if(groupSize == ShadeWidth)
+			{
+				processPaths(group,groupSize,threadId);
+				groupSize = 0;
+			}
 
 			pathRead.advanceElement(threadId);
 		}
+
+		if(groupSize)
+			processPaths(group,groupSize,threadId);
 	}
 	bool IntegrateCompleteST() 
 	{
@@ -209,104 +277,171 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 		return true;
 	}
 
-	inline void processPath(Path& oldPath,size_t threadId)
+	// shades a group of paths, the per path parts (gathering results, picking lights, drawing random
+	// values) run lane by lane, roulette, sampling a lobe and weighting the direction on all lanes at once
+	inline void processPaths(const std::array<Path*,ShadeWidth>& paths,size_t count,size_t threadId)
 	{
-		static const Real SphereArea = (float)(4.0f*R_PI);
 		static const Real Epsilon = 0.00001f;
 
 		PathsArrayType& pathWrite = _pathArrays[_writePathArray];
-		ThreadData& threadDataWrite = _threads[threadId];
-		ThreadData& threadDataRead = _threads[oldPath._threadId];
-		const DirectNodeArray& directNodeRead = threadDataRead._directNodes[_readPathArray];
-		
-		GatherPathDirectLight(oldPath,directNodeRead);
-		GatherPathEmissive(oldPath);
+		DirectNodeArray& directNodeWrite = _threads[threadId]._directNodes[_writePathArray];
 
-		// decide if we integrate further
+		ShadingBatch batch;
+		batch.clear();
 
-		if( (oldPath._cumulativeRoulette <= oldPath._rouletteThreshold) || (oldPath._id == -1) || (oldPath._importance[0] <= Epsilon && oldPath._importance[1] <= Epsilon && oldPath._importance[2] <= Epsilon) )
+		for(size_t lane = 0; lane < count; ++lane)
 		{
-			// was emitted
-			completePath(oldPath,threadId);
-			return;
+			Path& path = *paths[lane];
+			const DirectNodeArray& directNodeRead = _threads[path._threadId]._directNodes[_readPathArray];
+
+			GatherPathDirectLight(path,directNodeRead);
+			GatherPathEmissive(path);
+
+			// decide if we integrate further
+
+			if( (path._cumulativeRoulette <= path._rouletteThreshold) || (path._id == -1) || (path._importance[0] <= Epsilon && path._importance[1] <= Epsilon && path._importance[2] <= Epsilon) )
+			{
+				completePath(path,threadId);
+				continue;
+			}
+
+			path._numIntersections++;
+			path._numDirect = 0;
+			path._threadId = threadId;
+
+			GeneratePathDirectLight(path,directNodeWrite);
+
+			batch._paths[lane] = &path;
+			batch._primitives[lane] = getPrimitiveAt(path._id,path._intersectionAbsolute,path._time);
+			const MaterialSettings& material = _materials[batch._primitives[lane]._material];
+
+			setLane(batch._importance,lane,path._importance.matrix());
+			setLane(batch._diffuseColor,lane,(material._color * material._diffuseReflect).matrix());
+			setLane(batch._specularColor,lane,(material._specularReflect * material._mirrorColor).matrix());
+			setLane(batch._refractedColor,lane,(material._transparency * material._filterColor).matrix());
+			batch._cumulativeRoulette[lane] = path._cumulativeRoulette;
+			batch._rouletteThreshold[lane] = path._rouletteThreshold;
 		}
-		else
-		{
-			Path* newPath = &oldPath;
-			newPath->_numIntersections = oldPath._numIntersections + 1;
-			newPath->_numDirect = 0;
-			DirectNodeArray& directNodeWrite = threadDataWrite._directNodes[_writePathArray];
-			
-				/*
-			assert(newPath->_importance.x() >= 0.0f);
-			assert(newPath->_importance.y() >= 0.0f);
-			assert(newPath->_importance.z() >= 0.0f);
-			*/
-			newPath->_threadId = threadId;
 
-			GeneratePathDirectLight(*newPath,directNodeWrite);
-				/*
-			assert(newPath->_importance.x() < 1000.0f);
-			assert(newPath->_importance.y() < 1000.0f);
-			assert(newPath->_importance.z() < 1000.0f);
-			*/
-			const PrimitiveData& primitive = _primitives[newPath->_id];
-			const MaterialSettings& material = _materials[primitive._material];
+		// roulette on the albedo, no more than the importance that's left
+		const Scalar_T zero = Scalar_T::Zero();
+		const Scalar_T one = Scalar_T::One();
 
-			ColorArray weightedAlbedo = Albedo(material,primitive,newPath->_parentDir);
-			
-			weightedAlbedo.x() = std::min(weightedAlbedo.x(),newPath->_importance.x());
-			weightedAlbedo.y() = std::min(weightedAlbedo.y(),newPath->_importance.y());
-			weightedAlbedo.z() = std::min(weightedAlbedo.z(),newPath->_importance.z());
+		const Vector3_T albedo = batch._diffuseColor + batch._specularColor + batch._refractedColor;
+		Scalar_T reflectionChance = zero;
+		for(int c = 0; c < 3; ++c)
+			reflectionChance = reflectionChance.Max( albedo[c].Max(zero).Min(one).Min(batch._importance[c]) );
+		reflectionChance = reflectionChance.Min(Scalar_T(.9f));
 
-			Real reflectionChance = std::min<Real>(.9f,std::max<Real>(0.0f,std::max<Real>(std::max<Real>(weightedAlbedo.x(),weightedAlbedo.y()),weightedAlbedo.z()))); 
+		batch._cumulativeRoulette *= reflectionChance;
+		const Boolean reflect = batch._cumulativeRoulette > batch._rouletteThreshold;
+		const int reflectMask = reflect.mask();
 
-			newPath->_cumulativeRoulette *= reflectionChance;
+		// random values and the material of each reflecting lane, in the order the sampler hands them out
+		for(size_t lane = 0; lane < count; ++lane)
+		{
+			if(!(reflectMask & (1 << lane)))
+				continue;
 
-			//assert(newPath->_rouletteThreshold >= 0.0f);
+			Path& path = *batch._paths[lane];
+			const PrimitiveData& primitive = batch._primitives[lane];
+			const MaterialSettings& material = _materials[primitive._material];
 
-			if(newPath->_cumulativeRoulette > newPath->_rouletteThreshold)
-			{
-				Vector3 reflectedDir;
-				/*
-				assert(newPath->_importance.x() >= 0.0f);
-				assert(newPath->_importance.y() >= 0.0f);
-				assert(newPath->_importance.z() >= 0.0f);
-				*/
-				ColorArray  reflectedImportance= GetReflectedRay(*newPath,threadId,reflectedDir);
-			
+			const Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,path._threadId);
+			batch._u[lane] = uv.x();
+			batch._v[lane] = uv.y();
+			batch._random[lane] = _sampleData->getSampleValueMisc(path._sample,path._threadId);
+
+			setLane(batch._normal,lane,primitive._normal);
+			setLane(batch._toViewer,lane,path._parentDir);
+			batch._diffuseReflect[lane] = material._diffuseReflect;
+			batch._specularReflect[lane] = material._specularReflect;
+			batch._specularPower[lane] = material._specularPower;
+			batch._refractionPower[lane] = material._refractionPower;
+			batch._indexOfRefraction[lane] = material._indexOfRefraction;
+			batch._transparency[lane] = material._transparency;
+		}
+
+		SampleLobes(batch,reflect,count);
+
+		// weight the sampled directions against all lobes as in GetReflectedPdf, with the brdf of
+		// GetReflectedFactor. The specular lobe and the brdf share the cosine, mirroring either
+		// direction about the normal gives the same angle to the other.
+		const Scalar_T invPi(1.0f/(Real)R_PI);
+		const Scalar_T inv2Pi(0.5f/(Real)R_PI);
+
+		const Scalar_T cosLight = batch._reflected.dot(batch._normal);
+		const Scalar_T cosViewer = batch._toViewer.dot(batch._normal);
+		const Scalar_T cosSpecular = batch._reflected.dot(batch._vSpec);
+		const Scalar_T cosRefracted = batch._reflected.dot(batch._vRef);
+
+		// refraction of the sampled direction as GetRefractedDirection, only its cosine to the viewer is needed
+		const Boolean front = cosLight > zero;
+		const Scalar_T eta = Scalar_T::Condition(front,one / batch._indexOfRefraction,batch._indexOfRefraction);
+		const Scalar_T side = Scalar_T::Condition(front,one,-one);
+		const Scalar_T cosTheta1 = cosLight.Absolute();
+		const Scalar_T cosTheta2sq = one - eta*eta*(one - cosTheta1*cosTheta1);
+		const Scalar_T cosTheta2 = cosTheta2sq.Max(zero).Sqrt();
+		const Scalar_T cosTransmitted = side*(eta*cosTheta1 - cosTheta2)*cosViewer - eta*batch._reflected.dot(batch._toViewer);
+
+		const Scalar_T powSpecular = cosSpecular.Max(zero).Pow(batch._specularPower);
+		const Scalar_T powRefracted = cosRefracted.Max(zero).Pow(batch._refractionPower);
+		const Scalar_T powTransmitted = cosTransmitted.Max(zero).Pow(batch._specularPower);
+
+		const Scalar_T pdfDiffuse = Scalar_T::Condition(cosLight > zero,cosLight*invPi*batch._cDiffuse,zero);
+		const Scalar_T pdfSpecular = Scalar_T::Condition(cosSpecular > zero,(batch._specularPower + Scalar_T(2.0f))*powSpecular*inv2Pi*batch._cSpecular,zero);
+		const Scalar_T pdfRefracted = Scalar_T::Condition(cosRefracted > zero,(batch._refractionPower + Scalar_T(2.0f))*powRefracted*inv2Pi*batch._cRefracted,zero);
+
+		const Scalar_T pdf = pdfDiffuse + pdfSpecular + pdfRefracted + batch._backgroundPdf;
+		const Scalar_T heuristicSum = pdfDiffuse*pdfDiffuse + pdfSpecular*pdfSpecular + pdfRefracted*pdfRefracted + batch._backgroundPdf*batch._backgroundPdf;
+
+		const Scalar_T brdfDiffuse = Scalar_T::Condition((cosLight > zero) & (cosViewer > zero),cosLight*invPi,zero);
+		const Scalar_T brdfSpecular = Scalar_T::Condition((cosSpecular > zero) & (batch._cSpecular > zero),(batch._specularPower + one)*powSpecular*inv2Pi,zero);
+		const Scalar_T brdfTransmitted = Scalar_T::Condition((cosTheta2sq >= zero) & (cosTransmitted > zero) & (batch._transparency > zero),(batch._specularPower + one)*powTransmitted*inv2Pi,zero);
+
+		// power heuristic for the sampled lobe, factor * (c*pdf)^2/heuristicSum / (c*pdf), and the roulette
+		const Boolean sampled = (batch._sampledPdf > zero) & (heuristicSum > zero);
+		const Scalar_T weight = Scalar_T::Condition(sampled,batch._sampledPdf / (heuristicSum * reflectionChance),zero);
+		const Scalar_T reflectedPdf = Scalar_T::Condition(sampled,pdf,zero);
+
+		Boolean extend = Boolean::Zero();
+		for(int c = 0; c < 3; ++c)
+		{
+			const Scalar_T factor = batch._diffuseColor[c]*brdfDiffuse + batch._specularColor[c]*brdfSpecular + batch._refractedColor[c]*brdfTransmitted;
+			batch._importance[c] = Scalar_T::Condition(reflect,batch._importance[c]*factor*weight,batch._importance[c]);
+			extend |= batch._importance[c] > Scalar_T(Epsilon);
+		}
 
-				//newPath->_accumulatedRadiance = newPath->_pdf;
-				/*completePath(*newPath,threadId);
-				return;*/
+		const int extendMask = (extend & reflect).mask();
 
-				newPath->_parentDir = -reflectedDir;
+		for(size_t lane = 0; lane < count; ++lane)
+		{
+			if(!batch._paths[lane])
+				continue;
 
-				//assert(reflectionChance > 0.0f);
+			Path& path = *batch._paths[lane];
+			path._cumulativeRoulette = batch._cumulativeRoulette[lane];
 
-				Vector3 oldPDF = newPath->_importance;
+			if(reflectMask & (1 << lane))
+			{
+				const Vector3 reflectedDir = getLane(batch._reflected,lane);
 
-				newPath->_importance *= reflectedImportance /reflectionChance;
-				/*
-				if(!( newPath->_importance.x() >= 0.0f && newPath->_importance.y() >= 0.0f && newPath->_importance.z() >= 0.0f) ||
-					!( newPath->_importance.x() < 1000.0f && newPath->_importance.y() < 1000.0f && newPath->_importance.z() < 1000.0f))
-				{
-					char temp[512];
-					sprintf(temp,"oldPDF: %f/%f/%f \n newPDF: %f/%f/%f\n pdfMod: %f/%f/%f chance:%f\n",oldPDF.x(),oldPDF.y(),oldPDF.z(),newPath->_importance.x(),newPath->_importance.y(),newPath->_importance.z(),reflectedImportance.x(),reflectedImportance.y(),reflectedImportance.z(),reflectionChance);
-					MessageBoxA(NULL,temp,"FAIL",MB_OK);
-				}*/
-				
-				if(newPath->_importance[0] > Epsilon || newPath->_importance[1] > Epsilon || newPath->_importance[2] > Epsilon)
+				path._importance = getLane(batch._importance,lane).array();
+				path._reflectedPdf = reflectedPdf[lane];
+				path._parentDir = -reflectedDir;
+				path._origin = path._intersectionAbsolute;
+
+				if(extendMask & (1 << lane))
 				{
-					
-					pathWrite.pushElement(*newPath,threadId);
-					newPath = pathWrite.lastWriteElement(threadId);
+					pathWrite.pushElement(path,threadId);
+					Path* newPath = pathWrite.lastWriteElement(threadId);
 
 					RayType reflectedRay;
 
 					reflectedRay.setOrigin(newPath->_intersectionAbsolute);
 					reflectedRay.setDirection(reflectedDir);
 					reflectedRay.setLength(-1.0f);
+					reflectedRay.setTime(newPath->_time);
 
 					_rayData->pushRay(
 						threadId,
@@ -316,14 +451,14 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 						&newPath->_intersectionRelative,
 						&newPath->_id
 						);
-					return;
+					continue;
 				}
 			}
 
-			if(newPath->_numDirect != 0)
-				pathWrite.pushElement(*newPath,threadId);
+			if(path._numDirect != 0)
+				pathWrite.pushElement(path,threadId);
 			else
-				completePath(*newPath,threadId);
+				completePath(path,threadId);
 		}
 	}
 
@@ -341,156 +476,182 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 	}
 
 
-	inline ColorArray GetReflectedRay(Path& path,size_t threadId,Vector3& reflected)
+	// picks a lobe and a direction from it on every reflecting lane at once, as GetReflectionLobes and
+	// cosineWeightedHemisphere / cosineWeightedLobe do for one path. Only the background lobe's table
+	// lookups run lane by lane. Lanes without a lobe or a direction are left as clear() set them.
+	inline void SampleLobes(ShadingBatch& batch,const Boolean& reflect,size_t count)
 	{
-		
-		static_vector<Estimator,MaxEstimators> estimators;
-		const PrimitiveData& primitive = _primitives[path._id];
-		const MaterialSettings& material = _materials[primitive._material];
-		const Vector3& toViewer = path._parentDir;
-		const Vector3& normal = primitive._normal;
-		Vector3 yTangent = path._parentDir.cross(normal).normalized();
-	
-		if(yTangent.squaredNorm() != 0.0f)
-			yTangent.normalize();
-		else
-		{
-			yTangent = path._parentDir.cross(Vector3(1.0f,0.0f,0.0f));
-			if(yTangent.squaredNorm() != 0.0f)
-				yTangent.normalize();
-			else
-				yTangent = path._parentDir.cross(Vector3(0.0f,1.0f,0.0f)).normalized();
-		}
-		
-		// random values
-		Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,path._threadId);
-		Real random = _sampleData->getSampleValueMisc(path._sample,path._threadId);
-
-		// variables
-		Vector3 xTangent = yTangent.cross(normal).normalized();
-		Vector3 xTangentSpecular;
-		Vector3 xTangentRefracted;
-		Vector3 vSpec;
-		Vector3 vRef;
-		Estimator e;
-
-		Estimator* diffuse = nullptr,*reflect = nullptr,*transparent=nullptr,*background=nullptr;
-		
-		if(material._diffuseReflect > 0.0f)
-		{
-			e._pdf = cosineWeightedHemisphere(uv,xTangent,yTangent,normal,e._v);
-			//e._debug = ColorArray(1.0f,0.0f,0.0f);
-			e._c = material._diffuseReflect;
-			estimators.push_back(e);
-			diffuse = &estimators.back();
-		}		
-		
-		if(material._specularReflect > 0.0f && GetSpecularDirection(toViewer,primitive._normal,vSpec))
-		{		
-			xTangentSpecular = yTangent.cross(vSpec).normalized();
-
-			e._pdf = cosineWeightedLobe(uv,xTangentSpecular,yTangent,vSpec,material._specularPower,e._v);
-			//e._debug = ColorArray(0.0f,1.0f,0.0f);
-			e._c =material._specularReflect;
-			estimators.push_back(e);
-			reflect = &estimators.back();
-		}		
-		if(material._transparency > 0.0f &&GetRefractedDirection(toViewer,primitive._normal,material._indexOfRefraction,vRef))
-		{
-			xTangentRefracted = yTangent.cross(vRef).normalized();
-
-			e._pdf = cosineWeightedLobe(uv,xTangentRefracted,yTangent,vRef,material._refractionPower,e._v);
-			//e._debug = ColorArray(0.0f,0.0f,1.0f);
-			e._c =material._transparency;
-			estimators.push_back(e);
-			transparent = &estimators.back();
-		}
-		
-		if(getBackgroundEmissive() > 0.0f)
+		const Scalar_T zero = Scalar_T::Zero();
+		const Scalar_T one = Scalar_T::One();
+		const Scalar_T invPi(1.0f/(Real)R_PI);
+		const Scalar_T inv2Pi(0.5f/(Real)R_PI);
+
+		const Vector3_T& normal = batch._normal;
+		const Vector3_T& toViewer = batch._toViewer;
+
+		// tangent frame, falling back to the x then the y axis when looking along the normal
+		Vector3_T yTangent = toViewer.cross(normal);
+		Vector3_T yTangentX;
+		Vector3_T yTangentY;
+		yTangentX << zero, toViewer.z(), -toViewer.y();
+		yTangentY << -toViewer.z(), zero, toViewer.x();
+		yTangentX = select(yTangentX.dot(yTangentX) != zero,yTangentX,yTangentY);
+		yTangent = normalized(select(yTangent.dot(yTangent) != zero,yTangent,yTangentX));
+		const Vector3_T xTangent = normalized(yTangent.cross(normal));
+
+		// specular lobe as GetSpecularDirection
+		const Scalar_T cosViewer = toViewer.dot(normal);
+		Vector3_T vSpec;
+		for(int c = 0; c < 3; ++c)
+			vSpec[c] = Scalar_T(2.0f)*cosViewer*normal[c] - toViewer[c];
+		vSpec = normalized(vSpec);
+		const Vector3_T xTangentSpecular = normalized(yTangent.cross(vSpec));
+
+		// refracted lobe as GetRefractedDirection, none on total internal reflection
+		const Boolean front = cosViewer > zero;
+		const Scalar_T eta = Scalar_T::Condition(front,one / batch._indexOfRefraction,batch._indexOfRefraction);
+		const Scalar_T side = Scalar_T::Condition(front,one,-one);
+		const Scalar_T cosTheta1 = cosViewer.Absolute();
+		const Scalar_T cosTheta2sq = one - eta*eta*(one - cosTheta1*cosTheta1);
+		const Scalar_T cosTheta2 = cosTheta2sq.Max(zero).Sqrt();
+		Vector3_T vRef;
+		for(int c = 0; c < 3; ++c)
+			vRef[c] = side*(eta*cosTheta1 - cosTheta2)*normal[c] - eta*toViewer[c];
+		const Vector3_T xTangentRefracted = normalized(yTangent.cross(vRef));
+
+		// chances of the lobes
+		Scalar_T cDiffuse = Scalar_T::Condition(batch._diffuseReflect > zero,batch._diffuseReflect,zero);
+		Scalar_T cSpecular = Scalar_T::Condition(batch._specularReflect > zero,batch._specularReflect,zero);
+		Scalar_T cRefracted = Scalar_T::Condition((batch._transparency > zero) & (cosTheta2sq >= zero),batch._transparency,zero);
+		const bool background = getBackgroundEmissive() > 0.0f;
+		Scalar_T cBackground = background ? one : zero;
+
+		const Scalar_T cSum = cDiffuse + cSpecular + cRefracted + cBackground;
+		const Boolean hasLobes = reflect & (cSum > zero);
+		const Scalar_T cScale = Scalar_T::Condition(hasLobes,one / cSum,zero);
+		cDiffuse *= cScale;
+		cSpecular *= cScale;
+		cRefracted *= cScale;
+		cBackground *= cScale;
+
+		// pick a lobe by subtracting each lobe's chance from random in turn
+		Scalar_T random = batch._random;
+		const Boolean pickDiffuse = random < cDiffuse;
+		random -= cDiffuse;
+		const Boolean pickSpecular = (random < cSpecular).AndNot(pickDiffuse);
+		random -= cSpecular;
+		const Boolean pickRefracted = (random < cRefracted).AndNot(pickDiffuse | pickSpecular);
+		random -= cRefracted;
+		const Boolean pickBackground = (random < cBackground).AndNot(pickDiffuse | pickSpecular | pickRefracted);
+
+		// direction around the picked lobe's axis, cos(theta) = v^(1/(power+1)) or sqrt(v) for diffuse
+		const Scalar_T power = Scalar_T::Condition(pickRefracted,batch._refractionPower,batch._specularPower);
+		const Scalar_T phi = batch._u * Scalar_T(2.0f*(Real)R_PI);
+		const Scalar_T cosPhi = phi.Cos();
+		const Scalar_T sinPhi = phi.Sin();
+		const Scalar_T cosTheta = Scalar_T::Condition(pickDiffuse,batch._v.Sqrt(),batch._v.Pow(one / (power + one)));
+		const Scalar_T sinTheta = (one - cosTheta*cosTheta).Max(zero).Sqrt();
+
+		const Vector3_T axis = select(pickDiffuse,normal,select(pickSpecular,vSpec,vRef));
+		const Vector3_T xAxis = select(pickDiffuse,xTangent,select(pickSpecular,xTangentSpecular,xTangentRefracted));
+
+		Vector3_T reflected;
+		for(int c = 0; c < 3; ++c)
+			reflected[c] = cosPhi*sinTheta*xAxis[c] + sinPhi*sinTheta*yTangent[c] + cosTheta*axis[c];
+
+		// pdf of the picked lobe at the direction as pdfAtCosineWeightedHemisphere / pdfAtCosineWeightedLobe,
+		// the lobe's cos(theta)^power is v / cos(theta)
+		const Scalar_T lobePdf = Scalar_T::Condition(pickDiffuse,cosTheta*invPi,(power + Scalar_T(2.0f))*batch._v*inv2Pi / cosTheta);
+		const Scalar_T lobeChance = Scalar_T::Condition(pickDiffuse,cDiffuse,Scalar_T::Condition(pickSpecular,cSpecular,cRefracted));
+		Scalar_T sampledPdf = Scalar_T::Condition((pickDiffuse | pickSpecular | pickRefracted) & (cosTheta > zero),lobePdf*lobeChance,zero);
+
+		// background lobe, importance sampled from the environment's table
+		if(background)
 		{
-			//fallback
-			e._pdf = getImportanceLookupSpherical(uv,e._v);
-			//e._debug = ColorArray(0.5f,0.5f,.5f);
-			e._c = 1.0f;//getBackgroundEmissive();
-			estimators.push_back(e);
-			background = &estimators.back();
-		} 
-		
-		//calculate weights
-
-		Real cSum= 0.0f;
+			const int backgroundMask = hasLobes.mask();
+			const int pickMask = pickBackground.mask();
 
-		for(auto it = estimators.begin(); it != estimators.end(); ++it)
-		{
-			it->_factor = GetReflectedFactor(material,primitive,it->_v,toViewer);
-			cSum += it->_c;
-		}
-		
-		//normalize weights
-		if(cSum <= 0.0f)
-		{
-			//if something goes wrong use fallback sphere
-			return ColorArray(0.0f,0.0f,0.0f);
-		}
-		else
-			for(auto it = estimators.begin(); it != estimators.end(); ++it)
+			for(size_t lane = 0; lane < count; ++lane)
 			{
-				it->_c /= cSum;
-				it->_pdfSum = 0.0f;
-			}
+				if(!(backgroundMask & (1 << lane)))
+					continue;
 
-		//randomly pick an estimator
-		Estimator* chosenEstimator = 0;
-		for(auto it = estimators.begin(); it != estimators.end(); ++it)
-		{
-			
-			if(random < it->_c)
-			{
-				chosenEstimator = &*it;
-				break;
+				Vector3 dir;
+				if(pickMask & (1 << lane))
+				{
+					sampledPdf[(int)lane] = getImportanceLookupSpherical(Vector2(batch._u[(int)lane],batch._v[(int)lane]),dir)*cBackground[(int)lane];
+					setLane(reflected,lane,dir);
+				}
+				else
+					dir = getLane(reflected,lane);
+
+				batch._backgroundPdf[(int)lane] = getBackgroundPdf(getLane(xTangent,lane),getLane(yTangent,lane),getLane(normal,lane),dir)*cBackground[(int)lane];
 			}
-			else
-				random -= it->_c;
 		}
 
-		if(!chosenEstimator || (chosenEstimator->_pdf == 0.0f))
-			return ColorArray(0.0f,0.0f,0.0f);
-
-		Real heuristicPower= 2.0f;
-
-		// calculate pdf's
-		if(diffuse)
-			chosenEstimator->_pdfSum += powf(pdfAtCosineWeightedHemisphere(xTangent,yTangent,normal,chosenEstimator->_v)*diffuse->_c,heuristicPower);
-		if(reflect)
-			chosenEstimator->_pdfSum += powf(pdfAtCosineWeightedLobe(xTangentSpecular,yTangent,vSpec,material._specularPower,chosenEstimator->_v)*reflect->_c,heuristicPower);
-		if(transparent)
-			chosenEstimator->_pdfSum += powf(pdfAtCosineWeightedLobe(xTangentRefracted,yTangent,vRef,material._refractionPower,chosenEstimator->_v)*transparent->_c,heuristicPower);
-		if(background)
-			chosenEstimator->_pdfSum += powf(getBackgroundPdf(xTangent,yTangent,normal,chosenEstimator->_v)*background->_c,heuristicPower);
-
-		reflected = chosenEstimator->_v;
-
-		chosenEstimator->_weight = powf(chosenEstimator->_c*chosenEstimator->_pdf,heuristicPower);
+		// lanes that sampled nothing keep zeros so they can't carry nans into the weighting
+		const Boolean sampled = hasLobes & (sampledPdf > zero);
+		const Vector3_T none(zero,zero,zero);
+
+		batch._normal = select(sampled,batch._normal,none);
+		batch._toViewer = select(sampled,batch._toViewer,none);
+		batch._reflected = select(sampled,reflected,none);
+		batch._vSpec = select(sampled & (cSpecular > zero),vSpec,none);
+		batch._vRef = select(sampled & (cRefracted > zero),vRef,none);
+		batch._cDiffuse = Scalar_T::Condition(sampled,cDiffuse,zero);
+		batch._cSpecular = Scalar_T::Condition(sampled,cSpecular,zero);
+		batch._cRefracted = Scalar_T::Condition(sampled,cRefracted,zero);
+		batch._backgroundPdf = Scalar_T::Condition(sampled,batch._backgroundPdf,zero);
+		batch._sampledPdf = Scalar_T::Condition(sampled,sampledPdf,zero);
+		batch._specularPower = Scalar_T::Condition(sampled,batch._specularPower,zero);
+		batch._refractionPower = Scalar_T::Condition(sampled,batch._refractionPower,zero);
+		batch._indexOfRefraction = Scalar_T::Condition(sampled,batch._indexOfRefraction,zero);
+		batch._transparency = Scalar_T::Condition(sampled,batch._transparency,zero);
+	}
 
-		//assert(chosenEstimator->_pdfSum >= chosenEstimator->_weight);
+	static inline Vector3_T select(const Boolean& condition,const Vector3_T& trueVal,const Vector3_T& falseVal)
+	{
+		Vector3_T result;
+		for(int c = 0; c < 3; ++c)
+			result[c] = Scalar_T::Condition(condition,trueVal[c],falseVal[c]);
+		return result;
+	}
 
-		chosenEstimator->_weight /= chosenEstimator->_pdfSum;
+	// zero vectors stay zero, as Eigen's normalized()
+	static inline Vector3_T normalized(const Vector3_T& v)
+	{
+		const Scalar_T lengthSq = v.dot(v);
+		const Scalar_T scale = Scalar_T::Condition(lengthSq > Scalar_T::Zero(),Scalar_T::One() / lengthSq.Sqrt(),Scalar_T::Zero());
+		Vector3_T result;
+		for(int c = 0; c < 3; ++c)
+			result[c] = v[c]*scale;
+		return result;
+	}
 
-		ColorArray totalFactor =  chosenEstimator->_factor*chosenEstimator->_weight/ (chosenEstimator->_pdf * chosenEstimator->_c);
+	static inline void setLane(Vector3_T& v,size_t lane,const Vector3& value)
+	{
+		v.x()[(int)lane] = value.x();
+		v.y()[(int)lane] = value.y();
+		v.z()[(int)lane] = value.z();
+	}
 
-		return totalFactor;
+	static inline Vector3 getLane(const Vector3_T& v,size_t lane)
+	{
+		return Vector3(v.x()[(int)lane],v.y()[(int)lane],v.z()[(int)lane]);
 	}
 				
-	
 	inline void GatherPathEmissive(Path& path)
 	{
 		if(path._id != -1)
 		{
 			const PrimitiveData& primitive = _primitives[path._id];
 			const MaterialSettings& material = _materials[primitive._material];
-			
-			// emitted light by the object itself
-			path._accumulatedRadiance += material._color * material._emit * path._importance;
+
+			if(material._emit > 0.0f)
+			{
+				// emitted light by the object itself, weighted against the chance GeneratePathDirectLight finds it
+				path._accumulatedRadiance += material._color * material._emit * path._importance * GetEmissiveWeight(path);
+			}
 
 		}
 		else
@@ -503,48 +664,137 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 
 	inline void GeneratePathDirectLight(Path& path,DirectNodeArray& directNodeWrite)
 	{
-		const PrimitiveData& primitive = _primitives[path._id];
+		const PrimitiveData& primitive = getPrimitiveAt(path._id,path._intersectionAbsolute,path._time);
 		const MaterialSettings& material = _materials[primitive._material];
 
-		// direct lighting (added next step)
+		// direct lighting (added next step), one light picked from the light tree per bounce
 		path._firstDirect = directNodeWrite.size();
-		for(auto il = _lights.begin(); il != _lights.end(); ++il)
-		{
-			Vector3 toLight = (il->_location - path._intersectionAbsolute);
 
-			Real lightDistanceSq = toLight.squaredNorm();
-
-			Real lightArea = lightDistanceSq*4.0f*(Real)R_PI;
-
-			toLight.normalize();
+		if(!_lightTree.empty())
+		{
+			const Real lightRandom = _sampleData->getSampleValueMisc(path._sample,path._threadId);
+			const Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,path._threadId);
 
+			ColorArray lightPDF;
+			Vector3 toLight;
+			Real lightDistance;
 
-			ColorArray lightPDF = GetReflectedFactorPoint(material,primitive,toLight,path._parentDir) * il->_color.array() * path._importance / lightArea;
-			/*
-			assert(lightPDF[0] <= 5.0f);
-			assert(lightPDF[1] <= 5.0f);
-			assert(lightPDF[2] <= 5.0f);
-		*/
-			if(lightPDF[0] >= Epsilon || lightPDF[1] >= Epsilon || lightPDF[2] >= Epsilon)
+			if(SampleSceneLight(path._intersectionAbsolute,material,primitive,path._parentDir,lightRandom,uv,lightPDF,toLight,lightDistance))
 			{
-				directNodeWrite.push_back(DirectNode());
-				DirectNode& direct = directNodeWrite.back();
-				direct._color = lightPDF;
+				lightPDF *= path._importance;
+				/*
+				assert(lightPDF[0] <= 5.0f);
+				assert(lightPDF[1] <= 5.0f);
+				assert(lightPDF[2] <= 5.0f);
+			*/
+				if(lightPDF[0] >= Epsilon || lightPDF[1] >= Epsilon || lightPDF[2] >= Epsilon)
+				{
+					directNodeWrite.push_back(DirectNode());
+					DirectNode& direct = directNodeWrite.back();
+					direct._color = lightPDF;
 
-				RayType ray;
+					RayType ray;
 							
-				ray.setOrigin( path._intersectionAbsolute);
-				ray.setDirection( (il->_location-path._intersectionAbsolute).normalized() );
-				ray.setLength( (il->_location-path._intersectionAbsolute).norm() );
+					ray.setOrigin( path._intersectionAbsolute);
+					ray.setDirection( toLight );
+					ray.setLength( lightDistance );
+					ray.setTime( path._time );
 
-				_rayData->pushRay(path._threadId, ray, &direct._shadow);
+					_rayData->pushRay(path._threadId, ray, &direct._shadow);
+				}
 			}
 		}
 
+		// emissive primitives, one point picked per bounce
+		if(hasEmissivePrimitives())
+			GenerateEmissiveDirectLight(path,material,primitive,directNodeWrite);
+
 		path._numDirect = directNodeWrite.size() - path._firstDirect;
 
 	}
 
+	inline void GenerateEmissiveDirectLight(Path& path,const MaterialSettings& material,const PrimitiveData& primitive,DirectNodeArray& directNodeWrite)
+	{
+		const Real random = _sampleData->getSampleValueMisc(path._sample,path._threadId);
+		const Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,path._threadId);
+
+		int emitterId;
+		Vector3 emitterLocation;
+		Vector3 emitterNormal;
+		const Real areaPdf = sampleEmissive(random,uv,path._time,emitterId,emitterLocation,emitterNormal);
+
+		if(emitterId == path._id || !(areaPdf > 0.0f))
+			return;
+
+		Vector3 toLight = emitterLocation - path._intersectionAbsolute;
+		const Real lightDistanceSq = toLight.squaredNorm();
+		const Real lightDistance = sqrt(lightDistanceSq);
+
+		if(!(lightDistance > 0.0f))
+			return;
+
+		toLight /= lightDistance;
+
+		// emitters shine from both sides, as they do when a path hits them
+		const Real cosLight = fabs(emitterNormal.dot(toLight));
+		if(cosLight <= 0.0f)
+			return;
+
+		const Real lightPdf = areaPdf * lightDistanceSq / cosLight;
+
+		ReflectionLobes lobes;
+		Real reflectedPdf = 0.0f;
+		Real heuristicSum;
+		if(GetReflectionLobes(material,primitive,path._parentDir,lobes))
+			reflectedPdf = GetReflectedPdf(lobes,material,toLight,heuristicSum);
+
+		// power heuristic against the chance SampleLobes picks the same direction
+		const Real weight = lightPdf*lightPdf / (lightPdf*lightPdf + reflectedPdf*reflectedPdf);
+
+		const MaterialSettings& emitter = _materials[_primitives[emitterId]._material];
+
+		ColorArray lightColor = GetReflectedFactor(material,primitive,toLight,path._parentDir) * emitter._color * emitter._emit * path._importance * (weight / lightPdf);
+
+		if(lightColor[0] >= Epsilon || lightColor[1] >= Epsilon || lightColor[2] >= Epsilon)
+		{
+			directNodeWrite.push_back(DirectNode());
+			DirectNode& direct = directNodeWrite.back();
+			direct._color = lightColor;
+
+			RayType ray;
+
+			// stop short of the emitter so it doesn't shadow itself
+			ray.setOrigin( path._intersectionAbsolute);
+			ray.setDirection( toLight );
+			ray.setLength( lightDistance * (1.0f - Epsilon) );
+			ray.setTime( path._time );
+
+			_rayData->pushRay(path._threadId, ray, &direct._shadow);
+		}
+	}
+
+	// power heuristic weight for emission found by the path's last reflected ray,
+	// camera rays and emitters GenerateEmissiveDirectLight never picks keep all of it
+	inline Real GetEmissiveWeight(const Path& path)
+	{
+		if(path._reflectedPdf <= 0.0f || !hasEmissivePrimitives())
+			return 1.0f;
+
+		const PrimitiveData primitive = getPrimitiveAt(path._id,path._intersectionAbsolute,path._time);
+		const Real areaPdf = getEmissivePdf(path._id,primitive);
+
+		if(!(areaPdf > 0.0f))
+			return 1.0f;
+
+		const Real cosLight = fabs(primitive._normal.dot(path._parentDir));
+		if(cosLight <= 0.0f)
+			return 1.0f;
+
+		const Real lightPdf = areaPdf * (path._intersectionAbsolute - path._origin).squaredNorm() / cosLight;
+
+		return path._reflectedPdf*path._reflectedPdf / (path._reflectedPdf*path._reflectedPdf + lightPdf*lightPdf);
+	}
+
 	inline void GatherPathDirectLight(Path& path,const DirectNodeArray& directNodeRead)
 	{
 		if(path._numDirect)
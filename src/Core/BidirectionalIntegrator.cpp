@@ -0,0 +1,18 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "BidirectionalIntegrator.h"
+
+
+namespace Raytrace {
+
+template<class _SampleData,class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateBidirectionalIntegrator()
+{
+	return boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>>(new BidirectionalIntegrator<_SampleData,_RayData,_SceneReader,64>());
+}
+
+template boost::shared_ptr<IIntegrator<DefaultEngine::SampleData,DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateBidirectionalIntegrator();
+
+}
\ No newline at end of file
@@ -0,0 +1,744 @@
+/********************************************************/
+// FILE: BidirectionalIntegrator.h
+// DESCRIPTION: Raytracer Bidirectional Path Tracing Integrator
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_BIDIRECTIONAL_INTEGRATOR_GUARD
+#define RAYTRACE_BIDIRECTIONAL_INTEGRATOR_GUARD
+
+#include <RaytraceCommon.h>
+#include "IntegratorBase.h"
+
+
+namespace Raytrace {
+
+// Every sample traces a camera subpath and a light subpath starting on an emissive primitive side by side,
+// one ray each per iteration. Once both have ended all their vertices are connected with one batch of
+// shadow rays and the next iteration adds up the unoccluded connections, weighted with the power heuristic.
+// The camera is a pinhole nothing can hit, so every light vertex is connected to it directly instead and
+// the light found that way is handed to the sampler as a splat at the image location it passes through.
+template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlock> struct BidirectionalIntegrator : public IntegratorBase<_SampleData,_RayData,_SceneReader>
+{
+	typedef Eigen::Array<Real,3,1> ColorArray;
+
+	typedef _SampleData SampleData;
+	typedef _RayData RayData;
+	typedef _SceneReader SceneReader;
+
+	typedef typename RayData::PrimitiveType PrimitiveType;
+	typedef typename RayData::RayType RayType;
+
+	typedef typename RayData::PrimitiveRelativeIntersection		IntersectionRelative;
+	typedef typename RayData::AbsoluteIntersectionLocation		IntersectionAbsolute;
+
+	typedef typename RayData::PrimitiveUserData					PrimitiveIdentifier;
+
+	static const size_t ChunkSize = 8*1024;
+
+	static const size_t NumPathsPerBlock = _NumPathsPerBlock;
+
+	// per subpath, including the camera and the point on the emitter
+	static const size_t MaxVertices = 6;
+	// subpaths are only ended by russian roulette once they have this many vertices
+	static const size_t MinRouletteVertices = 3;
+
+	struct Vertex
+	{
+		Vector3			_location;
+		Vector3			_normal;
+		ColorArray		_throughput;
+		Real			_pdfForward;	// area density of sampling this vertex from its own subpath
+		Real			_pdfReverse;	// area density of sampling it from the other end of the path
+		int				_id;			// -1 for the camera
+	};
+
+	struct ConnectionNode
+	{
+		up						_shadow;
+		ColorArray				_color;
+		bool					_splat;			// light subpath connected to the eye
+		Vector2					_imageXY;		// where such a connection reaches the image
+	};
+
+	struct Subpath
+	{
+		std::array<Vertex,MaxVertices>			_vertices;
+		size_t									_numVertices;
+		bool									_active;		// a ray is being traced
+
+		// Intersection
+
+		IntersectionRelative					_intersectionRelative;
+		PrimitiveIdentifier						_id;
+		IntersectionAbsolute					_intersectionAbsolute;
+
+		// the ray being traced
+
+		Vector3									_direction;
+		Real									_pdf;			// solid angle pdf the direction was picked with
+		ColorArray								_throughput;	// of the vertex it will find
+	};
+
+	struct Path
+	{
+		typename SampleData::SampleInput		_sample;
+
+		// some info
+
+		size_t									_threadId;
+		size_t									_firstConnection;
+		size_t									_numConnections;
+
+		Subpath									_camera;
+		Subpath									_light;
+
+		// Rendering
+
+		ColorArray								_accumulatedRadiance;
+		Real									_time;
+	};
+
+	typedef chunked_vector<ConnectionNode,ChunkSize> ConnectionNodeArray;
+
+	struct ThreadData
+	{
+		std::array<ConnectionNodeArray,2>	_connectionNodes;
+	};
+
+	typedef SplitUseWorkQueue<Path,NumPathsPerBlock> PathsArrayType;
+
+
+
+	inline BidirectionalIntegrator() : _sampleData(nullptr),_rayData(nullptr),_writePathArray(0),_readPathArray(1)
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const SceneReader& scene,SampleData& sampleData,RayData& rayData)
+	{
+		InitializeSceneData(numThreads,scene);
+
+		_threads.resize(numThreads);
+		_pathArrays[_readPathArray].prepare(numThreads);
+		_pathArrays[_writePathArray].prepare(numThreads);
+
+		Real fov = scene->getFoV();
+		Real aspect = scene->getAspect();
+
+		_camera.Initialize( Vector2(fov*aspect,fov));
+		_sampleData = &sampleData;
+		_rayData = &rayData;
+	}
+	void InitializeMT(size_t threadId)
+	{
+	}
+	void InitializeCompleteST()
+	{
+	}
+
+	void IntegratePrepareST()
+	{
+	}
+
+	void IntegrateMT(size_t threadId)
+	{
+		ThreadData& threadDataWrite = _threads[threadId];
+		ConnectionNodeArray& connectionNodeWrite = threadDataWrite._connectionNodes[_writePathArray];
+
+		typename SampleData::SampleInput newSample;
+
+		connectionNodeWrite.clear();
+
+		// process new samples
+
+		while(_sampleData->popGeneratedSample(threadId,newSample))
+		{
+			PathsArrayType& pathWrite = _pathArrays[_writePathArray];
+
+			newSample._imageXY = _sampleData->getSampleValueImageXY(newSample,threadId);
+			RayType cameraRay = _camera( newSample._imageXY );
+			cameraRay.setTime( _sampleData->getSampleValueTimeT(newSample,threadId));
+
+			pathWrite.pushElement(Path(),threadId);
+			Path* path = pathWrite.lastWriteElement(threadId);
+
+			path->_sample = newSample;
+			path->_threadId = threadId;
+			path->_firstConnection = 0;
+			path->_numConnections = 0;
+			path->_accumulatedRadiance = ColorArray(0.0f,0.0f,0.0f);
+			path->_time = cameraRay.time();
+
+			// the camera subpath starts at the eye
+			Vertex& eye = path->_camera._vertices[0];
+			eye._location = cameraRay.origin();
+			eye._normal = cameraRay.direction();
+			eye._throughput = ColorArray(1.0f,1.0f,1.0f);
+			eye._pdfForward = 1.0f;
+			eye._pdfReverse = 0.0f;
+			eye._id = -1;
+
+			path->_camera._numVertices = 1;
+			path->_camera._direction = cameraRay.direction();
+			path->_camera._pdf = _camera.Pdf(newSample._imageXY);
+			path->_camera._throughput = ColorArray(1.0f,1.0f,1.0f);
+			path->_camera._active = true;
+
+			TraceSubpath(*path,path->_camera,threadId);
+
+			if(StartLightSubpath(*path,threadId))
+				TraceSubpath(*path,path->_light,threadId);
+		}
+
+
+		PathsArrayType& pathRead = _pathArrays[_readPathArray];
+
+		// process active samples
+
+		// go to first element
+		pathRead.advanceElement(threadId);
+
+		Path* currPath;
+
+		while(currPath = pathRead.currElement(threadId))
+		{
+			processPath(*currPath,threadId);
+
+			pathRead.advanceElement(threadId);
+		}
+	}
+	bool IntegrateCompleteST()
+	{
+		_pathArrays[_readPathArray].clear();
+		_pathArrays[_writePathArray].reset();
+
+		size_t temp = _writePathArray;
+		_writePathArray = _readPathArray;
+		_readPathArray = temp;
+
+		return true;
+	}
+
+	inline void processPath(Path& path,size_t threadId)
+	{
+		PathsArrayType& pathWrite = _pathArrays[_writePathArray];
+
+		// both subpaths ended last iteration, the connections have been traced
+		if(!path._camera._active && !path._light._active)
+		{
+			GatherConnections(path,_threads[path._threadId]._connectionNodes[_readPathArray],threadId);
+			completePath(path,threadId);
+			return;
+		}
+
+		if(path._camera._active)
+			ExtendSubpath(path,path._camera,true,threadId);
+		if(path._light._active)
+			ExtendSubpath(path,path._light,false,threadId);
+
+		if(path._camera._active || path._light._active)
+		{
+			pathWrite.pushElement(path,threadId);
+			Path* newPath = pathWrite.lastWriteElement(threadId);
+
+			if(newPath->_camera._active)
+				TraceSubpath(*newPath,newPath->_camera,threadId);
+			if(newPath->_light._active)
+				TraceSubpath(*newPath,newPath->_light,threadId);
+			return;
+		}
+
+		path._threadId = threadId;
+		GenerateConnections(path,_threads[threadId]._connectionNodes[_writePathArray],threadId);
+
+		if(path._numConnections != 0)
+			pathWrite.pushElement(path,threadId);
+		else
+			completePath(path,threadId);
+	}
+
+	inline void completePath(const Path& path,size_t threadId)
+	{
+		Vector4 result;
+		result.head<3>() = path._accumulatedRadiance;
+
+		if(path._camera._numVertices > 1)
+			result.w() = 1.0f;
+		else
+			result.w() = 0.0f;
+
+		_sampleData->pushCompletedSample( threadId, typename SampleData::SampleOutput( path._sample, result) );
+	}
+
+	inline void TraceSubpath(Path& path,Subpath& subpath,size_t threadId)
+	{
+		RayType ray;
+
+		ray.setOrigin(subpath._vertices[subpath._numVertices - 1]._location);
+		ray.setDirection(subpath._direction);
+		ray.setLength(-1.0f);
+		ray.setTime(path._time);
+
+		_rayData->pushRay(
+			threadId,
+			ray,
+			&subpath._intersectionAbsolute,
+			nullptr,
+			&subpath._intersectionRelative,
+			&subpath._id
+			);
+	}
+
+	// picks a point on an emitter and a direction leaving it, fails without emitters
+	inline bool StartLightSubpath(Path& path,size_t threadId)
+	{
+		Subpath& subpath = path._light;
+		subpath._numVertices = 0;
+		subpath._active = false;
+
+		if(!hasEmissivePrimitives())
+			return false;
+
+		const Real random = _sampleData->getSampleValueMisc(path._sample,threadId);
+		const Vector2 uvLocation = _sampleData->getSampleValueMisc2D(path._sample,threadId);
+		const Vector2 uvDirection = _sampleData->getSampleValueMisc2D(path._sample,threadId);
+		const Real side = _sampleData->getSampleValueMisc(path._sample,threadId);
+
+		int id;
+		Vector3 location,normal;
+		const Real areaPdf = sampleEmissive(random,uvLocation,path._time,id,location,normal);
+
+		if(!(areaPdf > 0.0f))
+			return false;
+
+		const MaterialSettings& material = _materials[_primitives[id]._material];
+
+		Vertex& vertex = subpath._vertices[0];
+		vertex._location = location;
+		vertex._normal = normal;
+		vertex._throughput = material._color * material._emit / areaPdf;
+		vertex._pdfForward = areaPdf;
+		vertex._pdfReverse = 0.0f;
+		vertex._id = id;
+		subpath._numVertices = 1;
+
+		// emitters shine from both sides, pick one then a cosine weighted direction
+		Vector3 xTangent,yTangent;
+		const Vector3 zTangent = (side < 0.5f) ? normal : Vector3(-normal);
+		GetTangents(zTangent,xTangent,yTangent);
+
+		const Real pdf = cosineWeightedHemisphere(uvDirection,xTangent,yTangent,zTangent,subpath._direction) * 0.5f;
+
+		if(!(pdf > 0.0f))
+			return false;
+
+		subpath._pdf = pdf;
+		subpath._throughput = vertex._throughput * fabs(normal.dot(subpath._direction)) / pdf;
+		subpath._active = true;
+		return true;
+	}
+
+	// adds the vertex the subpath's ray found and picks the next direction
+	inline void ExtendSubpath(Path& path,Subpath& subpath,bool camera,size_t threadId)
+	{
+		subpath._active = false;
+
+		if(subpath._id == -1)
+		{
+			// left scene, emissive = environment, nothing else finds it
+			if(camera)
+				path._accumulatedRadiance += subpath._throughput * getBackgroundColor(subpath._direction);
+			return;
+		}
+
+		const PrimitiveData& primitive = getPrimitiveAt(subpath._id,subpath._intersectionAbsolute,path._time);
+		const MaterialSettings& material = _materials[primitive._material];
+
+		Vertex& previous = subpath._vertices[subpath._numVertices - 1];
+		Vertex& vertex = subpath._vertices[subpath._numVertices];
+
+		const Vector3 toPrevious = -subpath._direction;
+		const Real distanceSq = (previous._location - subpath._intersectionAbsolute).squaredNorm();
+
+		vertex._location = subpath._intersectionAbsolute;
+		vertex._normal = primitive._normal;
+		vertex._throughput = subpath._throughput;
+		vertex._pdfForward = AreaPdf(subpath._pdf,vertex._normal,toPrevious,distanceSq);
+		vertex._pdfReverse = 0.0f;
+		vertex._id = subpath._id;
+		++subpath._numVertices;
+
+		// the camera subpath found an emitter
+		if(camera && material._emit > 0.0f)
+		{
+			const Real emitterPdf = getEmissivePdf(vertex._id,primitive);
+			const Real emitterPdfPrevious = AreaPdf(EmissionPdf(vertex,toPrevious),previous._normal,subpath._direction,distanceSq);
+			const Real weight = StrategyWeight(path,0,subpath._numVertices,emitterPdf,emitterPdfPrevious,0.0f,0.0f);
+
+			path._accumulatedRadiance += vertex._throughput * material._color * material._emit * weight;
+		}
+
+		if(subpath._numVertices >= MaxVertices)
+			return;
+
+		// random values
+		const Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,threadId);
+		const Real random = _sampleData->getSampleValueMisc(path._sample,threadId);
+		const Real roulette = _sampleData->getSampleValueMisc(path._sample,threadId);
+
+		ReflectionLobes lobes;
+		if(!GetReflectionLobes(material,primitive,toPrevious,lobes,camera))
+			return;
+
+		Vector3 direction;
+		const Real pdf = SampleReflectionLobes(lobes,material,uv,random,direction);
+
+		if(!(pdf > 0.0f))
+			return;
+
+		// light flows from the light subpath's previous vertex, toward the camera subpath's previous vertex
+		ColorArray factor = camera ?
+			GetReflectedFactor(material,primitive,direction,toPrevious) :
+			ColorArray(Scatter(material,primitive,toPrevious,direction) * fabs(primitive._normal.dot(direction)));
+		factor /= pdf;
+
+		if(subpath._numVertices >= MinRouletteVertices)
+		{
+			const ColorArray albedo = Albedo(material,primitive,toPrevious);
+			const Real continueChance = std::min<Real>(0.9f,albedo.maxCoeff());
+
+			if(roulette >= continueChance)
+				return;
+
+			factor /= continueChance;
+		}
+
+		subpath._throughput = vertex._throughput * factor;
+
+		if(!(subpath._throughput.maxCoeff() > 0.0f))
+			return;
+
+		// density of the other end of the path arriving at the previous vertex through this one
+		if(previous._id != -1)
+		{
+			ReflectionLobes reverseLobes;
+			Real heuristicSum;
+			Real reversePdf = 0.0f;
+
+			if(GetReflectionLobes(material,primitive,direction,reverseLobes,!camera))
+				reversePdf = GetReflectedPdf(reverseLobes,material,toPrevious,heuristicSum);
+
+			previous._pdfReverse = AreaPdf(reversePdf,previous._normal,subpath._direction,distanceSq);
+		}
+
+		subpath._direction = direction;
+		subpath._pdf = pdf;
+		subpath._active = true;
+	}
+
+	// connects every camera vertex after the eye with every light vertex, and with one of the scene's lights,
+	// then every light vertex with the eye
+	inline void GenerateConnections(Path& path,ConnectionNodeArray& connectionNodeWrite,size_t threadId)
+	{
+		path._firstConnection = connectionNodeWrite.size();
+
+		const Subpath& cameraPath = path._camera;
+		const Subpath& lightPath = path._light;
+		const Vertex& eye = cameraPath._vertices[0];
+
+		for(size_t s = 1; s <= lightPath._numVertices; ++s)
+		{
+			const Vertex& y = lightPath._vertices[s-1];
+
+			Vector3 toEye = eye._location - y._location;
+			const Real distanceSq = toEye.squaredNorm();
+			const Real distance = sqrt(distanceSq);
+
+			if(!(distance > 0.0f))
+				continue;
+
+			toEye /= distance;
+
+			Vector2 imageXY;
+			Real cameraPdf;
+
+			if(!_camera.Project(-toEye,imageXY,cameraPdf))
+				continue;
+
+			const PrimitiveData primitiveY = VertexPrimitive(y);
+			const MaterialSettings& materialY = _materials[primitiveY._material];
+
+			// the camera's importance is the density of its rays
+			ColorArray contribution = y._throughput * (cameraPdf * fabs(y._normal.dot(toEye)) / distanceSq);
+
+			Vector3 toYPrevious;
+			Real distanceSqYPrevious = 0.0f;
+
+			if(s >= 2)
+			{
+				const Vertex& yPrevious = lightPath._vertices[s-2];
+				toYPrevious = (yPrevious._location - y._location).normalized();
+				distanceSqYPrevious = (yPrevious._location - y._location).squaredNorm();
+				contribution *= Scatter(materialY,primitiveY,toYPrevious,toEye);
+			}
+
+			if(!(contribution.maxCoeff() > 0.0f))
+				continue;
+
+			ReflectionLobes lobes;
+			Real heuristicSum;
+			Real lightReversePrevious = 0.0f;
+
+			const Real lightReverse = AreaPdf(cameraPdf,y._normal,toEye,distanceSq);
+
+			if(s >= 2 && GetReflectionLobes(materialY,primitiveY,toEye,lobes,true))
+				lightReversePrevious = AreaPdf(GetReflectedPdf(lobes,materialY,toYPrevious,heuristicSum),lightPath._vertices[s-2]._normal,toYPrevious,distanceSqYPrevious);
+
+			const Real weight = StrategyWeight(path,s,1,0.0f,0.0f,lightReverse,lightReversePrevious);
+
+			ConnectionNode* connection = PushConnection(path,eye._location,-toEye,distance * (1.0f - Epsilon),contribution * weight,connectionNodeWrite,threadId);
+			if(connection)
+			{
+				connection->_splat = true;
+				connection->_imageXY = imageXY;
+			}
+		}
+
+		for(size_t t = 2; t <= cameraPath._numVertices; ++t)
+		{
+			const Vertex& z = cameraPath._vertices[t-1];
+			const Vertex& zPrevious = cameraPath._vertices[t-2];
+
+			const PrimitiveData primitiveZ = VertexPrimitive(z);
+			const MaterialSettings& materialZ = _materials[primitiveZ._material];
+
+			const Vector3 toZPrevious = (zPrevious._location - z._location).normalized();
+			const Real distanceSqZPrevious = (zPrevious._location - z._location).squaredNorm();
+
+			// point and area lights can't be hit, this is the only way they are found
+			if(!_lightTree.empty())
+			{
+				const Real lightRandom = _sampleData->getSampleValueMisc(path._sample,threadId);
+				const Vector2 uv = _sampleData->getSampleValueMisc2D(path._sample,threadId);
+
+				ColorArray color;
+				Vector3 toLight;
+				Real lightDistance;
+
+				if(SampleSceneLight(z._location,materialZ,primitiveZ,toZPrevious,lightRandom,uv,color,toLight,lightDistance))
+					PushConnection(path,z._location,toLight,lightDistance,color * z._throughput,connectionNodeWrite,threadId);
+			}
+
+			for(size_t s = 1; s <= lightPath._numVertices; ++s)
+			{
+				const Vertex& y = lightPath._vertices[s-1];
+
+				if(y._id == z._id)
+					continue;
+
+				Vector3 toY = y._location - z._location;
+				const Real distanceSq = toY.squaredNorm();
+				const Real distance = sqrt(distanceSq);
+
+				if(!(distance > 0.0f))
+					continue;
+
+				toY /= distance;
+
+				const PrimitiveData primitiveY = VertexPrimitive(y);
+				const MaterialSettings& materialY = _materials[primitiveY._material];
+
+				const Real cosY = fabs(y._normal.dot(toY));
+
+				ColorArray contribution = z._throughput * GetReflectedFactor(materialZ,primitiveZ,toY,toZPrevious) * y._throughput * (cosY / distanceSq);
+
+				Vector3 toYPrevious;
+				Real distanceSqYPrevious = 0.0f;
+
+				if(s >= 2)
+				{
+					const Vertex& yPrevious = lightPath._vertices[s-2];
+					toYPrevious = (yPrevious._location - y._location).normalized();
+					distanceSqYPrevious = (yPrevious._location - y._location).squaredNorm();
+					contribution *= Scatter(materialY,primitiveY,toYPrevious,-toY);
+				}
+
+				if(!(contribution.maxCoeff() > 0.0f))
+					continue;
+
+				// densities of the connected vertices and their predecessors when sampled from the other end
+				ReflectionLobes lobes;
+				Real heuristicSum;
+				Real cameraReverse = 0.0f,cameraReversePrevious = 0.0f,lightReverse = 0.0f,lightReversePrevious = 0.0f;
+
+				if(s == 1)
+					cameraReverse = AreaPdf(EmissionPdf(y,-toY),z._normal,toY,distanceSq);
+				else if(GetReflectionLobes(materialY,primitiveY,toYPrevious,lobes,false))
+					cameraReverse = AreaPdf(GetReflectedPdf(lobes,materialY,-toY,heuristicSum),z._normal,toY,distanceSq);
+
+				if(GetReflectionLobes(materialZ,primitiveZ,toY,lobes,false))
+					cameraReversePrevious = AreaPdf(GetReflectedPdf(lobes,materialZ,toZPrevious,heuristicSum),zPrevious._normal,toZPrevious,distanceSqZPrevious);
+
+				if(GetReflectionLobes(materialZ,primitiveZ,toZPrevious,lobes,true))
+					lightReverse = AreaPdf(GetReflectedPdf(lobes,materialZ,toY,heuristicSum),y._normal,toY,distanceSq);
+
+				if(s >= 2 && GetReflectionLobes(materialY,primitiveY,-toY,lobes,true))
+					lightReversePrevious = AreaPdf(GetReflectedPdf(lobes,materialY,toYPrevious,heuristicSum),lightPath._vertices[s-2]._normal,toYPrevious,distanceSqYPrevious);
+
+				const Real weight = StrategyWeight(path,s,t,cameraReverse,cameraReversePrevious,lightReverse,lightReversePrevious);
+
+				// stop short of the light vertex so its own surface doesn't block it
+				PushConnection(path,z._location,toY,distance * (1.0f - Epsilon),contribution * weight,connectionNodeWrite,threadId);
+			}
+		}
+
+		path._numConnections = connectionNodeWrite.size() - path._firstConnection;
+	}
+
+	inline ConnectionNode* PushConnection(const Path& path,const Vector3& origin,const Vector3& direction,Real length,const ColorArray& color,ConnectionNodeArray& connectionNodeWrite,size_t threadId)
+	{
+		if(!(color.maxCoeff() > 0.0f))
+			return nullptr;
+
+		connectionNodeWrite.push_back(ConnectionNode());
+		ConnectionNode& connection = connectionNodeWrite.back();
+		connection._color = color;
+		connection._splat = false;
+
+		RayType ray;
+
+		ray.setOrigin( origin );
+		ray.setDirection( direction );
+		ray.setLength( length );
+		ray.setTime( path._time );
+
+		_rayData->pushRay(threadId, ray, &connection._shadow);
+		return &connection;
+	}
+
+	// connections to the eye become samples of their own, they belong to the pixel they reach
+	inline void GatherConnections(Path& path,const ConnectionNodeArray& connectionNodeRead,size_t threadId)
+	{
+		size_t end = path._firstConnection + path._numConnections;
+
+		for(size_t i = path._firstConnection; i < end; ++i)
+		{
+			const ConnectionNode& connection = connectionNodeRead[i];
+
+			if(connection._shadow)
+				continue;
+
+			if(connection._splat)
+			{
+				Vector4 result;
+				result.head<3>() = connection._color;
+				result.w() = 0.0f;
+
+				_sampleData->pushCompletedSample( threadId, typename SampleData::SampleOutput( path._sample, connection._imageXY, result) );
+			}
+			else
+				path._accumulatedRadiance += connection._color;
+		}
+	}
+
+	// Power heuristic for the path made of the first t camera and the first s light vertices, each
+	// other strategy differs from this one by which end sampled some of the vertices. Forward densities
+	// are stored with the vertices, the reverse densities of the connected vertices and their
+	// predecessors depend on the connection and are passed in. Strategies that need a subpath longer
+	// than MaxVertices can't produce the path and are left out.
+	inline Real StrategyWeight(const Path& path,size_t s,size_t t,Real cameraReverse,Real cameraReversePrevious,Real lightReverse,Real lightReversePrevious) const
+	{
+		Real sum = 0.0f;
+		Real ratio = 1.0f;
+
+		// fewer camera vertices, down to the light subpath connected to the eye
+		for(int i = (int)t - 1; i >= 1 && s + t - i <= MaxVertices; --i)
+		{
+			const Vertex& vertex = path._camera._vertices[i];
+			if(!(vertex._pdfForward > 0.0f))
+				break;
+
+			const Real reverse = (i == (int)t - 1) ? cameraReverse : ((i == (int)t - 2) ? cameraReversePrevious : vertex._pdfReverse);
+
+			ratio *= reverse / vertex._pdfForward;
+			sum += ratio*ratio;
+		}
+
+		// fewer light vertices, down to the camera subpath finding the emitter by itself
+		ratio = 1.0f;
+		for(int i = (int)s - 1; i >= 0 && s + t - i <= MaxVertices; --i)
+		{
+			const Vertex& vertex = path._light._vertices[i];
+			if(!(vertex._pdfForward > 0.0f))
+				break;
+
+			const Real reverse = (i == (int)s - 1) ? lightReverse : ((i == (int)s - 2) ? lightReversePrevious : vertex._pdfReverse);
+
+			ratio *= reverse / vertex._pdfForward;
+			sum += ratio*ratio;
+		}
+
+		return 1.0f / (1.0f + sum);
+	}
+
+	// f(toLight,toViewer) without the cosine GetReflectedFactor includes
+	inline ColorArray Scatter(const MaterialSettings& material,const PrimitiveData& primitive,const Vector3& toLight,const Vector3& toViewer)
+	{
+		const Real cosLight = fabs(primitive._normal.dot(toLight));
+
+		if(cosLight <= Epsilon)
+			return ColorArray(0.0f,0.0f,0.0f);
+
+		return GetReflectedFactor(material,primitive,toLight,toViewer) / cosLight;
+	}
+
+	inline PrimitiveData VertexPrimitive(const Vertex& vertex) const
+	{
+		PrimitiveData primitive = _primitives[vertex._id];
+		primitive._normal = vertex._normal;
+		return primitive;
+	}
+
+	// solid angle pdf of an emitter sending light along direction, both sides cosine weighted
+	static inline Real EmissionPdf(const Vertex& vertex,const Vector3& direction)
+	{
+		return fabs(vertex._normal.dot(direction)) / (2.0f * R_PI);
+	}
+
+	// converts a solid angle pdf to a density over the area at a vertex with normal, seen along direction
+	static inline Real AreaPdf(Real pdf,const Vector3& normal,const Vector3& direction,Real distanceSq)
+	{
+		return (distanceSq > 0.0f) ? pdf * fabs(normal.dot(direction)) / distanceSq : 0.0f;
+	}
+
+	static inline void GetTangents(const Vector3& normal,Vector3& xTangent,Vector3& yTangent)
+	{
+		xTangent = normal.cross( (fabs(normal.x()) < 0.9f) ? Vector3(1.0f,0.0f,0.0f) : Vector3(0.0f,1.0f,0.0f) ).normalized();
+		yTangent = normal.cross(xTangent);
+	}
+
+
+	SampleData*						_sampleData;
+	RayData*						_rayData;
+	FisheyeCamera<RayType>			_camera;
+	std::vector<ThreadData>			_threads;
+	std::array<PathsArrayType,2>	_pathArrays;
+	size_t							_readPathArray;
+	size_t							_writePathArray;
+
+};
+
+}
+#endif
@@ -0,0 +1,17 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "BlueNoiseSampler.h"
+
+namespace Raytrace {
+
+template<class _SampleData,class _SceneReader> 
+typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateBlueNoiseSampler()
+{
+	return boost::shared_ptr<ISampler<_SampleData,_SceneReader>>(new BlueNoiseSampler<_SampleData,_SceneReader>());
+}
+
+template boost::shared_ptr<ISampler<DefaultEngine::SampleData,DefaultEngine::SceneReader>>	CreateBlueNoiseSampler();
+
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+/********************************************************/
+// FILE: BlueNoiseSampler.h
+// DESCRIPTION: Sampler jittering pixels with precomputed blue noise tiles
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_BLUE_NOISE_SAMPLER_GUARD
+#define RAYTRACE_BLUE_NOISE_SAMPLER_GUARD
+
+#include <RaytraceCommon.h>
+#include "SamplerBase.h"
+#include "CounterRandom.h"
+#include "CacheFile.h"
+#include <fstream>
+#include <sstream>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+namespace Raytrace {
+
+// A stack of toroidal tiles holding one jitter per pixel. Within a layer the jittered
+// positions form a Poisson disc like pattern across pixels: cells are visited in random
+// order and each keeps the best of a few candidates, the one farthest from the points
+// already placed around it (wrapping at the tile border).
+// Layers are independent and generated in parallel from a seeded counter based generator,
+// so the result doesn't depend on the thread count and can be cached on disk.
+struct BlueNoiseTiles
+{
+	static const u32 Magic = 0x4e554c42; // "BLUN"
+	static const u32 Version = 1;
+
+	static const size_t Candidates = 16;
+	static const int NeighbourCells = 2;
+
+	inline BlueNoiseTiles() : _tileSize(0), _numLayers(0), _seed(0)
+	{
+	}
+
+	inline size_t tileSize() const
+	{
+		return _tileSize;
+	}
+
+	inline size_t numLayers() const
+	{
+		return _numLayers;
+	}
+
+	// jitter within the pixel, coordinates wrap around the tile
+	inline const Vector2& operator()(size_t layer,size_t x,size_t y) const
+	{
+		return _points[(layer*_tileSize + y % _tileSize)*_tileSize + x % _tileSize];
+	}
+
+	void generate(size_t tileSize,size_t numLayers,u32 seed,size_t numThreads)
+	{
+		_tileSize = tileSize;
+		_numLayers = numLayers;
+		_seed = seed;
+		_points.resize(_tileSize*_tileSize*_numLayers);
+
+		const size_t numWorkers = std::max<size_t>(1,std::min<size_t>(numThreads,_numLayers));
+
+		boost::thread_group workers;
+		for(size_t w = 1; w < numWorkers; ++w)
+			workers.create_thread(boost::bind(&BlueNoiseTiles::generateLayers,this,w,numWorkers));
+		generateLayers(0,numWorkers);
+		workers.join_all();
+	}
+
+	static inline String getPath(const String& directory,size_t tileSize,size_t numLayers,u32 seed)
+	{
+		std::ostringstream stream;
+		stream << directory;
+		if(!directory.empty() && directory[directory.size()-1] != '/' && directory[directory.size()-1] != '\\')
+			stream << '/';
+		stream << "bluenoise_" << tileSize << "x" << tileSize << "x" << numLayers << "_" << seed << ".tiles";
+		return stream.str();
+	}
+
+	bool load(const String& path,size_t tileSize,size_t numLayers,u32 seed)
+	{
+		std::ifstream file(path.c_str(),std::ios::binary);
+		if(!file)
+			return false;
+
+		Header header;
+		if(!file.read((char*)&header,sizeof(Header)))
+			return false;
+		if(header._magic != Magic || header._version != Version || header._tileSize != tileSize || header._numLayers != numLayers || header._seed != seed)
+			return false;
+
+		std::vector<Vector2> points(tileSize*tileSize*numLayers);
+		if(!file.read((char*)&points[0],points.size()*sizeof(Vector2)))
+			return false;
+
+		_tileSize = tileSize;
+		_numLayers = numLayers;
+		_seed = seed;
+		_points.swap(points);
+		return true;
+	}
+
+	// other renders may be loading path right now, so it is only ever replaced by a complete file
+	bool save(const String& path) const
+	{
+		const String temporary = CacheFile::getTemporaryPath(path);
+
+		{
+			std::ofstream file(temporary.c_str(),std::ios::binary | std::ios::trunc);
+			if(!file)
+				return false;
+
+			Header header;
+			header._magic = Magic;
+			header._version = Version;
+			header._tileSize = (u32)_tileSize;
+			header._numLayers = (u32)_numLayers;
+			header._seed = _seed;
+
+			file.write((const char*)&header,sizeof(Header));
+			file.write((const char*)&_points[0],_points.size()*sizeof(Vector2));
+
+			file.close();
+			if(file.fail())
+			{
+				std::remove(temporary.c_str());
+				return false;
+			}
+		}
+
+		return CacheFile::replace(temporary,path);
+	}
+
+private:
+
+	struct Header
+	{
+		u32		_magic;
+		u32		_version;
+		u32		_tileSize;
+		u32		_numLayers;
+		u32		_seed;
+	};
+
+	void generateLayers(size_t first,size_t stride)
+	{
+		for(size_t layer = first; layer < _numLayers; layer += stride)
+			generateLayer(layer);
+	}
+
+	void generateLayer(size_t layer)
+	{
+		const CounterRandom random(_seed);
+		const int size = (int)_tileSize;
+		u32 draw = 0;
+
+		std::vector<u32> order(_tileSize*_tileSize);
+		std::vector<u8> placed(order.size(),0);
+		Vector2* points = &_points[layer*_tileSize*_tileSize];
+
+		for(size_t i = 0; i < order.size(); ++i)
+			order[i] = (u32)i;
+
+		for(size_t i = order.size() - 1; i > 0; --i)
+		{
+			const size_t j = (size_t)(random.Uniform(layer,draw++) * (Real)(i + 1)) % (i + 1);
+			std::swap(order[i],order[j]);
+		}
+
+		for(auto it = order.begin(); it != order.end(); ++it)
+		{
+			const int cx = (int)(*it % _tileSize);
+			const int cy = (int)(*it / _tileSize);
+
+			Vector2 best(0.5f,0.5f);
+			Real bestDistance = -1.0f;
+
+			for(size_t c = 0; c < Candidates; c += 2)
+			{
+				const Vector4 values = random.Uniform4(layer,draw++,CounterRandom::Domain2D);
+
+				for(size_t k = 0; k < 2; ++k)
+				{
+					const Vector2 candidate(values[2*k+0],values[2*k+1]);
+					Real distance = std::numeric_limits<Real>::max();
+
+					for(int dy = -NeighbourCells; dy <= NeighbourCells; ++dy)
+						for(int dx = -NeighbourCells; dx <= NeighbourCells; ++dx)
+						{
+							const size_t neighbour = (size_t)(((cy + dy + size) % size)*size + (cx + dx + size) % size);
+							if(!placed[neighbour])
+								continue;
+							const Vector2 offset = Vector2((Real)dx,(Real)dy) + points[neighbour] - candidate;
+							distance = std::min<Real>(distance,offset.squaredNorm());
+						}
+
+					if(distance > bestDistance)
+					{
+						bestDistance = distance;
+						best = candidate;
+					}
+				}
+			}
+
+			points[*it] = best;
+			placed[*it] = 1;
+		}
+	}
+
+	size_t					_tileSize;
+	size_t					_numLayers;
+	u32						_seed;
+	std::vector<Vector2>	_points;
+};
+
+// Pass m of the image uses layer m % NumLayers, further passes shift the tiles
+// by a random toroidal offset so pixels meet different points.
+template<class _SampleData,class _SceneReader> struct BlueNoiseSampler : public SamplerBase<_SampleData,_SceneReader>
+{
+	typedef _SampleData SampleData;
+	typedef _SceneReader SceneReader;
+
+	typedef SamplerBase<_SampleData,_SceneReader> Base;
+
+	static const size_t TileSize = 64;
+	static const size_t NumLayers = 16;
+	static const u32 Seed = 0x2545F491;
+
+	inline BlueNoiseSampler()
+	{
+	}
+
+	inline ~BlueNoiseSampler()
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const _SceneReader& scene,_SampleData& sampleData)
+	{
+		Base::InitializeSampler(numThreads,scene,sampleData,scene->getMultisampleCount());
+
+		Base::_sampleData->setSampleGenerator(this);
+
+		const String directory = scene->getCacheDirectory();
+		const String path = BlueNoiseTiles::getPath(directory,TileSize,NumLayers,Seed);
+
+		if(directory.empty() || !_tiles.load(path,TileSize,NumLayers,Seed))
+		{
+			_tiles.generate(TileSize,NumLayers,Seed,numThreads);
+			if(!directory.empty())
+				_tiles.save(path);
+		}
+	}
+
+	typename SampleData::SampleValue2DType getSampleLocation2D(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
+	{
+		if(random_index == SampleData::SampleIndex2DImageXY)
+		{
+			const up pass = sample._index / (up)Base::_finalImage.size();
+			const size_t imageIndex = (size_t)(sample._index % (up)Base::_finalImage.size());
+
+			const size_t x = imageIndex % Base::_imageSize.x();
+			const size_t y = imageIndex / Base::_imageSize.x();
+
+			const up cycle = pass / NumLayers;
+			size_t shiftX = 0;
+			size_t shiftY = 0;
+			if(cycle)
+			{
+				const Philox4x32::Counter shift = _random.Bits(cycle,0,CounterRandom::Domain2D);
+				shiftX = shift[0] % TileSize;
+				shiftY = shift[1] % TileSize;
+			}
+
+			const Vector2& jitter = _tiles((size_t)(pass % NumLayers),x + shiftX,y + shiftY);
+
+			Vector2 current ( (float)x * (float)Base::_pixelSize.x(), (float)y * (float)Base::_pixelSize.y());
+			return current + (jitter.array() * Base::_pixelSize.array()).matrix();
+		}
+		else
+		{
+			return _random.Uniform2D(sample._index,(u32)random_index);
+		}
+	}
+
+	typename SampleData::SampleValueType getSampleLocation(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
+	{
+		return _random.Uniform(sample._index,(u32)random_index);
+	}
+
+	BlueNoiseTiles					_tiles;
+	CounterRandom					_random;
+};
+
+}
+#endif
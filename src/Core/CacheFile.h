@@ -0,0 +1,82 @@
+/********************************************************/
+// FILE: CacheFile.h
+// DESCRIPTION: Replacing shared cache files without readers seeing partial writes
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_CACHE_FILE_GUARD
+#define RAYTRACE_CACHE_FILE_GUARD
+
+#include <RaytraceCommon.h>
+#include <cstdio>
+#include <sstream>
+#include <iomanip>
+#include <boost/thread.hpp>
+
+#if defined(COMPILER_MSVC)
+#include <Windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Raytrace {
+
+	// Cache directories are shared by every render on a farm. A file is written under a name unique to
+	// this process and thread next to its final path, then renamed over it, so a reader either finds the
+	// old file, the complete new one or none at all.
+	struct CacheFile
+	{
+		// the key as 16 hex digits plus extension inside directory
+		static inline String getPath(const String& directory,u64 key,const char* extension)
+		{
+			std::ostringstream stream;
+			stream << directory;
+			if(!directory.empty() && directory[directory.size()-1] != '/' && directory[directory.size()-1] != '\\')
+				stream << '/';
+			stream << std::hex << std::setw(16) << std::setfill('0') << key << extension;
+			return stream.str();
+		}
+
+		static inline String getTemporaryPath(const String& path)
+		{
+			std::ostringstream stream;
+			stream << path << ".";
+#if defined(COMPILER_MSVC)
+			stream << GetCurrentProcessId();
+#else
+			stream << getpid();
+#endif
+			stream << "." << boost::this_thread::get_id() << ".tmp";
+			return stream.str();
+		}
+
+		// moves temporary over path, removes temporary if that fails
+		static inline bool replace(const String& temporary,const String& path)
+		{
+#if defined(COMPILER_MSVC)
+			const bool moved = MoveFileExA(temporary.c_str(),path.c_str(),MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+			const bool moved = std::rename(temporary.c_str(),path.c_str()) == 0;
+#endif
+			if(!moved)
+				std::remove(temporary.c_str());
+
+			return moved;
+		}
+	};
+
+}
+
+#endif
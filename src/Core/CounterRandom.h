@@ -0,0 +1,118 @@
+/********************************************************/
+// FILE: CounterRandom.h
+// DESCRIPTION: Stateless counter based random numbers
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_COUNTER_RANDOM_GUARD
+#define RAYTRACE_COUNTER_RANDOM_GUARD
+
+#include <RaytraceCommon.h>
+#include <array>
+
+namespace Raytrace {
+
+// Philox 4x32-10 from Salmon et al. "Parallel Random Numbers: As Easy as 1, 2, 3"
+// a keyed bijection on a 128 bit counter, each counter yields four 32 bit values
+struct Philox4x32
+{
+	typedef std::array<u32,4> Counter;
+	typedef std::array<u32,2> Key;
+
+	static const u32 Multiplier0 = 0xD2511F53;
+	static const u32 Multiplier1 = 0xCD9E8D57;
+	static const u32 Weyl0 = 0x9E3779B9;
+	static const u32 Weyl1 = 0xBB67AE85;
+
+	static const int Rounds = 10;
+
+	static inline Counter Generate(const Counter& counter,const Key& key)
+	{
+		Counter c = counter;
+		Key k = key;
+
+		for(int r = 0; r < Rounds; ++r)
+		{
+			const u64 product0 = (u64)Multiplier0 * (u64)c[0];
+			const u64 product1 = (u64)Multiplier1 * (u64)c[2];
+
+			Counter next;
+			next[0] = (u32)(product1 >> 32) ^ c[1] ^ k[0];
+			next[1] = (u32)product1;
+			next[2] = (u32)(product0 >> 32) ^ c[3] ^ k[1];
+			next[3] = (u32)product0;
+			c = next;
+
+			k[0] += Weyl0;
+			k[1] += Weyl1;
+		}
+
+		return c;
+	}
+
+	// top 24 bits, exactly representable and strictly below one
+	static inline Real ToUnit(u32 value)
+	{
+		return (Real)(value >> 8) * (1.0f / 16777216.0f);
+	}
+};
+
+// Random numbers addressed by (sample index, dimension) instead of drawn from a per thread
+// generator, so the values of a sample don't depend on which thread evaluates it.
+// One evaluation fills a whole Vector4, 2D requests use the first two lanes.
+struct CounterRandom
+{
+	// separate 1D and 2D dimensions that share an index
+	static const u32 Domain1D = 0;
+	static const u32 Domain2D = 1;
+
+	inline CounterRandom(u32 seed = 0)
+	{
+		_key[0] = seed;
+		_key[1] = 0x6A09E667;
+	}
+
+	inline Philox4x32::Counter Bits(up index,u32 dimension,u32 domain) const
+	{
+		Philox4x32::Counter counter;
+		counter[0] = (u32)index;
+		counter[1] = (u32)((u64)index >> 32);
+		counter[2] = dimension;
+		counter[3] = domain;
+		return Philox4x32::Generate(counter,_key);
+	}
+
+	inline Vector4 Uniform4(up index,u32 dimension,u32 domain) const
+	{
+		const Philox4x32::Counter bits = Bits(index,dimension,domain);
+		return Vector4(Philox4x32::ToUnit(bits[0]),Philox4x32::ToUnit(bits[1]),Philox4x32::ToUnit(bits[2]),Philox4x32::ToUnit(bits[3]));
+	}
+
+	inline Vector2 Uniform2D(up index,u32 dimension) const
+	{
+		const Philox4x32::Counter bits = Bits(index,dimension,Domain2D);
+		return Vector2(Philox4x32::ToUnit(bits[0]),Philox4x32::ToUnit(bits[1]));
+	}
+
+	inline Real Uniform(up index,u32 dimension) const
+	{
+		return Philox4x32::ToUnit(Bits(index,dimension,Domain1D)[0]);
+	}
+
+	Philox4x32::Key		_key;
+};
+
+}
+#endif
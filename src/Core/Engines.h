@@ -37,6 +37,8 @@
 #include "IIntersector.h"
 #include "ISampler.h"
 #include "SampleData.h"
+#include "BVH.h"
+#include "RayTriangleIntersection.h"
 
 namespace Raytrace {
 
@@ -45,6 +47,8 @@ namespace assign = boost::assign;
 struct GeneratedSample
 {
 	up		_index;
+	// position on the image plane, filled in by the integrator when it creates the camera ray
+	Vector2	_imageXY;
 
 	inline GeneratedSample() : _currentSampleIndex(0)
 	{
@@ -62,7 +66,7 @@ struct GeneratedSample
 		++_currentSampleIndex;
 	}
 
-	inline GeneratedSample(const GeneratedSample& other) :_index(other._index),_currentSampleIndex(other._currentSampleIndex)
+	inline GeneratedSample(const GeneratedSample& other) :_index(other._index),_imageXY(other._imageXY),_currentSampleIndex(other._currentSampleIndex)
 	{
 	}
 
@@ -73,20 +77,28 @@ private:
 
 struct CompletedSample
 {
-	inline CompletedSample()
+	inline CompletedSample() : _splat(false)
 	{
 	}
 
-	inline CompletedSample(const CompletedSample& other) :_index(other._index),_result(other._result)
+	inline CompletedSample(const CompletedSample& other) :_index(other._index),_imageXY(other._imageXY),_result(other._result),_splat(other._splat)
 	{
 	}
 	
-	inline CompletedSample(const GeneratedSample& other,const Vector4& result) :_index(other._index),_result(result)
+	inline CompletedSample(const GeneratedSample& other,const Vector4& result) :_index(other._index),_imageXY(other._imageXY),_result(result),_splat(false)
+	{
+	}
+
+	// light reaching the camera through imageXY, found while tracing the sample
+	inline CompletedSample(const GeneratedSample& other,const Vector2& imageXY,const Vector4& result) :_index(other._index),_imageXY(imageXY),_result(result),_splat(true)
 	{
 	}
 
 	up		_index;
+	Vector2	_imageXY;
 	Vector4	_result;
+	// only adds to the pixel at _imageXY and doesn't count as one of its samples
+	bool	_splat;
 };
 
 // ray Data
@@ -106,6 +118,12 @@ typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateMCSampler()
 template<class _SampleData,class _SceneReader> 
 typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateSobolSampler();
 
+template<class _SampleData,class _SceneReader> 
+typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateAdaptiveSampler();
+
+template<class _SampleData,class _SceneReader> 
+typename boost::shared_ptr<ISampler<_SampleData,_SceneReader>> CreateBlueNoiseSampler();
+
 // integrators
 
 template<class _SampleData,class _RayData,class _SceneReader> 
@@ -114,6 +132,12 @@ typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> Creat
 template<class _SampleData,class _RayData,class _SceneReader> 
 typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateBackwardIntegrator();
 
+template<class _SampleData,class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateWideBackwardIntegrator();
+
+template<class _SampleData,class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntegrator<_SampleData,_RayData,_SceneReader>> CreateBidirectionalIntegrator();
+
 // intersectors
 
 template<class _RayData,class _SceneReader> 
@@ -122,6 +146,33 @@ typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateSimpleInte
 template<class _RayData,class _SceneReader> 
 typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateBVHIntersector();
 
+template<class _RayData,class _SceneReader,BVHLayout _Layout> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateLayoutBVHIntersector();
+
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateWideBVHIntersector();
+
+template<class _RayData,class _SceneReader,int _QuantizationBits> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateQuantizedBVHIntersector();
+
+template<class _RayData,class _SceneReader,class _TriangleMethod> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateTriangleMethodBVHIntersector();
+
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateSplitBVHIntersector();
+
+template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int _LeafArraySize> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateConfiguredBVHIntersector();
+
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateAutotuneIntersector();
+
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateOutOfCoreIntersector();
+
+template<class _RayData,class _SceneReader> 
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateMotionBVHIntersector();
+
 // engines
 
 template<
@@ -159,7 +210,26 @@ template<class _RayData,class _SampleData,class _SceneReader> struct EngineOptio
 	{
 		static const std::map<String,IntersectorConstructor> intersectors = assign::map_list_of
 			( String("Simple Intersector"), IntersectorConstructor( &CreateSimpleIntersector<RayData,SceneReader> ) )
-			( String("BVH Intersector"), IntersectorConstructor( &CreateBVHIntersector<RayData,SceneReader> ) );
+			( String("BVH Intersector"), IntersectorConstructor( &CreateBVHIntersector<RayData,SceneReader> ) )
+			( String("BVH Intersector (Autotune)"), IntersectorConstructor( &CreateAutotuneIntersector<RayData,SceneReader> ) )
+			( String("BVH Intersector (Out of Core)"), IntersectorConstructor( &CreateOutOfCoreIntersector<RayData,SceneReader> ) )
+			( String("BVH Intersector (Motion Blur)"), IntersectorConstructor( &CreateMotionBVHIntersector<RayData,SceneReader> ) )
+			( String("BVH Intersector (8 Children)"), IntersectorConstructor( &CreateConfiguredBVHIntersector<RayData,SceneReader,4,2,1> ) )
+			( String("BVH Intersector (8 per Leaf)"), IntersectorConstructor( &CreateConfiguredBVHIntersector<RayData,SceneReader,4,1,2> ) )
+			( String("BVH Intersector (8 Children, 8 per Leaf)"), IntersectorConstructor( &CreateConfiguredBVHIntersector<RayData,SceneReader,4,2,2> ) )
+			( String("BVH Intersector (Depth First)"), IntersectorConstructor( &CreateLayoutBVHIntersector<RayData,SceneReader,BVHLayoutDepthFirst> ) )
+			( String("BVH Intersector (van Emde Boas)"), IntersectorConstructor( &CreateLayoutBVHIntersector<RayData,SceneReader,BVHLayoutVanEmdeBoas> ) )
+			( String("BVH Intersector (Treelets)"), IntersectorConstructor( &CreateLayoutBVHIntersector<RayData,SceneReader,BVHLayoutTreelet> ) )
+			( String("BVH Intersector (Early Split)"), IntersectorConstructor( &CreateSplitBVHIntersector<RayData,SceneReader> ) )
+#ifdef SIMD_AVX2
+			( String("BVH Intersector (8 wide)"), IntersectorConstructor( &CreateWideBVHIntersector<RayData,SceneReader> ) )
+#endif
+			( String("BVH Intersector (8 bit Nodes)"), IntersectorConstructor( &CreateQuantizedBVHIntersector<RayData,SceneReader,8> ) )
+			( String("BVH Intersector (16 bit Nodes)"), IntersectorConstructor( &CreateQuantizedBVHIntersector<RayData,SceneReader,16> ) )
+			( String("BVH Intersector (Moeller-Trumbore)"), IntersectorConstructor( &CreateTriangleMethodBVHIntersector<RayData,SceneReader,RayTriangleIntersectionMethodMoellerTrumbore> ) )
+			( String("BVH Intersector (Watertight)"), IntersectorConstructor( &CreateTriangleMethodBVHIntersector<RayData,SceneReader,RayTriangleIntersectionMethodWatertight> ) )
+			( String("BVH Intersector (Baldwin-Weber)"), IntersectorConstructor( &CreateTriangleMethodBVHIntersector<RayData,SceneReader,RayTriangleIntersectionMethodBaldwinWeber> ) )
+			( String("BVH Intersector (Analytic Shapes)"), IntersectorConstructor( &CreateTriangleMethodBVHIntersector<RayData,SceneReader,RayTriangleIntersectionMethodAnalytic> ) );
 		return intersectors;
 	}
 
@@ -167,7 +237,9 @@ template<class _RayData,class _SampleData,class _SceneReader> struct EngineOptio
 	{
 		static const std::map<String,SamplerConstructor> intersectors = assign::map_list_of
 			( String("Monte Carlo Sampler"), SamplerConstructor( &CreateMCSampler<SampleData,SceneReader> ) )
-			( String("Sobol Sampler"), SamplerConstructor( &CreateSobolSampler<SampleData,SceneReader> ) );
+			( String("Sobol Sampler"), SamplerConstructor( &CreateSobolSampler<SampleData,SceneReader> ) )
+			( String("Adaptive Sampler"), SamplerConstructor( &CreateAdaptiveSampler<SampleData,SceneReader> ) )
+			( String("Blue Noise Sampler"), SamplerConstructor( &CreateBlueNoiseSampler<SampleData,SceneReader> ) );
 		return intersectors;
 	}
 
@@ -176,7 +248,11 @@ template<class _RayData,class _SampleData,class _SceneReader> struct EngineOptio
 	{
 		static const std::map<String,IntegratorConstructor> intersectors = assign::map_list_of
 			( String("Whitted Integrator"), IntegratorConstructor( &CreateWhittedIntegrator<SampleData,RayData,SceneReader> ) )
-			( String("Backward Integrator"), IntegratorConstructor( &CreateBackwardIntegrator<SampleData,RayData,SceneReader> ) );
+			( String("Backward Integrator"), IntegratorConstructor( &CreateBackwardIntegrator<SampleData,RayData,SceneReader> ) )
+#ifdef SIMD_AVX2
+			( String("Backward Integrator (8 wide)"), IntegratorConstructor( &CreateWideBackwardIntegrator<SampleData,RayData,SceneReader> ) )
+#endif
+			( String("Bidirectional Integrator"), IntegratorConstructor( &CreateBidirectionalIntegrator<SampleData,RayData,SceneReader> ) );
 		return intersectors;
 	}
 
@@ -218,7 +294,7 @@ private:
 	}
 };
 
-typedef Ray<mpl::vector<RayLengthModeStored>> SimpleRay;
+typedef Ray<mpl::vector<RayLengthModeStored,RayTimeModeStored>> SimpleRay;
 typedef Triangle<> SimpleTriangle;
 
 typedef EngineOptions<
@@ -45,6 +45,51 @@ template<class _RayType> struct FisheyeCamera
 		return ray;
 	}
 
+	// solid angle density of the camera's rays at location for locations picked uniformly over the
+	// image, it's also the camera's importance in that direction
+	inline Real Pdf(const Vector2& location) const
+	{
+		return getDensity( Vector2( _angleStep.x() * (location.x()*2.0f-1.0f) , _angleStep.y() * (location.y()*2.0f-1.0f) ) );
+	}
+
+	// the image location whose ray leaves along direction, false if the camera doesn't see it
+	inline bool Project(const Vector3& direction,Vector2& location,Real& pdf) const
+	{
+		if(!(direction.z() > 0.0f))
+			return false;
+
+		// the ray's direction is parallel to (-sin x, -sin y, cos x cos y), with c = cos x cos y
+		// this gives sin x = a c and sin y = b c and c^2 solves a^2 b^2 c^4 - (1 + a^2 + b^2) c^2 + 1 = 0
+		const Real a = -direction.x() / direction.z();
+		const Real b = -direction.y() / direction.z();
+		const Real sum = 1.0f + a*a + b*b;
+		const Real c = sqrt(2.0f / (sum + sqrt(std::max<Real>(0.0f,sum*sum - 4.0f*a*a*b*b))));
+
+		const Vector2 rayAngle( asinf(std::min<Real>(1.0f,std::max<Real>(-1.0f,a*c))) , asinf(std::min<Real>(1.0f,std::max<Real>(-1.0f,b*c))) );
+
+		location = Vector2( (rayAngle.x() / _angleStep.x() + 1.0f) * 0.5f , (rayAngle.y() / _angleStep.y() + 1.0f) * 0.5f );
+
+		if(!(location.x() >= 0.0f && location.x() < 1.0f && location.y() >= 0.0f && location.y() < 1.0f))
+			return false;
+
+		pdf = getDensity(rayAngle);
+		return true;
+	}
+
+	// one over the solid angle the image location's neighbourhood covers, per unit of image area
+	inline Real getDensity(const Vector2& rayAngle) const
+	{
+		const Real sinX = sinf(rayAngle.x()), cosX = cosf(rayAngle.x());
+		const Real sinY = sinf(rayAngle.y()), cosY = cosf(rayAngle.y());
+
+		// |v . (dv/dx x dv/dy)| / |v|^3 for the unnormalized direction v
+		const Real lengthSq = sinX*sinX + sinY*sinY + cosX*cosX*cosY*cosY;
+		const Real volume = sinX*sinX*cosY*cosY + sinY*sinY*cosX*cosX + cosX*cosX*cosY*cosY;
+		const Real solidAngle = 4.0f * _angleStep.x() * _angleStep.y() * volume / (lengthSq * sqrt(lengthSq));
+
+		return (solidAngle > 0.0f) ? 1.0f / solidAngle : 0.0f;
+	}
+
 	Vector2					_fov;
 	Vector2					_angleStep;
 };
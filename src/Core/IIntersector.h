@@ -20,9 +20,41 @@
 #define RAYTRACE_IINTERSECTOR_GUARD
 
 #include <RaytraceCommon.h>
+#include <array>
+#include <cstring>
 
 namespace Raytrace
 {
+	// quality of an acceleration structure, plain data so it can be stored along with a cached hierarchy
+	struct IntersectorStatistics
+	{
+		static const size_t HistogramSize = 64;
+
+		inline IntersectorStatistics()
+		{
+			memset(this,0,sizeof(IntersectorStatistics));
+		}
+
+		u64		_memoryBytes;
+		u32		_nodeCount;
+		u32		_leafCount;
+		u32		_primitiveCount;
+		u32		_referenceCount;	// leaf entries, above _primitiveCount once split clipping gave primitives several
+		u32		_maxDepth;
+
+		f32		_sahCost;			// expected cost of a ray through the root, in single box/primitive tests
+		f32		_epo;				// effective primitive overlap, cost weighted primitive area inside unrelated nodes
+		f32		_nodeFill;			// average used child slots per node
+		f32		_leafFill;			// average references per leaf
+
+		f32		_elementsPerRay;	// measured with probe rays, zero unless the scene asks for intersector statistics
+		f32		_cacheLinesPerRay;
+		f32		_cacheMissesPerRay;
+
+		std::array<u32,HistogramSize>	_leafDepthHistogram;
+		std::array<u32,HistogramSize>	_leafFillHistogram;
+	};
+
 	template<class _RayData,class _SceneReader> struct IIntersector
 	{
 		virtual void InitializePrepareST(size_t numThreads,const _SceneReader& scene,_RayData& rayData) {}
@@ -33,6 +65,19 @@ namespace Raytrace
 		virtual void IntersectMT(size_t threadId) {}
 		virtual void IntersectCompleteST() {}
 
+		// false if spheres, disks and quads would be intersected as the triangle their points describe
+		virtual bool SupportsAnalyticPrimitives() const { return false; }
+
+		// true if the intersector pages its data through the cache directory and cannot run without one
+		virtual bool RequiresCacheDirectory() const { return false; }
+
+		// valid once InitializePrepareST completed
+		virtual Result GetStatistics(IntersectorStatistics& statisticsOut) const { return Result::NotImplemented; }
+
+		// average time of a closest hit query over a fixed set of rays aimed at the primitives of scene,
+		// which has to be the one the intersector was initialized with, valid once InitializePrepareST completed
+		virtual Result MeasureTraversal(const _SceneReader& scene,f32& nanosecondsPerRayOut) { return Result::NotImplemented; }
+
 		virtual ~IIntersector() {}
 	};
 }
@@ -20,6 +20,8 @@
 #define RAYTRACE_IMPORTANCE_SAMPLERS_GUARD
 
 #include <RaytraceCommon.h>
+#include <vector>
+#include <algorithm>
 
 namespace Raytrace
 {
@@ -30,6 +32,80 @@ namespace Raytrace
 		virtual Real GetSamplePDF(const Vector2& v) = 0;
 	};
 
+	// Walker's alias method with Vose's construction, draws an index proportional
+	// to its weight in O(1) from a single uniform number.
+	// Tables are plain arrays so many of them can share one allocation.
+	struct AliasTable
+	{
+		struct Entry
+		{
+			Real	_threshold;
+			u32		_alias;
+		};
+
+		// all zero weights give a uniform table
+		static void Build(const Real* weights,size_t size,Entry* table,std::vector<u32>& work)
+		{
+			Real sum = 0.0f;
+			for(size_t i = 0; i < size; ++i)
+				sum += weights[i];
+
+			if(!(sum > 0.0f))
+			{
+				for(size_t i = 0; i < size; ++i)
+				{
+					table[i]._threshold = 1.0f;
+					table[i]._alias = (u32)i;
+				}
+				return;
+			}
+
+			// small entries are stacked from the front of work, large ones from the back
+			work.resize(size);
+			size_t numSmall = 0;
+			size_t numLarge = 0;
+
+			const Real scale = (Real)size / sum;
+			for(size_t i = 0; i < size; ++i)
+			{
+				table[i]._threshold = weights[i] * scale;
+				table[i]._alias = (u32)i;
+				if(table[i]._threshold < 1.0f)
+					work[numSmall++] = (u32)i;
+				else
+					work[size - ++numLarge] = (u32)i;
+			}
+
+			while(numSmall && numLarge)
+			{
+				const u32 small = work[--numSmall];
+				const u32 large = work[size - numLarge];
+
+				table[small]._alias = large;
+				table[large]._threshold -= 1.0f - table[small]._threshold;
+
+				if(table[large]._threshold < 1.0f)
+				{
+					--numLarge;
+					work[numSmall++] = large;
+				}
+			}
+
+			// whatever is left over is only off by rounding
+			while(numLarge)
+				table[work[size - numLarge--]]._threshold = 1.0f;
+			while(numSmall)
+				table[work[--numSmall]]._threshold = 1.0f;
+		}
+
+		static inline size_t Sample(const Entry* table,size_t size,Real random)
+		{
+			const Real scaled = random * (Real)size;
+			const size_t i = std::min<size_t>((size_t)scaled,size - 1);
+			return (scaled - (Real)i < table[i]._threshold) ? i : (size_t)table[i]._alias;
+		}
+	};
+
 
 
 }
@@ -20,6 +20,9 @@
 #define RAYTRACE_INTEGRATOR_BASE_GUARD
 
 #include <RaytraceCommon.h>
+#include <array>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 #include "EngineBase.h"
 #include "RayData.h"
 #include "SampleData.h"
@@ -28,6 +31,8 @@
 #include "SplitUseWorkQueue.h"
 #include "chunk_vector.h"
 #include "FisheyeCamera.h"
+#include "ImportanceSamplers.h"
+#include "LightTree.h"
 #include "math.h"
 
 
@@ -51,12 +56,22 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 
 	typedef typename RayData::PrimitiveUserData					PrimitiveIdentifier;
 
-	struct Light
+	// point lights emit _color as intensity from _location, area lights _color as radiance,
+	// _location is their center so integrators that only handle points can still use them
+	struct LightSettings
 	{
-		Light(const Vector3& l,const Vector3& c) : _location(l), _color(c) {}
-		Light() {}
+		LightSettings(const Vector3& l,const Vector3& c) : _type(ISceneReader::LightData::LIGHT_POINT), _location(l), _color(c) {}
+		LightSettings() {}
+		ISceneReader::LightData::Type	_type;
 		Vector3					_location;
 		Vector3					_color;
+
+		// area lights only
+		Vector3					_corner;
+		Vector3					_edge1;
+		Vector3					_edge2;
+		Vector3					_normal;
+		Real					_area;
 	};
 
 	struct PrimitiveData
@@ -83,10 +98,26 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 		Real	_transparency;
 	};
 
+	// the lobes a reflected direction is picked from, _c are the chances of picking each lobe
+	struct ReflectionLobes
+	{
+		Vector3		_xTangent;
+		Vector3		_yTangent;
+		Vector3		_normal;
+		Vector3		_xTangentSpecular;
+		Vector3		_vSpec;
+		Vector3		_xTangentRefracted;
+		Vector3		_vRef;
+		Real		_cDiffuse;
+		Real		_cSpecular;
+		Real		_cRefracted;
+		Real		_cBackground;
+	};
+
 	
 	typedef Real (*pdfAt)(const Vector3&);
 
-	void InitializeSceneData(const SceneReader& scene) 
+	void InitializeSceneData(size_t numThreads,const SceneReader& scene) 
 	{
 		PrimitiveType dummy;
 
@@ -118,9 +149,16 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 			}
 		}
 
+		_motion.clear();
+		if(scene->hasMovingPrimitives())
+			_motion.resize(_primitives.size());
+
 		for(size_t i = 0; i < _primitives.size(); ++i)
 		{
-			scene->getPrimitive((int)i,_primitives[i]._primitive,_primitives[i]._material);
+			if(_motion.empty())
+				scene->getPrimitive((int)i,_primitives[i]._primitive,_primitives[i]._material);
+			else
+				scene->getPrimitive((int)i,_primitives[i]._primitive,_motion[i],_primitives[i]._material);
 
 			assert( _primitives[i]._material < (int)_materials.size() );
 			
@@ -131,12 +169,51 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 			_primitives[i]._normal = AB.cross(AC).normalized();
 		}
 
+		generateEmissiveLookup();
+
+		std::vector<LightTree::Emitter> emitters(_lights.size());
+
 		for(size_t i = 0; i < _lights.size(); ++i)
 		{
 			ISceneReader::LightData lightData = scene->getLight(i);
-			_lights[i]._location = lightData._location;
-			_lights[i]._color = lightData._color;
+			LightSettings& light = _lights[i];
+			LightTree::Emitter& emitter = emitters[i];
+
+			light._type = lightData._type;
+			light._color = lightData._color;
+
+			const Real luminance = std::max<Real>(0.0f,light._color.sum()/3.0f);
+
+			if(light._type == ISceneReader::LightData::LIGHT_AREA)
+			{
+				const Vector3 normal = lightData._edge1.cross(lightData._edge2);
+
+				light._corner = lightData._location;
+				light._edge1 = lightData._edge1;
+				light._edge2 = lightData._edge2;
+				light._area = normal.norm();
+				light._normal = (light._area > 0.0f) ? Vector3(normal / light._area) : Vector3(0.0f,1.0f,0.0f);
+				light._location = light._corner + (light._edge1 + light._edge2)*0.5f;
+
+				const Vector3 far = light._corner + light._edge1 + light._edge2;
+				emitter._min = light._corner.cwiseMin(far).cwiseMin(light._corner + light._edge1).cwiseMin(light._corner + light._edge2);
+				emitter._max = light._corner.cwiseMax(far).cwiseMax(light._corner + light._edge1).cwiseMax(light._corner + light._edge2);
+				emitter._axis = light._normal;
+				emitter._cosSpread = 1.0f;
+				emitter._power = luminance * light._area * R_PI;
+			}
+			else
+			{
+				light._location = lightData._location;
+
+				emitter._min = emitter._max = light._location;
+				emitter._axis = Vector3(0.0f,1.0f,0.0f);
+				emitter._cosSpread = -1.0f;
+				emitter._power = luminance * 4.0f * R_PI;
+			}
 		}
+
+		_lightTree.build(emitters);
 		
 		_backgroundSize = scene->getBackgroundSize();
 		_backgroundData.resize( _backgroundSize.x()* _backgroundSize.y() );
@@ -150,7 +227,7 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 				_backgroundData[iy * _backgroundSize.x() + ix] =
 					inverted_background[ (_backgroundSize.y() - iy - 1) * _backgroundSize.x() + ix];
 		
-		generateImportanceLookup();
+		generateImportanceLookup(numThreads);
 
 		_view = scene->getViewMatrix();
 		_invView = _view.inverse();
@@ -393,6 +470,27 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 		}
 	}
 
+	// spheres are the only shape whose normal changes across the surface, moving triangles are moved to the ray's time
+	inline PrimitiveData getPrimitiveAt(int id,const Vector3& location,Real time = 0.0f) const
+	{
+		PrimitiveData primitive = _primitives[id];
+
+		if(!_motion.empty())
+		{
+			for(int p = 0; p < 3; ++p)
+				primitive._primitive.setPoint(p, Vector3(primitive._primitive.point(p) + _motion[id][p] * time));
+
+			const Vector3 AB = primitive._primitive.point(1) - primitive._primitive.point(0);
+			const Vector3 AC = primitive._primitive.point(2) - primitive._primitive.point(0);
+			primitive._normal = AB.cross(AC).normalized();
+		}
+
+		if(primitive._primitive.shape() == PrimitiveShapeSphere)
+			primitive._normal = (location - primitive._primitive.point(0)).normalized();
+
+		return primitive;
+	}
+
 	inline ColorArray GetReflectedFactor(const MaterialSettings& material,const PrimitiveData& primitive,const Vector3& toLight,const Vector3& toViewer)
 	{
 		ColorArray brdf;
@@ -503,35 +601,159 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 		return albedo;
 	}
 
-	inline Real getImportanceLookupSpherical(Vector2 random, Vector3& dir)
+	// fails if the material reflects nothing, background adds a lobe toward the bright parts of the background
+	inline bool GetReflectionLobes(const MaterialSettings& material,const PrimitiveData& primitive,const Vector3& toViewer,ReflectionLobes& lobes,bool background = true)
 	{
-		size_t iy, ix;
+		const Vector3& normal = primitive._normal;
+		Vector3 yTangent = toViewer.cross(normal).normalized();
+	
+		if(yTangent.squaredNorm() != 0.0f)
+			yTangent.normalize();
+		else
+		{
+			yTangent = toViewer.cross(Vector3(1.0f,0.0f,0.0f));
+			if(yTangent.squaredNorm() != 0.0f)
+				yTangent.normalize();
+			else
+				yTangent = toViewer.cross(Vector3(0.0f,1.0f,0.0f)).normalized();
+		}
 
-		// todo: rewrite from 2n to 2logn
+		lobes._normal = normal;
+		lobes._yTangent = yTangent;
+		lobes._xTangent = yTangent.cross(normal).normalized();
+		lobes._cDiffuse = lobes._cSpecular = lobes._cRefracted = lobes._cBackground = 0.0f;
+		
+		if(material._diffuseReflect > 0.0f)
+			lobes._cDiffuse = material._diffuseReflect;
+		
+		if(material._specularReflect > 0.0f && GetSpecularDirection(toViewer,normal,lobes._vSpec))
+		{
+			lobes._xTangentSpecular = yTangent.cross(lobes._vSpec).normalized();
+			lobes._cSpecular = material._specularReflect;
+		}
+		
+		if(material._transparency > 0.0f && GetRefractedDirection(toViewer,normal,material._indexOfRefraction,lobes._vRef))
+		{
+			lobes._xTangentRefracted = yTangent.cross(lobes._vRef).normalized();
+			lobes._cRefracted = material._transparency;
+		}
+		
+		if(background && getBackgroundEmissive() > 0.0f)
+			lobes._cBackground = 1.0f;//getBackgroundEmissive();
+
+		Real cSum = lobes._cDiffuse + lobes._cSpecular + lobes._cRefracted + lobes._cBackground;
+
+		if(cSum <= 0.0f)
+			return false;
+
+		lobes._cDiffuse /= cSum;
+		lobes._cSpecular /= cSum;
+		lobes._cRefracted /= cSum;
+		lobes._cBackground /= cSum;
+		return true;
+	}
 
-		for(iy = 0; 
-			(iy+1) < _backgroundSize.y();
-			++iy)
+	// pdf of picking dir from the lobes, heuristicSum is the sum of the lobes' (chance*pdf)^2
+	inline Real GetReflectedPdf(const ReflectionLobes& lobes,const MaterialSettings& material,const Vector3& dir,Real& heuristicSum)
+	{
+		Real pdf = 0.0f;
+		heuristicSum = 0.0f;
+
+		Real lobePdf;
+
+		if(lobes._cDiffuse > 0.0f)
 		{
-			if(_backgroundImportanceLookupYSlices[iy] >= random.x())
-				break;
-			else
-				random.x() -= _backgroundImportanceLookupYSlices[iy];
+			lobePdf = pdfAtCosineWeightedHemisphere(lobes._xTangent,lobes._yTangent,lobes._normal,dir)*lobes._cDiffuse;
+			pdf += lobePdf;
+			heuristicSum += lobePdf*lobePdf;
+		}
+		if(lobes._cSpecular > 0.0f)
+		{
+			lobePdf = pdfAtCosineWeightedLobe(lobes._xTangentSpecular,lobes._yTangent,lobes._vSpec,material._specularPower,dir)*lobes._cSpecular;
+			pdf += lobePdf;
+			heuristicSum += lobePdf*lobePdf;
+		}
+		if(lobes._cRefracted > 0.0f)
+		{
+			lobePdf = pdfAtCosineWeightedLobe(lobes._xTangentRefracted,lobes._yTangent,lobes._vRef,material._refractionPower,dir)*lobes._cRefracted;
+			pdf += lobePdf;
+			heuristicSum += lobePdf*lobePdf;
 		}
+		if(lobes._cBackground > 0.0f)
+		{
+			lobePdf = getBackgroundPdf(lobes._xTangent,lobes._yTangent,lobes._normal,dir)*lobes._cBackground;
+			pdf += lobePdf;
+			heuristicSum += lobePdf*lobePdf;
+		}
+
+		return pdf;
+	}
+
+	// picks a lobe with random then a direction from it with uv, returns the pdf of the whole mixture
+	inline Real SampleReflectionLobes(const ReflectionLobes& lobes,const MaterialSettings& material,const Vector2& uv,Real random,Vector3& dir)
+	{
+		if(random < lobes._cDiffuse)
+			cosineWeightedHemisphere(uv,lobes._xTangent,lobes._yTangent,lobes._normal,dir);
+		else if((random -= lobes._cDiffuse) < lobes._cSpecular)
+			cosineWeightedLobe(uv,lobes._xTangentSpecular,lobes._yTangent,lobes._vSpec,material._specularPower,dir);
+		else if((random -= lobes._cSpecular) < lobes._cRefracted)
+			cosineWeightedLobe(uv,lobes._xTangentRefracted,lobes._yTangent,lobes._vRef,material._refractionPower,dir);
+		else if(lobes._cBackground > 0.0f)
+			getImportanceLookupSpherical(uv,dir);
+		else
+			return 0.0f;
+
+		Real heuristicSum;
+		return GetReflectedPdf(lobes,material,dir,heuristicSum);
+	}
+
+	// picks one of the scene's lights from the light tree and a point on it, color is what reaches
+	// location over toLight divided by the chance of picking it, before any occlusion
+	inline bool SampleSceneLight(const Vector3& location,const MaterialSettings& material,const PrimitiveData& primitive,const Vector3& toViewer,Real random,const Vector2& uv,ColorArray& color,Vector3& toLight,Real& distance)
+	{
+		size_t lightIndex;
+		Real lightPMF;
+
+		if(!_lightTree.sample(location,random,lightIndex,lightPMF))
+			return false;
+
+		const LightSettings& light = _lights[lightIndex];
+
+		Vector3 lightPoint = light._location;
+		Real lightArea = 0.0f;
+
+		if(light._type == ISceneReader::LightData::LIGHT_AREA)
+			lightPoint = light._corner + light._edge1*uv.x() + light._edge2*uv.y();
 
-		Real pdf = _backgroundImportanceLookupYSlices[iy];
+		toLight = (lightPoint - location);
+		const Real lightDistanceSq = toLight.squaredNorm();
+		distance = sqrt(lightDistanceSq);
+		toLight /= distance;
 
-		for(ix = 0; 
-			(ix+1) < _backgroundSize.x();
-			++ix)
+		if(light._type == ISceneReader::LightData::LIGHT_AREA)
 		{
-			if(_backgroundImportanceLookupXSlices[iy * _backgroundSize.x() + ix] >= random.y())
-				break;
-			else
-				random.y() -= _backgroundImportanceLookupXSlices[iy * _backgroundSize.x() + ix];
+			// radiance times the solid angle the light's area covers
+			const Real cosLight = -light._normal.dot(toLight);
+			lightArea = (cosLight > 0.0f) ? lightDistanceSq / (cosLight * light._area) : 0.0f;
 		}
+		else
+			lightArea = lightDistanceSq*4.0f*(Real)R_PI;
+
+		if(!(lightArea > 0.0f))
+			return false;
+
+		color = GetReflectedFactorPoint(material,primitive,toLight,toViewer) * light._color.array() / (lightArea * lightPMF);
+		return true;
+	}
+
+	// picks a background texel with probability proportional to its luminance times its solid angle,
+	// a row from the marginal table then a column from that row's table, O(1) either way
+	inline Real getImportanceLookupSpherical(Vector2 random, Vector3& dir)
+	{
+		const size_t iy = AliasTable::Sample(_backgroundImportanceRows.data(),_backgroundSize.y(),random.x());
+		const size_t ix = AliasTable::Sample(_backgroundImportanceColumns.data() + iy * _backgroundSize.x(),_backgroundSize.x(),random.y());
 		
-		pdf = _backgroundData[iy * _backgroundSize.x() + ix].head<3>().sum()/3.0f / _backgroundIntegral;
+		Real pdf = _backgroundData[iy * _backgroundSize.x() + ix].head<3>().sum()/3.0f / _backgroundIntegral;
 
 		Real phi = (Real)ix / (Real)_backgroundSize.x() * 2.0f * R_PI;
 		Real theta = (Real)iy / (Real)_backgroundSize.y() * R_PI;
@@ -547,44 +769,171 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 		return _backgroundEmissive;
 	}
 
-	void generateImportanceLookup()
+	// the per row tables are independent and built in parallel, only the row marginal is serial
+	void generateImportanceLookup(size_t numThreads)
 	{
-		_backgroundImportanceLookupXSlices.resize(_backgroundSize.x() * _backgroundSize.y());
-		_backgroundImportanceLookupYSlices.resize(_backgroundSize.y());
-		float totalImportance = 0.0f;
+		_backgroundImportanceColumns.resize(_backgroundSize.x() * _backgroundSize.y());
+		_backgroundImportanceRows.resize(_backgroundSize.y());
+
+		std::vector<Real> rowImportance(_backgroundSize.y());
+
+		const size_t numWorkers = std::max<size_t>(1,std::min<size_t>(numThreads,_backgroundSize.y()));
+
+		boost::thread_group workers;
+		for(size_t w = 1; w < numWorkers; ++w)
+			workers.create_thread(boost::bind(&IntegratorBase::generateImportanceRows,this,w,numWorkers,rowImportance.data()));
+		generateImportanceRows(0,numWorkers,rowImportance.data());
+		workers.join_all();
+
+		std::vector<Real> rowWeights(_backgroundSize.y());
+		std::vector<u32> work;
+
 		_backgroundEmissive = 0.0f; 
 		_backgroundIntegral = 0.0f;
 		for(int iy = 0; iy < _backgroundSize.y(); ++iy)
 		{
 			float areaSlice = 2.0f * R_PI * (cosf( (float)(iy)/(float)_backgroundSize.y() * M_PI ) - cosf( (float)(iy+1)/(float)_backgroundSize.y() * M_PI ));
+			float sliceImportance = rowImportance[iy];
+
+			_backgroundEmissive += sliceImportance;
+			_backgroundIntegral += sliceImportance * areaSlice / (Real)_backgroundSize.x();
+			rowWeights[iy] = sliceImportance * areaSlice;
+		}
+		AliasTable::Build(rowWeights.data(),_backgroundSize.y(),_backgroundImportanceRows.data(),work);
+
+		_backgroundEmissive/= (float)(_backgroundSize.x() * _backgroundSize.y());
+
+		std::cout << "Background Integral: " << _backgroundIntegral << std::endl;
+	}
+
+	// worker w of numWorkers handles a contiguous band of rows
+	void generateImportanceRows(size_t worker,size_t numWorkers,Real* rowImportance)
+	{
+		const size_t begin = _backgroundSize.y() * worker / numWorkers;
+		const size_t end = _backgroundSize.y() * (worker + 1) / numWorkers;
+
+		std::vector<Real> luminance(_backgroundSize.x());
+		std::vector<u32> work;
+
+		for(size_t iy = begin; iy < end; ++iy)
+		{
 			float sliceImportance = 0.0f;
 
-			for(int ix = 0; ix < _backgroundSize.x(); ++ix)
-				sliceImportance += _backgroundImportanceLookupXSlices[iy * _backgroundSize.x() + ix] =
-					_backgroundData[iy * _backgroundSize.x() + ix].head<3>().sum()/3.0f;
-			
-			Real sum_check = 0.0f;
+			for(size_t ix = 0; ix < _backgroundSize.x(); ++ix)
+				sliceImportance += luminance[ix] = _backgroundData[iy * _backgroundSize.x() + ix].head<3>().sum()/3.0f;
 
-			if(sliceImportance > 0.0f)
-				for(int ix = 0; ix < _backgroundSize.x(); ++ix)
-				{
-					_backgroundImportanceLookupXSlices[iy * _backgroundSize.x() + ix] /= sliceImportance;
-					sum_check += _backgroundImportanceLookupXSlices[iy * _backgroundSize.x() + ix];
-				}
+			rowImportance[iy] = sliceImportance;
+			AliasTable::Build(luminance.data(),_backgroundSize.x(),_backgroundImportanceColumns.data() + iy * _backgroundSize.x(),work);
+		}
+	}
 
-			_backgroundEmissive += sliceImportance;
-			_backgroundIntegral += sliceImportance * areaSlice / (Real)_backgroundSize.x();
-			totalImportance += _backgroundImportanceLookupYSlices[iy] = sliceImportance * areaSlice;
+	// flat emitters are picked with probability proportional to their area times emitted luminance,
+	// spheres are only found by paths hitting them
+	void generateEmissiveLookup()
+	{
+		_emissivePrimitives.clear();
+		_emissiveTable.clear();
+		_emissiveProbability.clear();
+
+		std::vector<Real> weights;
+
+		for(size_t i = 0; i < _primitives.size(); ++i)
+		{
+			const PrimitiveData& primitive = _primitives[i];
+			const MaterialSettings& material = _materials[primitive._material];
+			const Real luminance = material._emit * material._color.sum() / 3.0f;
+
+			if(luminance > 0.0f && primitive._primitive.shape() != PrimitiveShapeSphere)
+			{
+				_emissivePrimitives.push_back((u32)i);
+				weights.push_back(luminance * getShapeArea(primitive));
+			}
 		}
-		Real sum_check = 0.0f;
-		for(int iy = 0; iy < _backgroundSize.y(); ++iy)
+
+		Real total = 0.0f;
+		for(size_t i = 0; i < weights.size(); ++i)
+			total += weights[i];
+
+		if(!(total > 0.0f))
 		{
-			_backgroundImportanceLookupYSlices[iy] /= totalImportance;
-			sum_check += _backgroundImportanceLookupYSlices[iy];
+			_emissivePrimitives.clear();
+			return;
 		}
-		_backgroundEmissive/= (float)(_backgroundSize.x() * _backgroundSize.y());
 
-		std::cout << "Background Integral: " << _backgroundIntegral << std::endl;
+		std::vector<u32> work;
+		_emissiveTable.resize(weights.size());
+		AliasTable::Build(weights.data(),weights.size(),_emissiveTable.data(),work);
+
+		_emissiveProbability.resize(_primitives.size(),0.0f);
+		for(size_t i = 0; i < weights.size(); ++i)
+			_emissiveProbability[_emissivePrimitives[i]] = weights[i] / total;
+	}
+
+	inline bool hasEmissivePrimitives() const
+	{
+		return !_emissivePrimitives.empty();
+	}
+
+	// picks an emitter and a uniformly distributed point on it, pdf is per unit area
+	inline Real sampleEmissive(Real random,const Vector2& uv,Real time,int& id,Vector3& location,Vector3& normal) const
+	{
+		id = (int)_emissivePrimitives[AliasTable::Sample(_emissiveTable.data(),_emissiveTable.size(),random)];
+
+		const PrimitiveData primitive = getPrimitiveAt(id,Vector3::Zero(),time);
+		const Vector3& p0 = primitive._primitive.point(0);
+		const Vector3 e1 = primitive._primitive.point(1) - p0;
+		const Vector3 e2 = primitive._primitive.point(2) - p0;
+
+		switch(primitive._primitive.shape())
+		{
+		case PrimitiveShapeQuad:
+			location = p0 + e1*uv.x() + e2*uv.y();
+			break;
+		case PrimitiveShapeDisk:
+			{
+				const Real r = sqrtf(uv.x());
+				const Real phi = uv.y() * 2.0f * R_PI;
+				location = p0 + e1*(r*cosf(phi)) + e2*(r*sinf(phi));
+			}
+			break;
+		default:
+			{
+				const Real su = sqrtf(uv.x());
+				location = p0 + e1*(su*(1.0f - uv.y())) + e2*(su*uv.y());
+			}
+			break;
+		}
+
+		normal = primitive._normal;
+		return getEmissivePdf(id,primitive);
+	}
+
+	// area pdf sampleEmissive picks a point on primitive id with, zero for primitives it never picks
+	inline Real getEmissivePdf(int id,const PrimitiveData& primitive) const
+	{
+		if(_emissiveProbability.empty() || _emissiveProbability[id] <= 0.0f)
+			return 0.0f;
+
+		const Real area = getShapeArea(primitive);
+		return (area > 0.0f) ? _emissiveProbability[id] / area : 0.0f;
+	}
+
+	static inline Real getShapeArea(const PrimitiveData& primitive)
+	{
+		const Vector3 e1 = primitive._primitive.point(1) - primitive._primitive.point(0);
+		const Vector3 e2 = primitive._primitive.point(2) - primitive._primitive.point(0);
+
+		switch(primitive._primitive.shape())
+		{
+		case PrimitiveShapeQuad:
+			return e1.cross(e2).norm();
+		case PrimitiveShapeDisk:
+			return e1.squaredNorm() * R_PI;
+		case PrimitiveShapeSphere:
+			return e1.squaredNorm() * 4.0f * R_PI;
+		default:
+			return e1.cross(e2).norm() * 0.5f;
+		}
 	}
 
 	Real getBackgroundPdf(const Vector3& x,const Vector3& y,const Vector3& z,const Vector3& dir)
@@ -596,8 +945,13 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 	}
 
 	std::vector<PrimitiveData>		_primitives;
+	std::vector<std::array<Vector3,3>>	_motion;		// per vertex movement over the shutter interval, empty for static scenes
 	std::vector<MaterialSettings>	_materials;
-	std::vector<Light>				_lights;
+	std::vector<LightSettings>		_lights;
+	std::vector<u32>				_emissivePrimitives;	// flat primitives with an emissive material
+	std::vector<AliasTable::Entry>	_emissiveTable;			// picks one of them by area times emitted luminance
+	std::vector<Real>				_emissiveProbability;	// per primitive chance of being picked, empty without emitters
+	LightTree						_lightTree;
 
 	Matrix4							_invView;
 	Matrix4							_view;
@@ -606,8 +960,8 @@ template<class _SampleData,class _RayData,class _SceneReader> struct IntegratorB
 	Real							_backgroundIntegral;
 	Vector2u						_backgroundSize;
 	std::vector<Vector4>			_backgroundData;
-	std::vector<Real>				_backgroundImportanceLookupYSlices;
-	std::vector<Real>				_backgroundImportanceLookupXSlices;
+	std::vector<AliasTable::Entry>	_backgroundImportanceRows;		// marginal over the rows
+	std::vector<AliasTable::Entry>	_backgroundImportanceColumns;	// one table per row
 };
 
 }
@@ -117,6 +117,7 @@ namespace Raytrace {
 	
 	struct PrimitiveClassRay {};
 	struct PrimitiveClassAxisAlignedBox {};
+	struct PrimitiveClassQuantizedAxisAlignedBox {};
 	struct PrimitiveClassTriangle {};
 	struct PrimitiveClassSphere {};
 
@@ -0,0 +1,27 @@
+#include "headers.h"
+#include "LightImp.h"
+
+namespace Raytrace {
+
+Light CreateLight(const String& name)
+{
+	return Light(new LightImp(name));
+}
+
+LightImp::LightImp(const String& name) : ObjectImp<LightImp,ILight>(name),
+		_type("point"),
+		_color(1.0f,1.0f,1.0f,1.0f),
+		_intensity(1.0f),
+		_position(0.0f,0.0f,0.0f),
+		_edge1(1.0f,0.0f,0.0f),
+		_edge2(0.0f,0.0f,1.0f)
+{
+}
+
+LightImp::~LightImp()
+{
+}
+
+RObjectType ILight::ObjectType = ObjectType::Light;
+
+}
\ No newline at end of file
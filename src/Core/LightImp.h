@@ -0,0 +1,81 @@
+/********************************************************/
+// FILE: LightImp.h
+// DESCRIPTION: Raytracer Light
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)    
+/********************************************************/
+// This work is licensed under the Creative Commons 
+// Attribution-NonCommercial 3.0 Unported License. 
+// To view a copy of this license, visit 
+// http://creativecommons.org/licenses/by-nc/3.0/ or send 
+// a letter to Creative Commons, 444 Castro Street, 
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_LIGHT_IMP_GUARD
+#define RAYTRACE_LIGHT_IMP_GUARD
+
+#include <RaytraceLight.h>
+#include <boost/assign.hpp>
+#include "ObjectImp.h"
+
+namespace Raytrace {
+
+	class LightImp : public ObjectImp<LightImp,ILight>
+	{
+	public:
+		~LightImp();
+		
+		static const PropertyMap& GetPropertySet()
+		{
+			const static PropertyMap set = boost::assign::map_list_of
+				("type",Property(&LightImp::GetLightType,&LightImp::SetLightType))
+				("color",Property(&LightImp::GetColor,&LightImp::SetColor))
+				("intensity",Property(&LightImp::GetIntensity,&LightImp::SetIntensity))
+				("position",Property(&LightImp::GetPosition,&LightImp::SetPosition))
+				("edge1",Property(&LightImp::GetEdge1,&LightImp::SetEdge1))
+				("edge2",Property(&LightImp::GetEdge2,&LightImp::SetEdge2));
+			return set;
+		}
+
+		inline void SetLightType(const String& type){_type = type;}
+		inline String GetLightType() const{return _type;}
+
+		inline void SetColor(const Vector4& color){_color = color;}
+		inline Vector4 GetColor() const{return _color;}
+
+		inline void SetIntensity(const Real& intensity){_intensity = intensity;}
+		inline Real GetIntensity() const{return _intensity;}
+
+		inline void SetPosition(const Vector3& position){_position = position;}
+		inline Vector3 GetPosition() const{return _position;}
+
+		inline void SetEdge1(const Vector3& edge){_edge1 = edge;}
+		inline Vector3 GetEdge1() const{return _edge1;}
+
+		inline void SetEdge2(const Vector3& edge){_edge2 = edge;}
+		inline Vector3 GetEdge2() const{return _edge2;}
+
+	private:
+
+		LightImp(const String& name);
+
+		friend Light CreateLight(const String& name);
+
+		String	_type;
+		Vector4	_color;
+		Real	_intensity;
+		Vector3	_position;
+		Vector3	_edge1;
+		Vector3	_edge2;
+
+	public:
+		EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+	};
+
+};
+
+#endif
\ No newline at end of file
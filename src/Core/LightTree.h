@@ -0,0 +1,255 @@
+/********************************************************/
+// FILE: LightTree.h
+// DESCRIPTION: Bounding volume hierarchy over light sources
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_LIGHT_TREE_GUARD
+#define RAYTRACE_LIGHT_TREE_GUARD
+
+#include <RaytraceCommon.h>
+#include "MathHelper.h"
+#include <vector>
+#include <algorithm>
+
+namespace Raytrace {
+
+// Light hierarchy along the lines of Conty Estevez and Kulla, "Importance Sampling of
+// Many Lights with Adaptive Tree Splitting". Every node bounds the positions and the
+// emission directions of its lights and stores their total power. Sampling walks from
+// the root to a single light, choosing each child in proportion to a conservative
+// estimate of its contribution at the receiving point, so the cost is O(log n) and a
+// light that can contribute is never given probability zero.
+struct LightTree
+{
+	// what the tree needs to know about a light, cosSpread bounds the surface normals around
+	// axis and light leaves within 90 degrees of a normal, -1 for lights that shine everywhere
+	struct Emitter
+	{
+		Vector3		_min,_max;
+		Vector3		_axis;
+		Real		_cosSpread;
+		Real		_power;
+	};
+
+	static const u32 InvalidEmitter = 0xffffffff;
+
+	// nodes are stored depth first, the first child directly follows its parent
+	struct Node
+	{
+		Vector3		_min,_max;
+		Vector3		_axis;
+		Real		_cosSpread;
+		Real		_power;
+		u32			_secondChild;
+		u32			_emitter;		// InvalidEmitter for inner nodes
+	};
+
+	void build(const std::vector<Emitter>& emitters)
+	{
+		_nodes.clear();
+
+		if(emitters.empty())
+			return;
+
+		_nodes.reserve(emitters.size()*2 - 1);
+
+		std::vector<u32> indices(emitters.size());
+		for(size_t i = 0; i < indices.size(); ++i)
+			indices[i] = (u32)i;
+
+		buildNode(emitters,indices.begin(),indices.end());
+	}
+
+	inline bool empty() const
+	{
+		return _nodes.empty();
+	}
+
+	// picks an emitter for a receiver at location, pmf is the probability it was picked with,
+	// fails if no emitter can reach the location
+	inline bool sample(const Vector3& location,Real random,size_t& emitter,Real& pmf) const
+	{
+		if(_nodes.empty() || !(importance(_nodes[0],location) > 0.0f))
+			return false;
+
+		size_t current = 0;
+		pmf = 1.0f;
+
+		while(_nodes[current]._emitter == InvalidEmitter)
+		{
+			const size_t first = current + 1;
+			const size_t second = _nodes[current]._secondChild;
+
+			const Real importanceFirst = importance(_nodes[first],location);
+			const Real importanceSecond = importance(_nodes[second],location);
+			const Real total = importanceFirst + importanceSecond;
+
+			if(!(total > 0.0f))
+				return false;
+
+			const Real probabilityFirst = importanceFirst / total;
+
+			// reuse the remaining range of the random number for the next level
+			if(random < probabilityFirst)
+			{
+				random = random / probabilityFirst;
+				pmf *= probabilityFirst;
+				current = first;
+			}
+			else
+			{
+				random = (random - probabilityFirst) / (1.0f - probabilityFirst);
+				pmf *= 1.0f - probabilityFirst;
+				current = second;
+			}
+			random = std::min<Real>(random,1.0f - std::numeric_limits<Real>::epsilon());
+		}
+
+		emitter = _nodes[current]._emitter;
+		return pmf > 0.0f;
+	}
+
+private:
+
+	// power over squared distance, scaled by the cosine of the smallest possible angle between
+	// a normal and the direction to the location, zero past 90 degrees.
+	// Bounds that contain the location count as near.
+	static inline Real importance(const Node& node,const Vector3& location)
+	{
+		const Vector3 center = (node._min + node._max) * 0.5f;
+		const Vector3 toLocation = location - center;
+		const Real distanceSq = toLocation.squaredNorm();
+		const Real radiusSq = (node._max - node._min).squaredNorm() * 0.25f;
+
+		Real cosTheta = 1.0f;
+
+		if(node._cosSpread > -1.0f && distanceSq > radiusSq)
+		{
+			const Real distance = sqrt(distanceSq);
+			const Real theta = acosf(std::max<Real>(-1.0f,std::min<Real>(1.0f,node._axis.dot(toLocation) / distance)));
+			const Real thetaSpread = acosf(node._cosSpread);
+			const Real thetaBounds = asinf(std::min<Real>(1.0f,sqrt(radiusSq / distanceSq)));
+
+			const Real thetaMin = std::max<Real>(0.0f,theta - thetaSpread - thetaBounds);
+			if(thetaMin >= R_PI*0.5f)
+				return 0.0f;
+
+			cosTheta = cosf(thetaMin);
+		}
+
+		return node._power * cosTheta / std::max<Real>(std::max<Real>(distanceSq,radiusSq),1e-6f);
+	}
+
+	// smallest cone found by growing a toward b, every direction if they can't be combined
+	static inline void mergeCones(const Vector3& axisA,Real cosA,const Vector3& axisB,Real cosB,Vector3& axis,Real& cosSpread)
+	{
+		axis = axisA;
+		cosSpread = -1.0f;
+
+		if(cosA <= -1.0f || cosB <= -1.0f)
+			return;
+
+		const Real thetaA = acosf(cosA);
+		const Real thetaB = acosf(cosB);
+		const Real thetaD = acosf(std::max<Real>(-1.0f,std::min<Real>(1.0f,axisA.dot(axisB))));
+
+		if(std::min<Real>(thetaD + thetaB,R_PI) <= thetaA)
+		{
+			cosSpread = cosA;
+			return;
+		}
+		if(std::min<Real>(thetaD + thetaA,R_PI) <= thetaB)
+		{
+			axis = axisB;
+			cosSpread = cosB;
+			return;
+		}
+
+		const Real thetaO = (thetaA + thetaD + thetaB) * 0.5f;
+		if(thetaO >= R_PI)
+			return;
+
+		Vector3 ortho = axisB - axisA * axisA.dot(axisB);
+		if(ortho.squaredNorm() <= 1e-12f)
+			return;
+		ortho.normalize();
+
+		const Real rotation = thetaO - thetaA;
+		axis = (axisA * cosf(rotation) + ortho * sinf(rotation)).normalized();
+		cosSpread = cosf(thetaO);
+	}
+
+	// median split along the widest axis of the light centers keeps the depth at log2(n)
+	u32 buildNode(const std::vector<Emitter>& emitters,std::vector<u32>::iterator begin,std::vector<u32>::iterator end)
+	{
+		const u32 index = (u32)_nodes.size();
+		_nodes.push_back(Node());
+
+		if(end - begin == 1)
+		{
+			const Emitter& e = emitters[*begin];
+			Node& node = _nodes[index];
+			node._min = e._min;
+			node._max = e._max;
+			node._axis = e._axis;
+			node._cosSpread = e._cosSpread;
+			node._power = e._power;
+			node._secondChild = 0;
+			node._emitter = *begin;
+			return index;
+		}
+
+		Vector3 centerMin = (emitters[*begin]._min + emitters[*begin]._max) * 0.5f;
+		Vector3 centerMax = centerMin;
+		for(auto it = begin; it != end; ++it)
+		{
+			const Vector3 center = (emitters[*it]._min + emitters[*it]._max) * 0.5f;
+			centerMin = centerMin.cwiseMin(center);
+			centerMax = centerMax.cwiseMax(center);
+		}
+
+		int axis;
+		(centerMax - centerMin).maxCoeff(&axis);
+
+		const std::vector<u32>::iterator middle = begin + (end - begin) / 2;
+		std::nth_element(begin,middle,end,[&emitters,axis](u32 a,u32 b)
+		{
+			return (emitters[a]._min[axis] + emitters[a]._max[axis]) < (emitters[b]._min[axis] + emitters[b]._max[axis]);
+		});
+
+		const u32 first = buildNode(emitters,begin,middle);
+		const u32 second = buildNode(emitters,middle,end);
+
+		const Node& a = _nodes[first];
+		const Node& b = _nodes[second];
+
+		Node node;
+		node._min = a._min.cwiseMin(b._min);
+		node._max = a._max.cwiseMax(b._max);
+		node._power = a._power + b._power;
+		mergeCones(a._axis,a._cosSpread,b._axis,b._cosSpread,node._axis,node._cosSpread);
+		node._secondChild = second;
+		node._emitter = InvalidEmitter;
+
+		_nodes[index] = node;
+		return index;
+	}
+
+	std::vector<Node>		_nodes;
+};
+
+}
+#endif
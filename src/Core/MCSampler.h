@@ -22,8 +22,7 @@
 #include <RaytraceCommon.h>
 #include "SamplerBase.h"
 //#include "PoissonDiscSampler.h"
-#include <boost/random/mersenne_twister.hpp>
-#include <boost/random/uniform_01.hpp>
+#include "CounterRandom.h"
 
 
 namespace Raytrace {
@@ -77,8 +76,6 @@ template<class _SampleData,class _SceneReader> struct MCSampler : public Sampler
 		InitializeSampler(numThreads,scene,sampleData,scene->getMultisampleCount());
 
 		Base::_sampleData->setSampleGenerator(this);
-				
-		_threadData.resize(numThreads);
 	}
 	
 	typename SampleData::SampleValue2DType getSampleLocation2D(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
@@ -93,8 +90,7 @@ template<class _SampleData,class _SceneReader> struct MCSampler : public Sampler
 			Vector2 current ( (float)(currentPixel.x()) * (float)Base::_pixelSize.x(), (float)(currentPixel.y()) * (float)Base::_pixelSize.y());
 			current+=_pixelSize*.5f;
 			
-			Vector2 jitter = Vector2(	_threadData[threadId]._randomUniformDistribution(_threadData[threadId]._randomGenerator),
-					_threadData[threadId]._randomUniformDistribution(_threadData[threadId]._randomGenerator));
+			Vector2 jitter = _random.Uniform2D(sample._index,(u32)random_index);
 
 			Vector2 location = current + (jitter.array() * _pixelSize.array()).matrix() - _pixelSize*.5f;
 
@@ -102,23 +98,16 @@ template<class _SampleData,class _SceneReader> struct MCSampler : public Sampler
 		}
 		else
 		{
-			return Vector2(	_threadData[threadId]._randomUniformDistribution(_threadData[threadId]._randomGenerator),
-					_threadData[threadId]._randomUniformDistribution(_threadData[threadId]._randomGenerator));
+			return _random.Uniform2D(sample._index,(u32)random_index);
 		}
 	}
 
 	typename SampleData::SampleValueType getSampleLocation(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
 	{
-		return _threadData[threadId]._randomUniformDistribution(_threadData[threadId]._randomGenerator);
+		return _random.Uniform(sample._index,(u32)random_index);
 	}
 
-	struct ThreadData
-	{
-		boost::random::uniform_01<Real,Real>	_randomUniformDistribution;
-		boost::random::mt11213b					_randomGenerator;  
-	};
-
-	std::vector<ThreadData>			_threadData;
+	CounterRandom					_random;
 	//SamplerType						_sampler;
 };
 
@@ -0,0 +1,17 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "MotionBVHIntersector.h"
+
+namespace Raytrace {
+
+template<class _RayData,class _SceneReader>
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateMotionBVHIntersector()
+{
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new MotionBVHIntersector<_RayData,_SceneReader>());
+}
+
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateMotionBVHIntersector();
+
+}
@@ -0,0 +1,571 @@
+/********************************************************/
+// FILE: MotionBVHIntersector.h
+// DESCRIPTION: Bounding volume hierarchy over linearly moving triangles
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_MOTION_BVH_INTERSECTOR_GUARD
+#define RAYTRACE_MOTION_BVH_INTERSECTOR_GUARD
+
+#include <RaytraceCommon.h>
+#include <vector>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include "AABB.h"
+#include "SIMDType.h"
+#include "RayData.h"
+#include "IIntersector.h"
+#include "Aligned.h"
+
+namespace Raytrace {
+
+// every node keeps the bounds of its children at _TimeSegments + 1 evenly spaced times of the shutter
+// interval and a ray interpolates them at its own time, so one hierarchy serves the whole interval.
+// vertices move linearly, so the interpolated bounds always contain the moving triangles
+template<class _RayData,class _SceneReader,int _TimeSegments = 4> struct MotionBVHIntersector : public IIntersector<_RayData,_SceneReader>
+{
+	typedef _RayData RayData;
+	typedef _SceneReader SceneReader;
+
+	static const size_t Width = 4;		// children per node and triangles per leaf
+	static const size_t TimeSegments = _TimeSegments;
+	static const size_t TimeKeys = TimeSegments + 1;
+	static const size_t BinCount = 16;
+	static const size_t MaxTraversalDepth = 64;
+	static const size_t MaxDepth = MaxTraversalDepth - 1;	// deepest leaf the build may create
+	static const size_t StackSize = MaxTraversalDepth * (Width - 1) + 1;
+
+	// children are node indices or leaf indices with the top bit set
+	static const u32 LeafFlag = 0x80000000;
+
+	typedef typename RayData::RayType BaseRayType;
+	typedef typename RayData::PrimitiveType BasePrimitiveType;
+
+	typedef SimdType<int,Width>	Scalari_T;
+	typedef SimdType<float,Width>	Scalar_T;
+	typedef typename Vector3v<Width>::type Vector3_T;
+	typedef std::array<AABB,TimeKeys> KeyBounds;
+
+	struct Node
+	{
+		std::array<Vector3_T,TimeKeys>	_lower;
+		std::array<Vector3_T,TimeKeys>	_upper;
+		std::array<u32,Width>			_children;
+		int								_childMask;
+	};
+
+	// the triangles when the shutter opens and how far their vertices move until it closes
+	struct Leaf
+	{
+		std::array<Vector3_T,3>	_points;
+		std::array<Vector3_T,3>	_motion;
+		Scalari_T				_ids;		// scene index plus one, 0 in unused lanes
+	};
+
+	struct BuildItem
+	{
+		AABB	_bound;			// over the whole shutter interval
+		Vector3	_centroid;		// halfway through it
+		u32		_primitive;
+	};
+
+	struct CentroidLess
+	{
+		inline CentroidLess(int axis) : _axis(axis) {}
+
+		inline bool operator()(const BuildItem& a,const BuildItem& b) const
+		{
+			return a._centroid[_axis] < b._centroid[_axis];
+		}
+
+		int	_axis;
+	};
+
+	MotionBVHIntersector() : _root(0),_rayData(nullptr)
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const SceneReader& scene,RayData& rayData)
+	{
+		const size_t num = scene->getNumPrimitives();
+
+		_nodes.clear();
+		_leaves.clear();
+		_statistics = IntersectorStatistics();
+
+		_primitives.resize(num);
+		_motion.resize(num);
+		_items.resize(num);
+
+		for(size_t i = 0; i < num; ++i)
+		{
+			int material;
+			scene->getPrimitive(i,_primitives[i],_motion[i],material);
+
+			BuildItem& item = _items[i];
+			item._bound = AABB::Empty();
+			item._centroid = Vector3(0.0f,0.0f,0.0f);
+			item._primitive = (u32)i;
+
+			for(int p = 0; p < 3; ++p)
+			{
+				item._bound = AABB(item._bound,_primitives[i].point(p));
+				item._bound = AABB(item._bound,Vector3(_primitives[i].point(p) + _motion[i][p]));
+				item._centroid += (_primitives[i].point(p) + _motion[i][p] * 0.5f) / 3.0f;
+			}
+		}
+
+		if(num > 0)
+		{
+			KeyBounds bounds;
+			_root = build(0,num,bounds,1);
+		}
+
+		_statistics._nodeCount = (u32)_nodes.size();
+		_statistics._leafCount = (u32)_leaves.size();
+		_statistics._primitiveCount = (u32)num;
+		_statistics._referenceCount = (u32)num;
+		_statistics._memoryBytes = _nodes.size() * sizeof(Node) + _leaves.size() * sizeof(Leaf);
+		if(!_leaves.empty())
+			_statistics._leafFill = (f32)num / (f32)_leaves.size();
+
+		RAY_ASSERT( _statistics._maxDepth <= MaxDepth );
+
+		// only the built hierarchy is needed from here on
+		std::vector<BasePrimitiveType>().swap(_primitives);
+		std::vector<std::array<Vector3,3>>().swap(_motion);
+		std::vector<BuildItem>().swap(_items);
+
+		_rayData = &rayData;
+	}
+
+	Result GetStatistics(IntersectorStatistics& statisticsOut) const
+	{
+		if(_leaves.empty())
+			return Result::Failed;
+
+		statisticsOut = _statistics;
+		return Result::Succeeded;
+	}
+
+	void IntersectMT(size_t threadId)
+	{
+		unsigned int prevCSR = _mm_getcsr();
+		_mm_setcsr(0xffc0);
+
+		doIntersections<AnyHitRay>(threadId);
+		doIntersections<FirstHitRay>(threadId);
+
+		_mm_setcsr(prevCSR);
+	}
+
+	// closest hit nearer than t at the ray's time, returns the primitive index plus one and updates t and bary, 0 if there is none
+	int intersectFirstHit(const BaseRayType& ray,Real& t,Vector2& bary) const
+	{
+		return traverse<false>(ray,t,bary);
+	}
+
+	bool intersectAnyHit(const BaseRayType& ray) const
+	{
+		Real t = ray.length() > .0f ? ray.length() : std::numeric_limits<Real>::infinity();
+		Vector2 bary;
+
+		return traverse<true>(ray,t,bary) != 0;
+	}
+
+private:
+
+	template<class _RayClass> inline void doIntersections(size_t threadId)
+	{
+		typename RayData::template Element<_RayClass> element;
+		while(_rayData->template popRay<_RayClass>(threadId,element))
+			processRay(element);
+	}
+
+	inline void processRay(const typename RayData::template Element<AnyHitRay>& element) const
+	{
+		(*element.resultOut) = intersectAnyHit(element.ray) ? 1 : 0;
+	}
+
+	inline void processRay(const typename RayData::template Element<FirstHitRay>& element) const
+	{
+		const BaseRayType& ray = element.ray;
+
+		Real t = ray.length() > .0f ? ray.length() : std::numeric_limits<Real>::infinity();
+		Vector2 bary;
+		const int id = intersectFirstHit(ray,t,bary);
+
+		if(id != 0)
+		{
+			if(element.absoluteIntersectionLocation)(*element.absoluteIntersectionLocation) = ray.origin()+ ray.direction()*t;
+			if(element.rayRelativeIntersectionLocation)(*element.rayRelativeIntersectionLocation) = t;
+			if(element.primitiveRelativeIntersectionLocation)(*element.primitiveRelativeIntersectionLocation) = bary;
+			if(element.primitiveIdentifier)(*element.primitiveIdentifier) = id - 1;
+		}
+		else
+		{
+			if(element.absoluteIntersectionLocation)(*element.absoluteIntersectionLocation) = Vector3(0.0f,0.0f,0.0f);
+			if(element.rayRelativeIntersectionLocation)(*element.rayRelativeIntersectionLocation) = -1.0f;
+			if(element.primitiveRelativeIntersectionLocation)(*element.primitiveRelativeIntersectionLocation) = Vector2(0.0f,0.0f);
+			if(element.primitiveIdentifier)(*element.primitiveIdentifier) = -1;
+		}
+	}
+
+	template<bool _AnyHit> int traverse(const BaseRayType& ray,Real& t,Vector2& bary) const
+	{
+		if(_leaves.empty())
+			return 0;
+
+		// the interval is cut into segments, the bounds are interpolated between the keys of one segment
+		const Real time = std::min(std::max((Real)ray.time(),0.0f),1.0f);
+		const Real scaled = time * (Real)TimeSegments;
+		const size_t segment = std::min((size_t)scaled,TimeSegments - 1);
+		const Scalar_T fraction(scaled - (Real)segment);
+		const Scalar_T rayTime(time);
+
+		Vector3_T origin,direction,invDirection;
+		for(int d = 0; d < 3; ++d)
+		{
+			origin[d] = Scalar_T(ray.origin()[d]);
+			direction[d] = Scalar_T(ray.direction()[d]);
+			invDirection[d] = Scalar_T(1.0f / ray.direction()[d]);
+		}
+
+		std::array<std::pair<Real,u32>,StackSize> stack;
+		size_t stackSize = 0;
+		stack[stackSize++] = std::make_pair(0.0f,_root);
+
+		int id = 0;
+
+		while(stackSize > 0)
+		{
+			const std::pair<Real,u32> entry = stack[--stackSize];
+
+			if(entry.first > t)
+				continue;
+
+			if(entry.second & LeafFlag)
+			{
+				if(intersectLeaf<_AnyHit>(_leaves[entry.second & ~LeafFlag],origin,direction,rayTime,t,bary,id) && _AnyHit)
+					return id;
+				continue;
+			}
+
+			const Node& node = _nodes[entry.second];
+			Scalar_T entryT = Scalar_T::Zero();
+			Scalar_T exitT(t);
+
+			for(int d = 0; d < 3; ++d)
+			{
+				const Scalar_T lower = node._lower[segment][d] + (node._lower[segment + 1][d] - node._lower[segment][d]) * fraction;
+				const Scalar_T upper = node._upper[segment][d] + (node._upper[segment + 1][d] - node._upper[segment][d]) * fraction;
+				const Scalar_T t0 = (lower - origin[d]) * invDirection[d];
+				const Scalar_T t1 = (upper - origin[d]) * invDirection[d];
+
+				// a nan from a ray in the slab plane leaves the interval as it is
+				entryT = t0.Min(t1).Max(entryT);
+				exitT = t0.Max(t1).Min(exitT);
+			}
+
+			const int hits = (entryT <= exitT).mask() & node._childMask;
+
+			// nearest child on top of the stack
+			std::array<std::pair<Real,u32>,Width> children;
+			size_t numChildren = 0;
+
+			for(size_t c = 0; c < Width; ++c)
+				if((hits >> c) & 1)
+					children[numChildren++] = std::make_pair(entryT[(int)c],node._children[c]);
+
+			std::sort(children.begin(),children.begin() + numChildren,std::greater<std::pair<Real,u32>>());
+
+			for(size_t c = 0; c < numChildren; ++c)
+				stack[stackSize++] = children[c];
+		}
+
+		return id;
+	}
+
+	// Moeller-Trumbore on the four triangles moved to the ray's time
+	template<bool _AnyHit> inline bool intersectLeaf(const Leaf& leaf,const Vector3_T& origin,const Vector3_T& direction,const Scalar_T& time,Real& t,Vector2& bary,int& id) const
+	{
+		std::array<Vector3_T,3> points;
+		for(int p = 0; p < 3; ++p)
+			for(int d = 0; d < 3; ++d)
+				points[p][d] = leaf._points[p][d] + leaf._motion[p][d] * time;
+
+		const Vector3_T e1 = points[1] - points[0];
+		const Vector3_T e2 = points[2] - points[0];
+		const Vector3_T P = direction.cross(e2);
+		const Scalar_T det = e1.dot(P);
+		const Scalar_T invDet = det.ReciprocalHighPrecision();
+
+		const Vector3_T S = origin - points[0];
+		const Scalar_T u = S.dot(P) * invDet;
+		const Vector3_T Q = S.cross(e1);
+		const Scalar_T v = direction.dot(Q) * invDet;
+		const Scalar_T hitT = e2.dot(Q) * invDet;
+
+		const Scalar_T zero = Scalar_T::Zero();
+		const int valid = ( (det != zero) & (u >= zero) & (v >= zero) & ((u + v) <= Scalar_T::One()) &
+			(hitT >= Scalar_T::Epsilon()) & (hitT < Scalar_T(t)) & (leaf._ids > Scalari_T::Zero()) ).mask();
+
+		bool found = false;
+
+		for(size_t lane = 0; lane < Width; ++lane)
+			if(((valid >> lane) & 1) && hitT[(int)lane] < t)
+			{
+				t = hitT[(int)lane];
+				bary = Vector2(u[(int)lane],v[(int)lane]);
+				id = leaf._ids[(int)lane];
+				found = true;
+
+				if(_AnyHit)
+					break;
+			}
+
+		return found;
+	}
+
+	inline AABB getKeyBound(u32 primitive,size_t key) const
+	{
+		const Real time = (Real)key / (Real)TimeSegments;
+		AABB bound = AABB::Empty();
+
+		for(int p = 0; p < 3; ++p)
+			bound = AABB(bound,Vector3(_primitives[primitive].point(p) + _motion[primitive][p] * time));
+
+		return bound;
+	}
+
+	// levels of median splits until every part fits in a leaf, each one quarters the largest part
+	static inline size_t getMedianLevels(size_t num)
+	{
+		size_t levels = 0;
+		while(num > Width)
+		{
+			num = (num + Width - 1) / Width;
+			++levels;
+		}
+		return levels;
+	}
+
+	// returns the child index of the subtree and its bounds at every key
+	u32 build(size_t begin,size_t end,KeyBounds& bounds,u32 depth)
+	{
+		bounds.fill(AABB::Empty());
+		_statistics._maxDepth = std::max(_statistics._maxDepth,depth);
+
+		if(end - begin <= Width)
+			return buildLeaf(begin,end,bounds,depth) | LeafFlag;
+
+		// once the surface area splits would leave too few levels the rest of the subtree uses median
+		// splits, so no leaf ends up deeper than the traversal stack allows
+		const bool median = depth + getMedianLevels(end - begin) >= MaxDepth;
+
+		// the largest part is split until there is one for every child
+		std::array<std::pair<size_t,size_t>,Width> parts;
+		size_t numParts = 1;
+		parts[0] = std::make_pair(begin,end);
+
+		while(numParts < Width)
+		{
+			size_t largest = 0;
+			for(size_t i = 1; i < numParts; ++i)
+				if(parts[i].second - parts[i].first > parts[largest].second - parts[largest].first)
+					largest = i;
+
+			if(parts[largest].second - parts[largest].first <= Width)
+				break;
+
+			const size_t middle = split(parts[largest].first,parts[largest].second,median);
+			parts[numParts++] = std::make_pair(middle,parts[largest].second);
+			parts[largest].second = middle;
+		}
+
+		const u32 index = (u32)_nodes.size();
+		_nodes.push_back(Node());
+		_nodes[index]._childMask = (1 << numParts) - 1;
+
+		for(size_t c = 0; c < Width; ++c)
+		{
+			KeyBounds childBounds;
+			u32 child = 0;
+
+			if(c < numParts)
+				child = build(parts[c].first,parts[c].second,childBounds,depth + 1);
+
+			// the vector may have grown while the child was built
+			Node& node = _nodes[index];
+			node._children[c] = child;
+
+			for(size_t k = 0; k < TimeKeys; ++k)
+			{
+				for(int d = 0; d < 3; ++d)
+				{
+					node._lower[k][d][(int)c] = c < numParts ? childBounds[k].min()[d] : std::numeric_limits<Real>::max();
+					node._upper[k][d][(int)c] = c < numParts ? childBounds[k].max()[d] : -std::numeric_limits<Real>::max();
+				}
+
+				if(c < numParts)
+					bounds[k] = AABB(bounds[k],childBounds[k]);
+			}
+		}
+
+		return index;
+	}
+
+	u32 buildLeaf(size_t begin,size_t end,KeyBounds& bounds,u32 depth)
+	{
+		const u32 index = (u32)_leaves.size();
+		_leaves.push_back(Leaf());
+		Leaf& leaf = _leaves.back();
+
+		++_statistics._leafDepthHistogram[std::min<size_t>(depth,IntersectorStatistics::HistogramSize - 1)];
+		++_statistics._leafFillHistogram[std::min<size_t>(end - begin,IntersectorStatistics::HistogramSize - 1)];
+
+		for(size_t lane = 0; lane < Width; ++lane)
+		{
+			const bool used = begin + lane < end;
+			const u32 primitive = used ? _items[begin + lane]._primitive : 0;
+
+			for(int p = 0; p < 3; ++p)
+				for(int d = 0; d < 3; ++d)
+				{
+					leaf._points[p][d][(int)lane] = used ? _primitives[primitive].point(p)[d] : 0.0f;
+					leaf._motion[p][d][(int)lane] = used ? _motion[primitive][p][d] : 0.0f;
+				}
+
+			leaf._ids[(int)lane] = used ? (int)primitive + 1 : 0;
+
+			if(used)
+				for(size_t k = 0; k < TimeKeys; ++k)
+					bounds[k] = AABB(bounds[k],getKeyBound(primitive,k));
+		}
+
+		return index;
+	}
+
+	// binned surface area heuristic over the shutter bounds, median split if it finds nothing or median is set
+	size_t split(size_t begin,size_t end,bool median)
+	{
+		AABB centroidBound = AABB::Empty();
+		for(size_t i = begin; i < end; ++i)
+			centroidBound = AABB(centroidBound,_items[i]._centroid);
+
+		const Vector3 extent = centroidBound.max() - centroidBound.min();
+		int axis = 0;
+		if(extent.y() > extent[axis])
+			axis = 1;
+		if(extent.z() > extent[axis])
+			axis = 2;
+
+		const size_t middle = (begin + end) / 2;
+
+		if(extent[axis] <= 0.0f)
+			return middle;
+
+		if(median)
+		{
+			std::nth_element(_items.begin() + begin,_items.begin() + middle,_items.begin() + end,CentroidLess(axis));
+			return middle;
+		}
+
+		const Real scale = (Real)BinCount / extent[axis];
+		const Real offset = centroidBound.min()[axis];
+
+		std::array<AABB,BinCount> binBounds;
+		std::array<size_t,BinCount> binCounts;
+		binBounds.fill(AABB::Empty());
+		binCounts.fill(0);
+
+		for(size_t i = begin; i < end; ++i)
+		{
+			const size_t bin = getBin(_items[i]._centroid[axis],offset,scale);
+			binBounds[bin] = AABB(binBounds[bin],_items[i]._bound);
+			++binCounts[bin];
+		}
+
+		std::array<Real,BinCount> rightCost;
+		AABB right = AABB::Empty();
+		size_t rightCount = 0;
+
+		for(size_t b = BinCount - 1; b > 0; --b)
+		{
+			right = AABB(right,binBounds[b]);
+			rightCount += binCounts[b];
+			rightCost[b] = rightCount > 0 ? right.SAH() * (Real)rightCount : std::numeric_limits<Real>::infinity();
+		}
+
+		AABB left = AABB::Empty();
+		size_t leftCount = 0;
+		Real bestCost = std::numeric_limits<Real>::infinity();
+		size_t bestBin = 0;
+
+		for(size_t b = 1; b < BinCount; ++b)
+		{
+			left = AABB(left,binBounds[b - 1]);
+			leftCount += binCounts[b - 1];
+
+			if(leftCount == 0)
+				continue;
+
+			const Real cost = left.SAH() * (Real)leftCount + rightCost[b];
+			if(cost < bestCost)
+			{
+				bestCost = cost;
+				bestBin = b;
+			}
+		}
+
+		if(bestBin != 0)
+		{
+			const size_t split = std::partition(_items.begin() + begin,_items.begin() + end,
+				[&](const BuildItem& item) { return getBin(item._centroid[axis],offset,scale) < bestBin; }) - _items.begin();
+
+			if(split != begin && split != end)
+				return split;
+		}
+
+		std::nth_element(_items.begin() + begin,_items.begin() + middle,_items.begin() + end,CentroidLess(axis));
+
+		return middle;
+	}
+
+	static inline size_t getBin(Real location,Real offset,Real scale)
+	{
+		return std::min((size_t)std::max((location - offset) * scale,0.0f),BinCount - 1);
+	}
+
+	std::vector<Node,AlignedAllocator<Node>>	_nodes;
+	std::vector<Leaf,AlignedAllocator<Leaf>>	_leaves;
+	u32											_root;
+	IntersectorStatistics						_statistics;
+
+	// only while building
+	std::vector<BasePrimitiveType>				_primitives;
+	std::vector<std::array<Vector3,3>>			_motion;
+	std::vector<BuildItem>						_items;
+
+	RayData*									_rayData;
+	public:
+		EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include "headers.h"
+#include <RaytraceCommon.h>
+#include "Engines.h"
+
+#include "BVHIntersector.h"
+#include "OutOfCoreIntersector.h"
+
+namespace Raytrace {
+
+template<class _RayData,class _SceneReader>
+typename boost::shared_ptr<IIntersector<_RayData,_SceneReader>> CreateOutOfCoreIntersector()
+{
+	typedef BVHIntersector<_RayData,_SceneReader,4,1,1> Chunk;
+
+	return boost::shared_ptr<IIntersector<_RayData,_SceneReader>>(new OutOfCoreIntersector<_RayData,_SceneReader,Chunk>());
+}
+
+template boost::shared_ptr<IIntersector<DefaultEngine::RayData,DefaultEngine::SceneReader>>	CreateOutOfCoreIntersector();
+
+}
@@ -0,0 +1,595 @@
+/********************************************************/
+// FILE: OutOfCoreIntersector.h
+// DESCRIPTION: Intersector paging spatial chunks of the scene in and out of a bounded cache
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_OUT_OF_CORE_INTERSECTOR_GUARD
+#define RAYTRACE_OUT_OF_CORE_INTERSECTOR_GUARD
+
+#include <RaytraceCommon.h>
+#include <vector>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/fusion/include/map.hpp>
+#include <boost/fusion/include/at_key.hpp>
+#include "AABB.h"
+#include "RayData.h"
+#include "IIntersector.h"
+
+namespace Raytrace {
+
+// the scene is cut into spatial chunks, each with its own hierarchy in the BVH cache, and only
+// as many chunks as fit the budget stay resident. rays are walked through the chunks they enter
+// front to back, a ray reaching a chunk that is paged out waits until the end of the intersect
+// pass, where the chunks are paged in one at a time, most waiting rays first. a chunk's hierarchy
+// is built the first time a ray reaches it and read back from the cache after that.
+// only the hierarchies are paged, along with the copies of the primitives in their leafs. the scene
+// reader and the shading data of the integrator still hold every primitive, so this bounds the memory
+// of the acceleration structure, not of the scene
+template<class _RayData,class _SceneReader,class _ChunkIntersector> struct OutOfCoreIntersector : public IIntersector<_RayData,_SceneReader>
+{
+	typedef _RayData RayData;
+	typedef _SceneReader SceneReader;
+	typedef _ChunkIntersector ChunkIntersector;
+
+	typedef typename RayData::RayType BaseRayType;
+	typedef typename RayData::PrimitiveType BasePrimitiveType;
+	typedef typename ChunkIntersector::BaseVolumeType Volume;
+
+	struct Chunk
+	{
+		inline Chunk() : _built(false),_key(0),_memoryBytes(0),_lastUse(0)
+		{
+		}
+
+		std::vector<u32>					_primitives;	// scene indices, hits are mapped back through these
+		Volume								_bound;
+		bool								_built;			// _key and _memoryBytes are only valid once built
+		u64									_key;			// the chunk's hierarchy in the BVH cache
+		u64									_memoryBytes;
+		u64									_lastUse;
+		boost::shared_ptr<ChunkIntersector>	_intersector;	// empty while paged out
+	};
+
+	// binary tree over the chunk bounds, the partition's median splits, rays only test the chunks it reaches
+	struct ChunkNode
+	{
+		static const u32 Inner = (u32)-1;
+
+		Volume				_bound;
+		std::array<u32,2>	_children;
+		u32					_chunk;		// Inner for nodes with children
+	};
+
+	// every split halves the primitives, so the tree is never deeper than the bits of a primitive index
+	static const size_t MaxChunkDepth = 33;
+
+	// a ray in the middle of its walk, _position is the next entry of its front to back chunk order
+	template<class _RayClass> struct PendingRay
+	{
+		inline PendingRay()
+		{
+		}
+
+		inline PendingRay(const typename RayData::template Element<_RayClass>& element) : _element(element),_chunk(0),_position(0),_id(0)
+		{
+			_t = element.ray.length() > .0f ? element.ray.length() : std::numeric_limits<Real>::infinity();
+		}
+
+		typename RayData::template Element<_RayClass>	_element;
+		u32												_chunk;		// the chunk it waits for
+		u32												_position;
+		Real											_t;
+		Vector2											_bary;
+		int												_id;		// scene index plus one, 0 without a hit
+	};
+
+	struct Centroid
+	{
+		Vector3	_location;
+		u32		_primitive;
+	};
+
+	struct CentroidLess
+	{
+		inline CentroidLess(int axis) : _axis(axis) {}
+
+		inline bool operator()(const Centroid& a,const Centroid& b) const
+		{
+			return a._location[_axis] < b._location[_axis];
+		}
+
+		int	_axis;
+	};
+
+	typedef std::vector<std::pair<Real,u32>> ChunkOrder;
+
+	typedef boost::fusion::map<
+				std::pair<AnyHitRay,std::vector<std::vector<PendingRay<AnyHitRay>>>>,
+				std::pair<FirstHitRay,std::vector<std::vector<PendingRay<FirstHitRay>>>>
+	> WaitingRays;
+
+	typedef boost::fusion::map<
+				std::pair<AnyHitRay,std::vector<PendingRay<AnyHitRay>>>,
+				std::pair<FirstHitRay,std::vector<PendingRay<FirstHitRay>>>
+	> RayBatch;
+
+	OutOfCoreIntersector() : _chunkPrimitives(1),_residentBytes(0),_usedBytes(0),_useCount(0),_numThreads(1)
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const SceneReader& scene,RayData& rayData)
+	{
+		_scene = scene;
+		_rayData = &rayData;
+		_numThreads = numThreads;
+		_cacheDirectory = scene->getCacheDirectory();
+		_chunkPrimitives = std::max<size_t>(scene->getOutOfCoreChunkPrimitives(),1);
+		_residentBytes = scene->getOutOfCoreResidentBytes();
+
+		RAY_ASSERT( !_cacheDirectory.empty() );
+
+		_chunks.clear();
+		_nodes.clear();
+		_statistics = IntersectorStatistics();
+		_usedBytes = 0;
+
+		// no hierarchy is built here, a chunk's is built when the first ray waits for it
+		if(scene->getNumPrimitives() > 0)
+		{
+			std::vector<Centroid> centroids(scene->getNumPrimitives());
+			for(size_t i = 0; i < centroids.size(); ++i)
+			{
+				BasePrimitiveType primitive;
+				int material;
+				_scene->getPrimitive(i,primitive,material);
+
+				centroids[i]._location = getShapeCentroid(primitive);
+				centroids[i]._primitive = (u32)i;
+			}
+
+			partition(centroids,0,centroids.size(),0);
+		}
+
+		_order.resize(numThreads);
+		fusion::at_key<AnyHitRay>(_waiting).resize(numThreads);
+		fusion::at_key<FirstHitRay>(_waiting).resize(numThreads);
+	}
+
+	bool SupportsAnalyticPrimitives() const
+	{
+		return ChunkIntersector::AnalyticPrimitives;
+	}
+
+	bool RequiresCacheDirectory() const
+	{
+		return true;
+	}
+
+	// only covers the chunks built so far
+
+	Result GetStatistics(IntersectorStatistics& statisticsOut) const
+	{
+		if(_chunks.empty())
+			return Result::Failed;
+
+		statisticsOut = _statistics;
+		return Result::Succeeded;
+	}
+
+	void IntersectMT(size_t threadId)
+	{
+		unsigned int prevCSR = _mm_getcsr();
+		_mm_setcsr(0xffc0);
+
+		doIntersections<AnyHitRay>(threadId);
+		doIntersections<FirstHitRay>(threadId);
+
+		_mm_setcsr(prevCSR);
+	}
+
+	void IntersectCompleteST()
+	{
+		std::vector<size_t> waiting(_chunks.size());
+
+		while(true)
+		{
+			std::fill(waiting.begin(),waiting.end(),0);
+			countWaiting<AnyHitRay>(waiting);
+			countWaiting<FirstHitRay>(waiting);
+
+			const size_t chunk = std::max_element(waiting.begin(),waiting.end()) - waiting.begin();
+			if(chunk == waiting.size() || waiting[chunk] == 0)
+				break;
+
+			makeResident(chunk);
+
+			collectBatch<AnyHitRay>((u32)chunk);
+			collectBatch<FirstHitRay>((u32)chunk);
+
+			boost::thread_group threads;
+			for(size_t t = 0; t < _numThreads; ++t)
+				threads.create_thread(boost::bind(&OutOfCoreIntersector::continueBatchMT,this,t));
+			threads.join_all();
+		}
+	}
+
+private:
+
+	// median splits along the longest axis of the centroids until every part fits in a chunk,
+	// returns the node of the chunk tree covering the range
+	u32 partition(std::vector<Centroid>& centroids,size_t begin,size_t end,size_t depth)
+	{
+		RAY_ASSERT( depth < MaxChunkDepth );
+
+		const u32 index = (u32)_nodes.size();
+		_nodes.push_back(ChunkNode());
+
+		if(end - begin <= _chunkPrimitives)
+		{
+			Chunk chunk;
+			chunk._bound = Volume::Empty();
+			chunk._primitives.reserve(end - begin);
+
+			for(size_t i = begin; i < end; ++i)
+			{
+				BasePrimitiveType primitive;
+				int material;
+				_scene->getPrimitive(centroids[i]._primitive,primitive,material);
+
+				Vector3 lower,upper;
+				getShapeBounds(primitive,lower,upper);
+				chunk._bound = Volume(chunk._bound,Volume(lower,upper));
+				chunk._primitives.push_back(centroids[i]._primitive);
+			}
+
+			_nodes[index]._bound = chunk._bound;
+			_nodes[index]._chunk = (u32)_chunks.size();
+			_chunks.push_back(chunk);
+			return index;
+		}
+
+		Volume bound(centroids[begin]._location,centroids[begin]._location);
+		for(size_t i = begin + 1; i < end; ++i)
+			bound = Volume(bound,centroids[i]._location);
+
+		const Vector3 extent = bound.max() - bound.min();
+		int axis = 0;
+		if(extent.y() > extent[axis])
+			axis = 1;
+		if(extent.z() > extent[axis])
+			axis = 2;
+
+		const size_t middle = (begin + end) / 2;
+		std::nth_element(centroids.begin() + begin,centroids.begin() + middle,centroids.begin() + end,CentroidLess(axis));
+
+		const u32 left = partition(centroids,begin,middle,depth + 1);
+		const u32 right = partition(centroids,middle,end,depth + 1);
+
+		_nodes[index]._bound = Volume(_nodes[left]._bound,_nodes[right]._bound);
+		_nodes[index]._children[0] = left;
+		_nodes[index]._children[1] = right;
+		_nodes[index]._chunk = ChunkNode::Inner;
+		return index;
+	}
+
+	inline SceneReader getChunkScene(const Chunk& chunk) const
+	{
+		return SceneReader(new typename SceneReader::element_type(*_scene,chunk._primitives));
+	}
+
+	// pages chunks out, least recently used first, until the given amount fits the budget
+	void evict(u64 requiredBytes)
+	{
+		while(_usedBytes + requiredBytes > _residentBytes)
+		{
+			Chunk* oldest = nullptr;
+
+			for(size_t i = 0; i < _chunks.size(); ++i)
+				if(_chunks[i]._intersector && (!oldest || _chunks[i]._lastUse < oldest->_lastUse))
+					oldest = &_chunks[i];
+
+			if(!oldest)
+				break;
+
+			oldest->_intersector.reset();
+			_usedBytes -= oldest->_memoryBytes;
+		}
+	}
+
+	// builds the chunk's hierarchy the first time, maps it back in from the cache after that
+	// and only rebuilds it if the cache lost it
+	void makeResident(size_t i)
+	{
+		Chunk& chunk = _chunks[i];
+		chunk._lastUse = ++_useCount;
+
+		if(chunk._intersector)
+			return;
+
+		boost::shared_ptr<ChunkIntersector> intersector(new ChunkIntersector());
+
+		if(chunk._built)
+		{
+			evict(chunk._memoryBytes);
+
+			if(!intersector->loadScene(_cacheDirectory,chunk._key))
+			{
+				Volume bound;
+				chunk._key = intersector->buildScene(_numThreads,getChunkScene(chunk),bound);
+			}
+		}
+		else
+		{
+			IntersectorStatistics statistics;
+			Volume bound;
+
+			chunk._key = intersector->buildScene(_numThreads,getChunkScene(chunk),bound);
+			intersector->GetStatistics(statistics);
+			chunk._memoryBytes = statistics._memoryBytes;
+			chunk._built = true;
+
+			accumulateStatistics(statistics);
+			evict(chunk._memoryBytes);
+		}
+
+		chunk._intersector = intersector;
+		_usedBytes += chunk._memoryBytes;
+	}
+
+	void accumulateStatistics(const IntersectorStatistics& statistics)
+	{
+		_statistics._memoryBytes += statistics._memoryBytes;
+		_statistics._nodeCount += statistics._nodeCount;
+		_statistics._leafCount += statistics._leafCount;
+		_statistics._primitiveCount += statistics._primitiveCount;
+		_statistics._referenceCount += statistics._referenceCount;
+		_statistics._maxDepth = std::max(_statistics._maxDepth,statistics._maxDepth);
+
+		for(size_t i = 0; i < IntersectorStatistics::HistogramSize; ++i)
+		{
+			_statistics._leafDepthHistogram[i] += statistics._leafDepthHistogram[i];
+			_statistics._leafFillHistogram[i] += statistics._leafFillHistogram[i];
+		}
+
+		if(_statistics._leafCount > 0)
+			_statistics._leafFill = (f32)_statistics._referenceCount / (f32)_statistics._leafCount;
+	}
+
+	static inline bool intersectBound(const Volume& bound,const BaseRayType& ray,const Vector3& invDirection,Real length,Real& entry)
+	{
+		Real exit = length;
+		entry = 0.0f;
+
+		for(int d = 0; d < 3; ++d)
+		{
+			Real t0 = (bound.min()[d] - ray.origin()[d]) * invDirection[d];
+			Real t1 = (bound.max()[d] - ray.origin()[d]) * invDirection[d];
+			if(t0 > t1)
+				std::swap(t0,t1);
+			entry = std::max(entry,t0);
+			exit = std::min(exit,t1);
+		}
+
+		return entry <= exit;
+	}
+
+	// entry distance and index of every chunk the ray passes through, nearest first
+	// the chunk tree culls the rest, so only the chunks along the ray are tested and sorted
+	void getChunkOrder(const BaseRayType& ray,ChunkOrder& order) const
+	{
+		const Vector3 invDirection(1.0f / ray.direction().x(),1.0f / ray.direction().y(),1.0f / ray.direction().z());
+		const Real length = ray.length() > .0f ? ray.length() : std::numeric_limits<Real>::infinity();
+
+		order.clear();
+
+		if(_nodes.empty())
+			return;
+
+		std::array<u32,MaxChunkDepth + 1> stack;
+		size_t stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while(stackSize > 0)
+		{
+			const ChunkNode& node = _nodes[stack[--stackSize]];
+			Real entry;
+
+			if(!intersectBound(node._bound,ray,invDirection,length,entry))
+				continue;
+
+			if(node._chunk != ChunkNode::Inner)
+				order.push_back(std::make_pair(entry,node._chunk));
+			else
+			{
+				stack[stackSize++] = node._children[0];
+				stack[stackSize++] = node._children[1];
+			}
+		}
+
+		std::sort(order.begin(),order.end());
+	}
+
+	// continues the ray's walk, false if it stopped at a chunk that is paged out
+	template<class _RayClass> bool walk(PendingRay<_RayClass>& ray,ChunkOrder& order) const
+	{
+		getChunkOrder(ray._element.ray,order);
+
+		for(; ray._position < order.size() && order[ray._position].first < ray._t; ++ray._position)
+		{
+			const Chunk& chunk = _chunks[order[ray._position].second];
+
+			if(!chunk._intersector)
+			{
+				ray._chunk = order[ray._position].second;
+				return false;
+			}
+
+			if(intersectChunk(chunk,ray))
+				return true;
+		}
+
+		return true;
+	}
+
+	// true if the walk can stop early
+	inline bool intersectChunk(const Chunk& chunk,PendingRay<AnyHitRay>& ray) const
+	{
+		if(!chunk._intersector->intersectAnyHit(ray._element.ray))
+			return false;
+
+		ray._id = 1;
+		return true;
+	}
+
+	inline bool intersectChunk(const Chunk& chunk,PendingRay<FirstHitRay>& ray) const
+	{
+		const int id = chunk._intersector->intersectFirstHit(ray._element.ray,ray._t,ray._bary);
+
+		if(id != 0)
+			ray._id = (int)chunk._primitives[id - 1] + 1;
+
+		return false;
+	}
+
+	inline void complete(const PendingRay<AnyHitRay>& ray) const
+	{
+		(*ray._element.resultOut) = ray._id != 0 ? 1 : 0;
+	}
+
+	inline void complete(const PendingRay<FirstHitRay>& ray) const
+	{
+		const typename RayData::template Element<FirstHitRay>& element = ray._element;
+
+		if(ray._id != 0)
+		{
+			if(element.absoluteIntersectionLocation)(*element.absoluteIntersectionLocation) = element.ray.origin()+ element.ray.direction()*ray._t;
+			if(element.rayRelativeIntersectionLocation)(*element.rayRelativeIntersectionLocation) = ray._t;
+			if(element.primitiveRelativeIntersectionLocation)(*element.primitiveRelativeIntersectionLocation) = ray._bary;
+			if(element.primitiveIdentifier)(*element.primitiveIdentifier) = ray._id - 1;
+		}
+		else
+		{
+			if(element.absoluteIntersectionLocation)(*element.absoluteIntersectionLocation) = Vector3(0.0f,0.0f,0.0f);
+			if(element.rayRelativeIntersectionLocation)(*element.rayRelativeIntersectionLocation) = -1.0f;
+			if(element.primitiveRelativeIntersectionLocation)(*element.primitiveRelativeIntersectionLocation) = Vector2(0.0f,0.0f);
+			if(element.primitiveIdentifier)(*element.primitiveIdentifier) = -1;
+		}
+	}
+
+	template<class _RayClass> inline void continueRay(size_t threadId,PendingRay<_RayClass>& ray)
+	{
+		if(walk(ray,_order[threadId]))
+			complete(ray);
+		else
+			fusion::at_key<_RayClass>(_waiting)[threadId].push_back(ray);
+	}
+
+	template<class _RayClass> inline void doIntersections(size_t threadId)
+	{
+		typename RayData::template Element<_RayClass> element;
+		while(_rayData->template popRay<_RayClass>(threadId,element))
+		{
+			PendingRay<_RayClass> ray(element);
+			continueRay(threadId,ray);
+		}
+	}
+
+	template<class _RayClass> void countWaiting(std::vector<size_t>& waiting) const
+	{
+		const std::vector<std::vector<PendingRay<_RayClass>>>& queues = fusion::at_key<_RayClass>(_waiting);
+
+		for(size_t t = 0; t < queues.size(); ++t)
+			for(size_t i = 0; i < queues[t].size(); ++i)
+				++waiting[queues[t][i]._chunk];
+	}
+
+	template<class _RayClass> struct WaitsForOtherChunk
+	{
+		inline WaitsForOtherChunk(u32 chunk) : _chunk(chunk) {}
+
+		inline bool operator()(const PendingRay<_RayClass>& ray) const
+		{
+			return ray._chunk != _chunk;
+		}
+
+		u32	_chunk;
+	};
+
+	// moves the rays waiting for the chunk out of the per thread queues
+	template<class _RayClass> void collectBatch(u32 chunk)
+	{
+		std::vector<std::vector<PendingRay<_RayClass>>>& queues = fusion::at_key<_RayClass>(_waiting);
+		std::vector<PendingRay<_RayClass>>& batch = fusion::at_key<_RayClass>(_batch);
+
+		batch.clear();
+
+		for(size_t t = 0; t < queues.size(); ++t)
+		{
+			auto first = std::partition(queues[t].begin(),queues[t].end(),WaitsForOtherChunk<_RayClass>(chunk));
+			batch.insert(batch.end(),first,queues[t].end());
+			queues[t].erase(first,queues[t].end());
+		}
+	}
+
+	template<class _RayClass> inline void continueBatch(size_t threadId)
+	{
+		std::vector<PendingRay<_RayClass>>& batch = fusion::at_key<_RayClass>(_batch);
+
+		const size_t begin = batch.size() * threadId / _numThreads;
+		const size_t end = batch.size() * (threadId + 1) / _numThreads;
+
+		for(size_t i = begin; i < end; ++i)
+			continueRay(threadId,batch[i]);
+	}
+
+	void continueBatchMT(size_t threadId)
+	{
+		unsigned int prevCSR = _mm_getcsr();
+		_mm_setcsr(0xffc0);
+
+		continueBatch<AnyHitRay>(threadId);
+		continueBatch<FirstHitRay>(threadId);
+
+		_mm_setcsr(prevCSR);
+	}
+
+	size_t					_chunkPrimitives;
+	u64						_residentBytes;
+	u64						_usedBytes;
+	u64						_useCount;
+	size_t					_numThreads;
+
+	SceneReader				_scene;
+	String					_cacheDirectory;
+	std::vector<Chunk>		_chunks;
+	std::vector<ChunkNode>	_nodes;			// root first
+	IntersectorStatistics	_statistics;
+
+	std::vector<ChunkOrder>	_order;			// per thread scratch
+	WaitingRays				_waiting;		// per thread, rays stopped at a chunk that is paged out
+	RayBatch				_batch;			// rays continuing in the chunk paged in last
+
+	RayData*				_rayData;
+};
+
+}
+
+#endif
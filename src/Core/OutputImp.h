@@ -39,7 +39,13 @@ namespace Raytrace {
 				("Intersector",Property(&OutputImp::GetIntersector,&OutputImp::SetIntersector))
 				("Integrator",Property(&OutputImp::GetIntegrator,&OutputImp::SetIntegrator))
 				("Sampler",Property(&OutputImp::GetSampler,&OutputImp::SetSampler))
-				("Engine",Property(&OutputImp::GetEngine,&OutputImp::SetEngine));
+				("Engine",Property(&OutputImp::GetEngine,&OutputImp::SetEngine))
+				(SceneReaderProperty_CacheDirectory,Property(&OutputImp::GetCacheDirectory,&OutputImp::SetCacheDirectory))
+				(SceneReaderProperty_Deterministic,Property(&OutputImp::GetDeterministic,&OutputImp::SetDeterministic))
+				(SceneReaderProperty_PixelFilter,Property(&OutputImp::GetPixelFilter,&OutputImp::SetPixelFilter))
+				(SceneReaderProperty_IntersectorStatistics,Property(&OutputImp::GetIntersectorStatistics,&OutputImp::SetIntersectorStatistics))
+				(SceneReaderProperty_OutOfCoreChunkPrimitives,Property(&OutputImp::GetOutOfCoreChunkPrimitives,&OutputImp::SetOutOfCoreChunkPrimitives))
+				(SceneReaderProperty_OutOfCoreMemory,Property(&OutputImp::GetOutOfCoreMemory,&OutputImp::SetOutOfCoreMemory));
 			return set;
 		}
 
@@ -81,6 +87,30 @@ namespace Raytrace {
 		inline int GetNumSamplers() const { return (int)DefaultEngine::getSamplerNames().size(); }
 		inline String GetSamplerName(int i) const { return DefaultEngine::getSamplerNames()[i]; }
 
+		//property CacheDirectory/string, empty disables on disk caching
+		inline void SetCacheDirectory(const String& directory) { _cacheDirectory = directory; }
+		inline String GetCacheDirectory() const { return _cacheDirectory; }
+
+		//property Deterministic/bool, accumulates samples in a fixed order so renders are bit reproducible
+		inline void SetDeterministic(const bool& deterministic) { _deterministic = deterministic; }
+		inline bool GetDeterministic() const { return _deterministic; }
+
+		//property PixelFilter/String, reconstruction filter: Box, Gaussian, Mitchell or Blackman-Harris
+		inline void SetPixelFilter(const String& filter) { _pixelFilter = filter; }
+		inline String GetPixelFilter() const { return _pixelFilter; }
+
+		//property IntersectorStatistics/bool, replays probe rays after the build to measure traversal cost per ray
+		inline void SetIntersectorStatistics(const bool& statistics) { _intersectorStatistics = statistics; }
+		inline bool GetIntersectorStatistics() const { return _intersectorStatistics; }
+
+		//property OutOfCoreChunkPrimitives/u32, primitives per separately paged hierarchy of the out of core intersector
+		inline void SetOutOfCoreChunkPrimitives(const u32& primitives) { _outOfCoreChunkPrimitives = primitives; }
+		inline u32 GetOutOfCoreChunkPrimitives() const { return _outOfCoreChunkPrimitives; }
+
+		//property OutOfCoreMemory/u32, megabytes of hierarchy the out of core intersector keeps resident
+		inline void SetOutOfCoreMemory(const u32& megabytes) { _outOfCoreMemory = megabytes; }
+		inline u32 GetOutOfCoreMemory() const { return _outOfCoreMemory; }
+
 	private:
 
 		typedef ObjectImp<OutputImp,IOutput> Base;
@@ -89,8 +119,15 @@ namespace Raytrace {
 		String	_integrator;
 		String	_intersector;
 		String	_sampler;
+		String	_cacheDirectory;
+		String	_pixelFilter;
 
 		bool	_enabled;
+		bool	_deterministic;
+		bool	_intersectorStatistics;
+
+		u32		_outOfCoreChunkPrimitives;
+		u32		_outOfCoreMemory;
 
 		IMAGE_FORMAT _outputFormat;
 		size_t	_xResOut;
@@ -0,0 +1,153 @@
+/********************************************************/
+// FILE: PixelFilter.h
+// DESCRIPTION: Separable pixel reconstruction filters
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)
+/********************************************************/
+// This work is licensed under the Creative Commons
+// Attribution-NonCommercial 3.0 Unported License.
+// To view a copy of this license, visit
+// http://creativecommons.org/licenses/by-nc/3.0/ or send
+// a letter to Creative Commons, 444 Castro Street,
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_PIXEL_FILTER_GUARD
+#define RAYTRACE_PIXEL_FILTER_GUARD
+
+#include <RaytraceCommon.h>
+#include "MathHelper.h"
+#include <array>
+
+namespace Raytrace {
+
+static const String		PixelFilter_Box("Box");
+static const String		PixelFilter_Gaussian("Gaussian");
+static const String		PixelFilter_Mitchell("Mitchell");
+static const String		PixelFilter_BlackmanHarris("Blackman-Harris");
+
+// A filter f(x)*f(y) with radius in pixels, f is tabulated once over [0,radius]
+// so splatting a sample costs a table lookup per footprint row and column.
+struct PixelFilter
+{
+	static const size_t TableSize = 64;
+	// footprint of the widest filter, in pixels on either side of the sample's pixel
+	static const int MaxRadius = 2;
+
+	inline PixelFilter()
+	{
+		Initialize(PixelFilter_Box);
+	}
+
+	// unknown names fall back to the box filter
+	void Initialize(const String& name)
+	{
+		_name = name;
+
+		if(name == PixelFilter_Gaussian)
+			Tabulate(1.5f,&Gaussian);
+		else if(name == PixelFilter_Mitchell)
+			Tabulate(2.0f,&Mitchell);
+		else if(name == PixelFilter_BlackmanHarris)
+			Tabulate(2.0f,&BlackmanHarris);
+		else
+		{
+			_name = PixelFilter_Box;
+			Tabulate(0.5f,&Box);
+		}
+	}
+
+	// the box filter only covers the sample's own pixel, no splatting necessary
+	inline bool isBox() const
+	{
+		return _name == PixelFilter_Box;
+	}
+
+	inline const String& name() const
+	{
+		return _name;
+	}
+
+	inline Real radius() const
+	{
+		return _radius;
+	}
+
+	// one over the integral of f(x)*f(y), scales splats that are summed rather than averaged
+	inline Real normalization() const
+	{
+		return _normalization;
+	}
+
+	// distance in pixels from the sample to the pixel center
+	inline Real operator()(Real distance) const
+	{
+		const size_t entry = (size_t)(fabs(distance) * _tableScale);
+		return (entry < TableSize) ? _table[entry] : 0.0f;
+	}
+
+private:
+
+	typedef Real (*FilterFunction)(Real x,Real radius);
+
+	void Tabulate(Real radius,FilterFunction function)
+	{
+		_radius = radius;
+		_tableScale = (Real)TableSize / radius;
+
+		Real integral = 0.0f;
+		for(size_t i = 0; i < TableSize; ++i)
+		{
+			_table[i] = function(((Real)i + 0.5f) * radius / (Real)TableSize,radius);
+			integral += 2.0f * _table[i] * radius / (Real)TableSize;
+		}
+		_normalization = 1.0f / (integral * integral);
+	}
+
+	static Real Box(Real x,Real radius)
+	{
+		return 1.0f;
+	}
+
+	// shifted down so it reaches zero at the radius
+	static Real Gaussian(Real x,Real radius)
+	{
+		const Real alpha = 2.0f;
+		return std::max<Real>(0.0f,exp(-alpha*x*x) - exp(-alpha*radius*radius));
+	}
+
+	// Mitchell-Netravali with B = C = 1/3, defined over [0,2]
+	static Real Mitchell(Real x,Real radius)
+	{
+		const Real B = 1.0f/3.0f;
+		const Real C = 1.0f/3.0f;
+		x = 2.0f * x / radius;
+
+		if(x < 1.0f)
+			return ((12.0f - 9.0f*B - 6.0f*C)*x*x*x + (-18.0f + 12.0f*B + 6.0f*C)*x*x + (6.0f - 2.0f*B)) / 6.0f;
+		else if(x < 2.0f)
+			return ((-B - 6.0f*C)*x*x*x + (6.0f*B + 30.0f*C)*x*x + (-12.0f*B - 48.0f*C)*x + (8.0f*B + 24.0f*C)) / 6.0f;
+		else
+			return 0.0f;
+	}
+
+	// four term Blackman-Harris window spanning [-radius,radius]
+	static Real BlackmanHarris(Real x,Real radius)
+	{
+		const Real t = 2.0f * R_PI * (x + radius) / (2.0f * radius);
+		return 0.35875f - 0.48829f*cos(t) + 0.14128f*cos(2.0f*t) - 0.01168f*cos(3.0f*t);
+	}
+
+	String						_name;
+	Real						_radius;
+	Real						_tableScale;
+	Real						_normalization;
+	std::array<Real,TableSize>	_table;
+};
+
+}
+#endif
@@ -21,6 +21,7 @@ namespace Raytrace {
 	struct Tag_RaySignMode;
 	struct Tag_RayLengthMode;
 	struct Tag_RayInvDirMode;
+	struct Tag_RayTimeMode;
 	struct Tag_RayScalarType;
 	struct Tag_RayDimensions;
 
@@ -34,6 +35,9 @@ namespace Raytrace {
 	struct RayInvDirModeRuntime;
 	struct RayInvDirModePrecompute;
 
+	struct RayTimeModeStored;
+	struct RayTimeModeNone;
+
 	template<class _Type> struct RayScalarType;
 	template<int _Dimension> struct RayDimensions;
 
@@ -52,6 +56,11 @@ namespace Raytrace {
 		typedef RayInvDirModeRuntime DefaultValue;
 	};
 
+	struct Tag_RayTimeMode
+	{
+		typedef RayTimeModeNone DefaultValue;
+	};
+
 	struct Tag_RayScalarType
 	{
 		typedef RayScalarType<f32> DefaultValue;
@@ -104,6 +113,18 @@ namespace Raytrace {
 		static const bool optionsDefined = true;
 	};
 
+	// time within the shutter interval, 0 when it opens and 1 when it closes
+	struct RayTimeModeStored
+	{
+		typedef Tag_RayTimeMode Tag;
+		static const bool optionsDefined = true;
+	};
+	struct RayTimeModeNone
+	{
+		typedef Tag_RayTimeMode Tag;
+		static const bool optionsDefined = true;
+	};
+
 	template<class _Type> struct RayScalarType
 	{
 		typedef Tag_RayScalarType Tag;
@@ -397,11 +418,68 @@ namespace Raytrace {
 				return 1.0f;
 			}
 		};
+
+		//Signature
+		template<class _Options,class _TimeMode> struct RayTime;
+
+		// RayTimeModeStored
+		template<class _Options> struct RayTime<_Options,RayTimeModeStored> : public RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type>
+		{
+			typedef RayTimeModeStored TimeMode;
+			typedef RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type> Base;
+			typedef RayTime<_Options,TimeMode> ThisType;
+
+			template<class _RayBase> inline RayTime(const _RayBase& ray) : Base(ray)
+			{
+				_time = ray.time();
+			}
+
+			inline RayTime() : Base(),_time(Zero<typename Base::Scalar_T>())
+			{
+			}
+
+			inline void setTime(const typename Base::Scalar_T& time)
+			{
+				_time = time;
+			}
+
+			inline const typename Base::Scalar_T& time() const
+			{
+				return _time;
+			}
+		private:
+			typename Base::Scalar_T	_time;
+		};
+
+		// RayTimeModeNone, every ray sees the scene as it is when the shutter opens
+		template<class _Options> struct RayTime<_Options,RayTimeModeNone> : public RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type>
+		{
+			typedef RayTimeModeNone TimeMode;
+			typedef RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type> Base;
+			typedef RayTime<_Options,TimeMode> ThisType;
+
+			template<class _RayBase> inline RayTime(const _RayBase& ray) : Base(ray)
+			{
+			}
+
+			inline RayTime() : Base()
+			{
+			}
+
+			inline void setTime(const typename Base::Scalar_T& time) const
+			{
+			}
+
+			inline typename Base::Scalar_T time() const
+			{
+				return Zero<typename Base::Scalar_T>();
+			}
+		};
 	}
 
-	template<class _Options> struct Ray : public detail::RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type >
+	template<class _Options> struct Ray : public detail::RayTime<_Options,typename getOptionByTag<_Options,Tag_RayTimeMode>::type >
 	{
-		typedef detail::RayLength<_Options,typename getOptionByTag<_Options,Tag_RayLengthMode>::type > Base;
+		typedef detail::RayTime<_Options,typename getOptionByTag<_Options,Tag_RayTimeMode>::type > Base;
 		typedef Ray<_Options> ThisType;
 
 		template<class _RayBase> inline Ray(const _RayBase& ray) : Base(ray)
@@ -43,6 +43,7 @@ struct RayAABBIntersectionMethodWilliams
 };
 
 template<class _Options,class _Method,class _RayMode> struct RayAABBIntersection;
+template<class _Options> struct RayQuantizedAABBIntersection;
 
 namespace detail{
 	
@@ -54,6 +55,11 @@ namespace detail{
 			typename getOptionByTag<_Options,Tag_RayMode>::type> type;
 	};
 
+	template<class _Options> struct IntersectorResolver<_Options,PrimitiveClassQuantizedAxisAlignedBox>
+	{
+		typedef RayQuantizedAABBIntersection<_Options> type;
+	};
+
 	// _RayType,class _AABBType,int _RayCount,int _AABBCount
 	template<class _Options,class _Method> struct RayAABBIntersectionBase;
 
@@ -232,6 +238,47 @@ template<class _Options,class _Method> struct RayAABBIntersection<_Options,_Meth
 };
 
 
+// decodes quantized boxes into registers and runs the regular test on them
+template<class _Options> struct RayQuantizedAABBIntersection
+{
+	typedef typename getOptionByTag<_Options,Tag_PrimitiveType>::type::type QuantizedType;
+	typedef typename QuantizedType::Decoded DecodedType;
+
+	static const size_t AABBCount = getOptionByTag<_Options,Tag_PrimitiveCount>::type::value;
+
+	typedef boost::mpl::vector<
+			typename getOptionByTag<_Options,Tag_RayType>::type,
+			Raytrace::PrimitiveType<DecodedType>,
+			typename getOptionByTag<_Options,Tag_RayCount>::type,
+			typename getOptionByTag<_Options,Tag_PrimitiveCount>::type,
+			typename getOptionByTag<_Options,Tag_RayMode>::type,
+			typename getOptionByTag<_Options,Tag_RayAABBIntersectionMethod>::type
+		> DecodedOptions;
+
+	typedef typename Intersector<DecodedOptions>::type DecodedIntersector;
+
+	typedef typename DecodedIntersector::Scalar_T Scalar_T;
+	typedef typename DecodedIntersector::Boolean Boolean;
+	typedef typename DecodedIntersector::BooleanMask BooleanMask;
+
+	template<class _RawRayArray,class _RawAABBArray,class _RawTArray,class _RawResultArray>
+	inline void operator()	(
+		const _RawRayArray& rawRays,
+		const _RawAABBArray& rawAABBs,
+		_RawTArray& rawT,
+		_RawResultArray& rawResult
+		) const
+	{
+		ConstArrayWrapper<_RawAABBArray,QuantizedType,AABBCount> aabbs(rawAABBs);
+		std::array<DecodedType,AABBCount> decoded;
+
+		for(size_t j = 0; j < AABBCount; ++j)
+			aabbs[j].decode(decoded[j]);
+
+		DecodedIntersector()(rawRays,decoded,rawT,rawResult);
+	}
+};
+
 }
 
 #endif
\ No newline at end of file
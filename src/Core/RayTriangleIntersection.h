@@ -30,6 +30,10 @@ namespace Raytrace {
 	
 template<class _Options,class _Method,class _RayMode> struct RayTriangleIntersection;
 struct RayTriangleIntersectionMethodHavel;
+struct RayTriangleIntersectionMethodMoellerTrumbore;
+struct RayTriangleIntersectionMethodWatertight;
+struct RayTriangleIntersectionMethodBaldwinWeber;
+struct RayTriangleIntersectionMethodAnalytic;
 struct Tag_RayTriangleIntersectionMethod;
 
 
@@ -38,10 +42,51 @@ struct Tag_RayTriangleIntersectionMethod
 	typedef RayTriangleIntersectionMethodHavel DefaultValue;
 };
 
+// every method names the triangle storage it reads, Id keys cached leaves
+
+// 12 values, plane equations of the triangle and its two barycentric coordinates
 struct RayTriangleIntersectionMethodHavel 
 {
 	typedef Tag_RayTriangleIntersectionMethod Tag;
+	typedef TriangleBaseModeBarycentricPlane StorageMode;
+	static const bool optionsDefined = true;
+	static const u32 Id = 0;
+};
+
+// 9 values, first point and edges, two cross products per test
+struct RayTriangleIntersectionMethodMoellerTrumbore
+{
+	typedef Tag_RayTriangleIntersectionMethod Tag;
+	typedef TriangleBaseModeEdges StorageMode;
+	static const bool optionsDefined = true;
+	static const u32 Id = 1;
+};
+
+// 9 values, Woop et al. sheared ray space edge functions, no gaps along shared edges
+struct RayTriangleIntersectionMethodWatertight
+{
+	typedef Tag_RayTriangleIntersectionMethod Tag;
+	typedef TriangleBaseModePoints StorageMode;
 	static const bool optionsDefined = true;
+	static const u32 Id = 2;
+};
+
+// 10 values, world to barycentric transform, the test is three partial dot products
+struct RayTriangleIntersectionMethodBaldwinWeber
+{
+	typedef Tag_RayTriangleIntersectionMethod Tag;
+	typedef TriangleBaseModeAffineTransform StorageMode;
+	static const bool optionsDefined = true;
+	static const u32 Id = 3;
+};
+
+// 10 values, Moeller-Trumbore storage and a shape tag, triangles share leaves with quads, disks and spheres
+struct RayTriangleIntersectionMethodAnalytic
+{
+	typedef Tag_RayTriangleIntersectionMethod Tag;
+	typedef TriangleBaseModeAnalytic StorageMode;
+	static const bool optionsDefined = true;
+	static const u32 Id = 4;
 };
 
 namespace detail{
@@ -53,14 +98,11 @@ namespace detail{
 			typename getOptionByTag<_Options,Tag_RayMode>::type> type;
 	};
 
-	
-	template<class _Options,class _Method> struct RayTriangleIntersectionBase;
-
-	template<class _Options> struct RayTriangleIntersectionBase<_Options,RayTriangleIntersectionMethodHavel>
+	template<class _Options,class _Method> struct RayTriangleIntersectionBase
 	{
 		typedef typename getOptionByTag<_Options,Tag_RayType>::type::type RayType;
 		typedef typename getOptionByTag<_Options,Tag_PrimitiveType>::type::type TriangleType;
-		typedef RayTriangleIntersectionMethodHavel Method;
+		typedef _Method Method;
 	
 		static const size_t RayCount = getOptionByTag<_Options,Tag_RayCount>::type::value;
 		static const size_t TriangleCount = getOptionByTag<_Options,Tag_PrimitiveCount>::type::value;
@@ -82,6 +124,8 @@ namespace detail{
 		typedef typename findCommonType<Ray_BooleanMask,Triangle_BooleanMask>::type BooleanMask;
 		typedef Eigen::Matrix<Scalar_T,2,1>		Vector2_T;
 
+		static_assert(std::is_same<typename TriangleType::TriangleBaseMode,typename Method::StorageMode>::value,"Triangle storage doesn't match the intersection method");
+
 		inline RayTriangleIntersectionBase()
 		{
 			static_assert(!std::is_same<Scalar_T,void>::value,"Ray and Triangle type not compatible");
@@ -105,29 +149,161 @@ namespace detail{
 			ArrayWrapper<_RawUVArray,Vector2_T,ResultCount> uv_out(rawUVArray);
 			ArrayWrapper<_RawValidArray,Boolean,ResultCount> valid(rawValidArray);
 
-	#define FOREACH for(size_t i = 0; i< RayCount; ++i)for(size_t j = 0; j< TriangleCount; ++j)
-	#define INDEX (i*TriangleCount + j)
-		
-			std::array<Scalar_T,ResultCount> inv_det;
-			std::array<Vector_T,ResultCount> P_;
+			for(size_t i = 0; i< RayCount; ++i)
+				for(size_t j = 0; j< TriangleCount; ++j)
+				{
+					const size_t index = i*TriangleCount + j;
+					intersect(rays[i],triangles[j],t_out[index],uv_out[index],valid[index],Method());
+				}
+		}
+
+	private:
 
+		inline static void intersect(const RayType& ray,const TriangleType& tri,Scalar_T& t,Vector2_T& uv,Boolean& valid,RayTriangleIntersectionMethodHavel)
+		{
 			//calculate ray plane intersection
-			FOREACH inv_det[INDEX] = rays[INDEX].direction().dot( triangles[INDEX]._n_v ).ReciprocalHighPrecision();
-			FOREACH t_out[INDEX] = -triangles[INDEX]._n_d - (rays[INDEX].origin().dot( triangles[INDEX]._n_v) );
-			FOREACH t_out[INDEX] *= inv_det[INDEX];
-			FOREACH P_[INDEX] = rays[INDEX].origin() + t_out[INDEX] * rays[INDEX].direction();
+			const Scalar_T inv_det = ray.direction().dot( tri._n_v ).ReciprocalHighPrecision();
+			t = ( -tri._n_d - ray.origin().dot( tri._n_v ) ) * inv_det;
+			const Vector_T P_ = ray.origin() + t * ray.direction();
 
 			// calculate impact values
-			FOREACH uv_out[INDEX].x() = P_[INDEX].dot( triangles[INDEX]._u_v ) + triangles[INDEX]._u_d;
-			FOREACH uv_out[INDEX].y() = P_[INDEX].dot( triangles[INDEX]._v_v ) + triangles[INDEX]._v_d;
+			uv.x() = P_.dot( tri._u_v ) + tri._u_d;
+			uv.y() = P_.dot( tri._v_v ) + tri._v_d;
+
+			valid = ( (uv.x() + uv.y()) <= Scalar_T::One() ) & ( uv.x() >= Scalar_T::Zero() ) & ( uv.y() >= Scalar_T::Zero() );
+		}
+
+		inline static void intersect(const RayType& ray,const TriangleType& tri,Scalar_T& t,Vector2_T& uv,Boolean& valid,RayTriangleIntersectionMethodMoellerTrumbore)
+		{
+			const Vector_T P_ = ray.direction().cross( tri._e2 );
+			const Scalar_T det = tri._e1.dot( P_ );
+			const Scalar_T inv_det = det.ReciprocalHighPrecision();
 
-			// check if we found any results
+			const Vector_T T_ = ray.origin() - tri._p0;
+			const Vector_T Q_ = T_.cross( tri._e1 );
 
-			//Boolean d_valid = (det > Scalar_T::Zero());
-			FOREACH valid[INDEX] = ( (uv_out[INDEX].x() + uv_out[INDEX].y()) <= Scalar_T::One() ) & ( uv_out[INDEX].x() >= Scalar_T::Zero() ) & ( uv_out[INDEX].y() >= Scalar_T::Zero() );
+			uv.x() = T_.dot( P_ ) * inv_det;
+			uv.y() = ray.direction().dot( Q_ ) * inv_det;
+			t = tri._e2.dot( Q_ ) * inv_det;
 
-	#undef FOREACH
-	#undef INDEX
+			valid = ( det != Scalar_T::Zero() ) & ( (uv.x() + uv.y()) <= Scalar_T::One() ) & ( uv.x() >= Scalar_T::Zero() ) & ( uv.y() >= Scalar_T::Zero() );
+		}
+
+		inline static void intersect(const RayType& ray,const TriangleType& tri,Scalar_T& t,Vector2_T& uv,Boolean& valid,RayTriangleIntersectionMethodWatertight)
+		{
+			// shear the triangle into a space where the ray runs along z from the origin,
+			// the sign of the ray axis only flips the winding and both windings are accepted
+			Boolean isX,isY;
+			findDominantAxis(ray.direction(),isX,isY);
+
+			const Vector_T d = rotateToAxis(ray.direction(),isX,isY);
+			const Scalar_T Sz = d.z().ReciprocalHighPrecision();
+			const Scalar_T Sx = d.x() * Sz;
+			const Scalar_T Sy = d.y() * Sz;
+
+			const Vector_T A = rotateToAxis(Vector_T(tri.point(0) - ray.origin()),isX,isY);
+			const Vector_T B = rotateToAxis(Vector_T(tri.point(1) - ray.origin()),isX,isY);
+			const Vector_T C = rotateToAxis(Vector_T(tri.point(2) - ray.origin()),isX,isY);
+
+			const Scalar_T Ax = A.x() - Sx * A.z();
+			const Scalar_T Ay = A.y() - Sy * A.z();
+			const Scalar_T Bx = B.x() - Sx * B.z();
+			const Scalar_T By = B.y() - Sy * B.z();
+			const Scalar_T Cx = C.x() - Sx * C.z();
+			const Scalar_T Cy = C.y() - Sy * C.z();
+
+			// edge functions, a point on an edge is inside for both triangles sharing it
+			const Scalar_T U = Cx * By - Cy * Bx;
+			const Scalar_T V = Ax * Cy - Ay * Cx;
+			const Scalar_T W = Bx * Ay - By * Ax;
+			const Scalar_T det = U + V + W;
+
+			valid = ( ( (U >= Scalar_T::Zero()) & (V >= Scalar_T::Zero()) & (W >= Scalar_T::Zero()) ) |
+					( (U <= Scalar_T::Zero()) & (V <= Scalar_T::Zero()) & (W <= Scalar_T::Zero()) ) ) &
+					( det != Scalar_T::Zero() );
+
+			const Scalar_T inv_det = det.ReciprocalHighPrecision();
+			t = ( U * A.z() + V * B.z() + W * C.z() ) * Sz * inv_det;
+			uv.x() = V * inv_det;
+			uv.y() = W * inv_det;
+		}
+
+		inline static void intersect(const RayType& ray,const TriangleType& tri,Scalar_T& t,Vector2_T& uv,Boolean& valid,RayTriangleIntersectionMethodBaldwinWeber)
+		{
+			// rotate the ray so the triangle's implicit transform column is z
+			const Boolean isX = tri._axis == Scalar_T::Zero();
+			const Boolean isY = tri._axis == Scalar_T::One();
+			const Vector_T o = rotateToAxis(ray.origin(),isX,isY);
+			const Vector_T d = rotateToAxis(ray.direction(),isX,isY);
+
+			const Scalar_T o_z = tri._n.x() * o.x() + tri._n.y() * o.y() + o.z() + tri._n.z();
+			const Scalar_T d_z = tri._n.x() * d.x() + tri._n.y() * d.y() + d.z();
+			t = -o_z * d_z.ReciprocalHighPrecision();
+
+			const Scalar_T h_x = o.x() + t * d.x();
+			const Scalar_T h_y = o.y() + t * d.y();
+			uv.x() = tri._u.x() * h_x + tri._u.y() * h_y + tri._u.z();
+			uv.y() = tri._v.x() * h_x + tri._v.y() * h_y + tri._v.z();
+
+			valid = ( (uv.x() + uv.y()) <= Scalar_T::One() ) & ( uv.x() >= Scalar_T::Zero() ) & ( uv.y() >= Scalar_T::Zero() );
+		}
+
+		inline static void intersect(const RayType& ray,const TriangleType& tri,Scalar_T& t,Vector2_T& uv,Boolean& valid,RayTriangleIntersectionMethodAnalytic)
+		{
+			const Boolean isSphere = tri._shape == Scalar_T((f32)PrimitiveShapeSphere);
+			const Boolean isPlanar = tri._shape != Scalar_T((f32)PrimitiveShapeSphere);
+			const Vector_T T_ = ray.origin() - tri._p0;
+
+			valid = Boolean::Zero();
+
+			// planar shapes share the Moeller-Trumbore test and only accept different regions of the e1,e2 frame
+			if(isPlanar.mask())
+			{
+				const Boolean isQuad = tri._shape == Scalar_T((f32)PrimitiveShapeQuad);
+				const Boolean isDisk = tri._shape == Scalar_T((f32)PrimitiveShapeDisk);
+
+				const Vector_T P_ = ray.direction().cross( tri._e2 );
+				const Scalar_T det = tri._e1.dot( P_ );
+				const Scalar_T inv_det = det.ReciprocalHighPrecision();
+				const Vector_T Q_ = T_.cross( tri._e1 );
+
+				uv.x() = T_.dot( P_ ) * inv_det;
+				uv.y() = ray.direction().dot( Q_ ) * inv_det;
+				t = tri._e2.dot( Q_ ) * inv_det;
+
+				const Boolean positive = ( uv.x() >= Scalar_T::Zero() ) & ( uv.y() >= Scalar_T::Zero() );
+				const Boolean inTriangle = positive & ( (uv.x() + uv.y()) <= Scalar_T::One() );
+				const Boolean inQuad = positive & ( uv.x() <= Scalar_T::One() ) & ( uv.y() <= Scalar_T::One() );
+				const Boolean inDisk = ( uv.x() * uv.x() + uv.y() * uv.y() ) <= Scalar_T::One();
+
+				valid = ( det != Scalar_T::Zero() ) & isPlanar &
+					Boolean::Condition(isQuad,inQuad,Boolean::Condition(isDisk,inDisk,inTriangle));
+			}
+
+			// nearest root in front of the origin, rays leaving the surface from inside take the far one
+			if(isSphere.mask())
+			{
+				const Scalar_T a = ray.direction().dot( ray.direction() );
+				const Scalar_T b = T_.dot( ray.direction() );
+				const Scalar_T c = T_.dot( T_ ) - tri._e1.dot( tri._e1 );
+				const Scalar_T discriminant = b * b - a * c;
+				const Boolean hit = discriminant >= Scalar_T::Zero();
+
+				const Scalar_T root = Scalar_T::Condition(hit,discriminant,Scalar_T::Zero()).Sqrt();
+				const Scalar_T inv_a = a.ReciprocalHighPrecision();
+				const Scalar_T tNear = ( -b - root ) * inv_a;
+				const Scalar_T tFar = ( -b + root ) * inv_a;
+				const Scalar_T tSphere = Scalar_T::Condition(tNear > Scalar_T::Epsilon(),tNear,tFar);
+
+				// surface coordinates along the two stored axes
+				const Vector_T H_ = T_ + tSphere * ray.direction();
+				const Scalar_T inv_r2 = tri._e1.dot( tri._e1 ).ReciprocalHighPrecision();
+
+				t = Scalar_T::Condition(isSphere,tSphere,t);
+				uv.x() = Scalar_T::Condition(isSphere,H_.dot( tri._e1 ) * inv_r2,uv.x());
+				uv.y() = Scalar_T::Condition(isSphere,H_.dot( tri._e2 ) * inv_r2,uv.y());
+				valid |= isSphere & hit;
+			}
 		}
 	};
 }
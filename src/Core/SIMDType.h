@@ -19,9 +19,14 @@
 #ifndef RAYTRACE_SIMD_TYPE_GUARD
 #define RAYTRACE_SIMD_TYPE_GUARD
 
+#include <RaytraceCommon.h>
 #include <emmintrin.h>
+#ifdef SIMD_AVX2
+#include <immintrin.h>
+#endif
 #include <array>
 #include <bitset>
+#include <limits>
 #include <Eigen/Eigen>
 #include "MathHelper.h"
 #include "ArrayAdapter.h"
@@ -281,6 +286,26 @@ namespace Raytrace
 			return _mm_movemask_ps( _mm_castsi128_ps( _value) );
 		}
 
+		// 0,1,2,3
+		inline static ThisType Sequence()
+		{
+			return _mm_set_epi32(3,2,1,0);
+		}
+
+		// zero extending loads of packed small integers, used for quantized data
+		inline static ThisType LoadUnsigned(const u8* data)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			__m128i packed = _mm_cvtsi32_si128( *(const int*)data );
+			return _mm_unpacklo_epi16( _mm_unpacklo_epi8( packed, zero ), zero );
+		}
+
+		inline static ThisType LoadUnsigned(const u16* data)
+		{
+			__m128i packed = _mm_loadl_epi64( (const __m128i*)data );
+			return _mm_unpacklo_epi16( packed, _mm_setzero_si128() );
+		}
+
 		inline Base& operator [](int i)
 		{
 			return ((Base*)&_value)[i];
@@ -350,6 +375,27 @@ namespace Raytrace
 			return _mm_cmpgt_epi32(_value,right._value);
 		}
 
+		inline ThisType operator +(const ThisType& right) const
+		{
+			return _mm_add_epi32(_value,right._value);
+		}
+
+		inline ThisType operator -(const ThisType& right) const
+		{
+			return _mm_sub_epi32(_value,right._value);
+		}
+
+		inline ThisType ShiftLeft(int bits) const
+		{
+			return _mm_sll_epi32(_value,_mm_cvtsi32_si128(bits));
+		}
+
+		// shifts in zeros
+		inline ThisType ShiftRight(int bits) const
+		{
+			return _mm_srl_epi32(_value,_mm_cvtsi32_si128(bits));
+		}
+
 		inline static ThisType One()
 		{
 			return ThisType((Base)1);
@@ -375,6 +421,15 @@ namespace Raytrace
 		__m128i	_value;
 	};
 
+	namespace detail
+	{
+		// polynomial approximations for the vector types, defined at the end of this file
+		template<class _Float> _Float SimdExp(const _Float& x);
+		template<class _Float> _Float SimdLog(const _Float& x);
+		template<class _Float> _Float SimdSinCos(const _Float& x,bool cosine);
+		template<class _Float> _Float SimdPow(const _Float& x,const _Float& y);
+	}
+
 	template<> struct SimdType<float,4>
 	{
 		static const int Width = 4;
@@ -392,6 +447,7 @@ namespace Raytrace
 		{
 			_value = _mm_set1_ps(right);
 		}
+		explicit inline SimdType(const SimdType<int,Width>& right) : _value(_mm_cvtepi32_ps(right._value)) {}
 	private:
 		inline SimdType(const __m128& right) : _value(right) {}
 	public:
@@ -546,37 +602,33 @@ namespace Raytrace
 
 		inline ThisType Exp() const
 		{
-			// TO DO
-			assert(false);
-			return Zero();
+			return detail::SimdExp(*this);
 		}
 		
 		inline ThisType Log() const
 		{
-			// TO DO
-			assert(false);
-			return Zero();
+			return detail::SimdLog(*this);
 		}
 
 		inline ThisType Sin() const
 		{
-			// TO DO
-			assert(false);
-			return Zero();
+			return detail::SimdSinCos(*this,false);
 		}
 
 		inline ThisType Cos() const
 		{
-			// TO DO
-			assert(false);
-			return Zero();
+			return detail::SimdSinCos(*this,true);
 		}
 
 		inline ThisType Pow(const ThisType& exponent) const
 		{
-			// TO DO
-			assert(false);
-			return Zero();
+			return detail::SimdPow(*this,exponent);
+		}
+
+		// rounds towards zero
+		inline Boolean Truncate() const
+		{
+			return _mm_cvttps_epi32(_value);
 		}
 
 		inline ThisType Min(const ThisType& right) const
@@ -633,6 +685,39 @@ namespace Raytrace
 			return _mm_cmpgt_ps(_value,right._value);
 		}
 
+		// same bits as integers, non negative floats keep their order
+		inline Boolean AsBits() const
+		{
+			return _mm_castps_si128(_value);
+		}
+
+		inline static ThisType FromBits(const Boolean& bits)
+		{
+			return _mm_castsi128_ps(bits._value);
+		}
+
+		// ascending, sorting network of five compare exchanges
+		inline ThisType Sort() const
+		{
+			// (0,1) (2,3), the result is ordered min01 min23 max01 max23
+			__m128 swapped = _mm_shuffle_ps(_value,_value,_MM_SHUFFLE(2,3,0,1));
+			__m128 low = _mm_min_ps(_value,swapped);
+			__m128 high = _mm_max_ps(_value,swapped);
+			__m128 v = _mm_shuffle_ps(low,high,_MM_SHUFFLE(2,0,2,0));
+
+			// (min01,min23) (max01,max23), lanes 0 and 3 are final
+			swapped = _mm_shuffle_ps(v,v,_MM_SHUFFLE(2,3,0,1));
+			low = _mm_min_ps(v,swapped);
+			high = _mm_max_ps(v,swapped);
+			v = _mm_shuffle_ps(low,high,_MM_SHUFFLE(2,0,2,0));
+
+			// (1,2)
+			swapped = _mm_shuffle_ps(v,v,_MM_SHUFFLE(3,1,2,0));
+			low = _mm_min_ps(v,swapped);
+			high = _mm_max_ps(v,swapped);
+			return _mm_shuffle_ps(low,high,_MM_SHUFFLE(3,2,1,0));
+		}
+
 		inline static void ConditionalSwap(const Boolean& condition,ThisType& valA,ThisType& valB)
 		{
 			valA._value = _mm_xor_ps(valA._value,valB._value);
@@ -654,6 +739,605 @@ namespace Raytrace
 		__m128	_value;
 	};
 
+#ifdef SIMD_AVX2
+	template<> struct SimdType<int,8>
+	{
+	public:
+		static const int Width = 8;
+		typedef int Base;
+		static const int Size = Width;
+		typedef Base Element;
+		typedef SimdType<Base,Width> ThisType;
+		typedef ThisType Boolean;
+		typedef int		 BooleanMask;
+
+		inline SimdType() {}
+		explicit inline SimdType(const Base& base) : _value(_mm256_set1_epi32(base)) {}
+		inline SimdType(const ThisType& boolean) : _value(boolean._value) {}
+		
+		inline SimdType(const std::array<Base,Width>& right) : _value(_mm256_loadu_si256((const __m256i*)right.data())) {}
+		
+		template<class _Array,class _Element,int _Size,class _Reader,class _Modifier,class _Adapter> 
+		inline SimdType(const ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>& right)
+		{
+			for(int i = 0; i < Width; ++i)
+				operator[](i) = right[i];
+		}
+		
+	private:
+		inline SimdType(const __m256& right) : _value(_mm256_castps_si256(right)) {}
+		inline SimdType(const __m256i& right) : _value(right) {}
+	public:
+
+		inline int mask() const
+		{
+			return _mm256_movemask_ps( _mm256_castsi256_ps( _value) );
+		}
+
+		// 0,1,...,7
+		inline static ThisType Sequence()
+		{
+			return _mm256_set_epi32(7,6,5,4,3,2,1,0);
+		}
+
+		// zero extending loads of packed small integers, used for quantized data
+		inline static ThisType LoadUnsigned(const u8* data)
+		{
+			return _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i*)data ) );
+		}
+
+		inline static ThisType LoadUnsigned(const u16* data)
+		{
+			return _mm256_cvtepu16_epi32( _mm_loadu_si128( (const __m128i*)data ) );
+		}
+
+		inline Base& operator [](int i)
+		{
+			return ((Base*)&_value)[i];
+		}
+		
+		inline const Base& operator [](int i) const
+		{
+			return ((const Base*)&_value)[i];
+		}
+
+		inline ThisType& operator =(const ThisType& other)
+		{
+			_value = other._value;
+			return *this;
+		}
+
+		inline ThisType operator&(const ThisType& other) const
+		{
+			return _mm256_and_si256( _value, other._value);
+		}
+		
+		inline ThisType operator|(const ThisType& other) const
+		{
+			return _mm256_or_si256( _value, other._value);
+		}
+		
+		inline ThisType operator^(const ThisType& other) const
+		{
+			return _mm256_xor_si256( _value, other._value);
+		}
+
+		inline ThisType AndNot(const ThisType& other) const
+		{
+			return _mm256_andnot_si256(other._value,_value);
+		}
+
+		inline ThisType& operator&=(const ThisType& other)
+		{
+			_value = _mm256_and_si256( _value, other._value);
+			return *this;
+		}
+		
+		inline ThisType& operator|=(const ThisType& other)
+		{
+			_value = _mm256_or_si256( _value, other._value);
+			return *this;
+		}
+		
+		inline ThisType& operator^=(const ThisType& other)
+		{
+			_value = _mm256_xor_si256( _value, other._value);
+			return *this;
+		}
+		
+		inline Boolean operator ==(const ThisType& right) const
+		{
+			return _mm256_cmpeq_epi32(_value,right._value);
+		}
+		
+		inline Boolean operator <(const ThisType& right) const
+		{
+			return _mm256_cmpgt_epi32(right._value,_value);
+		}
+		
+		inline Boolean operator >(const ThisType& right) const
+		{
+			return _mm256_cmpgt_epi32(_value,right._value);
+		}
+
+		inline ThisType operator +(const ThisType& right) const
+		{
+			return _mm256_add_epi32(_value,right._value);
+		}
+
+		inline ThisType operator -(const ThisType& right) const
+		{
+			return _mm256_sub_epi32(_value,right._value);
+		}
+
+		inline ThisType ShiftLeft(int bits) const
+		{
+			return _mm256_sll_epi32(_value,_mm_cvtsi32_si128(bits));
+		}
+
+		// shifts in zeros
+		inline ThisType ShiftRight(int bits) const
+		{
+			return _mm256_srl_epi32(_value,_mm_cvtsi32_si128(bits));
+		}
+
+		inline static ThisType One()
+		{
+			return ThisType((Base)1);
+		}
+
+		inline static ThisType Zero()
+		{
+			return ThisType((Base)0);
+		}
+		
+		inline static ThisType Condition(const Boolean& condition,const ThisType& trueVal,const ThisType& falseVal)
+		{
+			return _mm256_blendv_epi8(falseVal._value,trueVal._value,condition._value);
+		}
+
+		inline void ConditionalAssign(const Boolean& condition,const ThisType& trueVal,const ThisType& falseVal)
+		{
+			*this = Condition(condition,trueVal,falseVal);
+		}
+
+	private:
+		friend struct SimdType<float,8>;
+		__m256i	_value;
+	};
+
+	template<> struct SimdType<float,8>
+	{
+		static const int Width = 8;
+		typedef float Base;
+		static const int Size = Width;
+		typedef Base Element;
+		typedef SimdType<Base,Width> ThisType;
+		typedef SimdType<int,Width> Boolean;
+		typedef int					BooleanMask;
+
+		inline SimdType() {}
+		inline SimdType(const ThisType& right) : _value(right._value) {}
+		inline SimdType(const std::array<Base,Width>& right) : _value(_mm256_loadu_ps((Base*)right.data())) {}
+		inline SimdType(const Base& right)
+		{
+			_value = _mm256_set1_ps(right);
+		}
+		explicit inline SimdType(const SimdType<int,Width>& right) : _value(_mm256_cvtepi32_ps(right._value)) {}
+	private:
+		inline SimdType(const __m256& right) : _value(right) {}
+	public:
+
+		inline Base& operator [](int i)
+		{
+			return ((Base*)&_value)[i];
+		}
+		
+		inline const Base& operator [](int i) const
+		{
+			return ((const Base*)&_value)[i];
+		}
+		
+		inline ThisType& operator =(const Base& right)
+		{
+			_value = _mm256_set1_ps(right);
+			return *this;
+		}
+
+		inline ThisType& operator =(const ThisType& other)
+		{
+			_value = other._value;
+			return *this;
+		}
+
+		inline ThisType operator *(const ThisType& other) const
+		{
+			return _mm256_mul_ps(_value,other._value);
+		}
+
+		inline ThisType operator /(const ThisType& other) const
+		{
+			return _mm256_div_ps(_value,other._value);
+		}
+		
+		inline ThisType operator +(const ThisType& other) const
+		{
+			return _mm256_add_ps(_value,other._value);
+		}
+		
+		inline ThisType operator -(const ThisType& other) const
+		{
+			return _mm256_sub_ps(_value,other._value);
+		}
+		
+		inline ThisType& operator *=(const ThisType& other)
+		{
+			_value = _mm256_mul_ps(_value,other._value);
+			return *this;
+		}
+
+		inline ThisType& operator /=(const ThisType& other)
+		{
+			_value = _mm256_div_ps(_value,other._value);
+			return *this;
+		}
+		
+		inline ThisType& operator +=(const ThisType& other)
+		{
+			_value = _mm256_add_ps(_value,other._value);
+			return *this;
+		}
+		
+		inline ThisType& operator -=(const ThisType& other)
+		{
+			_value = _mm256_sub_ps(_value,other._value);
+			return *this;
+		}
+
+		inline ThisType operator -() const
+		{
+			return _mm256_xor_ps(_value,_mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+		}
+
+		inline ThisType operator&(const Boolean& other) const
+		{
+			return _mm256_and_ps( _value, _mm256_castsi256_ps(other._value));
+		}
+		
+		inline ThisType operator|(const Boolean& other) const
+		{
+			return _mm256_or_ps( _value, _mm256_castsi256_ps(other._value));
+		}
+		
+		inline ThisType operator^(const Boolean& other) const
+		{
+			return _mm256_xor_ps( _value, _mm256_castsi256_ps(other._value));
+		}
+
+		inline ThisType AndNot(const Boolean& other) const
+		{
+			return _mm256_andnot_ps(_mm256_castsi256_ps(other._value),_value);
+		}
+
+		inline ThisType& operator&=(const Boolean& other)
+		{
+			_value = _mm256_and_ps( _value, _mm256_castsi256_ps(other._value));
+			return *this;
+		}
+		
+		inline ThisType& operator|=(const Boolean& other)
+		{
+			_value = _mm256_or_ps( _value, _mm256_castsi256_ps(other._value));
+			return *this;
+		}
+		
+		inline ThisType& operator^=(const Boolean& other)
+		{
+			_value = _mm256_xor_ps( _value, _mm256_castsi256_ps(other._value));
+			return *this;
+		}
+
+		inline static ThisType Epsilon()
+		{
+			return _mm256_set1_ps(.00001f);
+		}
+		
+		inline static ThisType One()
+		{
+			return _mm256_set1_ps(1.0f);
+		}
+
+		inline static ThisType Zero()
+		{
+			return _mm256_setzero_ps();
+		}
+
+		inline ThisType Absolute() const
+		{
+			return _mm256_and_ps(_value,_mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+		}
+		
+		inline ThisType Sqrt() const
+		{
+			return _mm256_sqrt_ps(_value);
+		}
+		
+		inline ThisType Reciprocal() const
+		{
+			return _mm256_rcp_ps(_value);
+		}
+		
+		inline ThisType ReciprocalHighPrecision() const
+		{
+			__m256 low = _mm256_rcp_ps(_value);
+			__m256 high = _mm256_mul_ps(_mm256_mul_ps(_value,low),low);
+			return _mm256_sub_ps(_mm256_add_ps(low,low),high);
+		}
+
+		inline ThisType Exp() const
+		{
+			return detail::SimdExp(*this);
+		}
+		
+		inline ThisType Log() const
+		{
+			return detail::SimdLog(*this);
+		}
+
+		inline ThisType Sin() const
+		{
+			return detail::SimdSinCos(*this,false);
+		}
+
+		inline ThisType Cos() const
+		{
+			return detail::SimdSinCos(*this,true);
+		}
+
+		inline ThisType Pow(const ThisType& exponent) const
+		{
+			return detail::SimdPow(*this,exponent);
+		}
+
+		// rounds towards zero
+		inline Boolean Truncate() const
+		{
+			return _mm256_cvttps_epi32(_value);
+		}
+
+		inline ThisType Min(const ThisType& right) const
+		{
+			return _mm256_min_ps(_value,right._value);
+		}
+		
+		inline ThisType Max(const ThisType& right) const
+		{
+			return _mm256_max_ps(_value,right._value);
+		}
+		
+		// horizontal min/max, the result is broadcast to all lanes
+		inline ThisType Min() const
+		{
+			__m256 intermediate = _mm256_min_ps(_value,_mm256_permute2f128_ps(_value,_value,1));
+			intermediate = _mm256_min_ps(intermediate,_mm256_shuffle_ps(intermediate,intermediate, _MM_SHUFFLE(2,3,0,1)));
+			return _mm256_min_ps(intermediate,_mm256_shuffle_ps(intermediate,intermediate, _MM_SHUFFLE(1,0,3,2)));
+		}
+		
+		inline ThisType Max() const
+		{
+			__m256 intermediate = _mm256_max_ps(_value,_mm256_permute2f128_ps(_value,_value,1));
+			intermediate = _mm256_max_ps(intermediate,_mm256_shuffle_ps(intermediate,intermediate, _MM_SHUFFLE(2,3,0,1)));
+			return _mm256_max_ps(intermediate,_mm256_shuffle_ps(intermediate,intermediate, _MM_SHUFFLE(1,0,3,2)));
+		}
+
+		inline Boolean operator ==(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_EQ_OQ);
+		}
+		
+		inline Boolean operator !=(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_NEQ_UQ);
+		}
+		
+		inline Boolean operator <=(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_LE_OS);
+		}
+		
+		inline Boolean operator <(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_LT_OS);
+		}
+		
+		inline Boolean operator >=(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_GE_OS);
+		}
+		
+		inline Boolean operator >(const ThisType& right) const
+		{
+			return _mm256_cmp_ps(_value,right._value,_CMP_GT_OS);
+		}
+
+		// same bits as integers, non negative floats keep their order
+		inline Boolean AsBits() const
+		{
+			return _mm256_castps_si256(_value);
+		}
+
+		inline static ThisType FromBits(const Boolean& bits)
+		{
+			return _mm256_castsi256_ps(bits._value);
+		}
+
+		// ascending, both halves with the four wide network then a bitonic merge
+		inline ThisType Sort() const
+		{
+			__m256 swapped = _mm256_shuffle_ps(_value,_value,_MM_SHUFFLE(2,3,0,1));
+			__m256 low = _mm256_min_ps(_value,swapped);
+			__m256 high = _mm256_max_ps(_value,swapped);
+			__m256 v = _mm256_shuffle_ps(low,high,_MM_SHUFFLE(2,0,2,0));
+
+			swapped = _mm256_shuffle_ps(v,v,_MM_SHUFFLE(2,3,0,1));
+			low = _mm256_min_ps(v,swapped);
+			high = _mm256_max_ps(v,swapped);
+			v = _mm256_shuffle_ps(low,high,_MM_SHUFFLE(2,0,2,0));
+
+			swapped = _mm256_shuffle_ps(v,v,_MM_SHUFFLE(3,1,2,0));
+			low = _mm256_min_ps(v,swapped);
+			high = _mm256_max_ps(v,swapped);
+			v = _mm256_shuffle_ps(low,high,_MM_SHUFFLE(3,2,1,0));
+
+			// merge, compare each lane with the mirrored one of the other half
+			swapped = _mm256_permute2f128_ps(v,v,1);
+			swapped = _mm256_shuffle_ps(swapped,swapped,_MM_SHUFFLE(0,1,2,3));
+			v = _mm256_blend_ps(_mm256_min_ps(v,swapped),_mm256_max_ps(v,swapped),0xf0);
+
+			// both halves are bitonic now, clean up at distance 2 and 1
+			swapped = _mm256_shuffle_ps(v,v,_MM_SHUFFLE(1,0,3,2));
+			v = _mm256_blend_ps(_mm256_min_ps(v,swapped),_mm256_max_ps(v,swapped),0xcc);
+
+			swapped = _mm256_shuffle_ps(v,v,_MM_SHUFFLE(2,3,0,1));
+			return _mm256_blend_ps(_mm256_min_ps(v,swapped),_mm256_max_ps(v,swapped),0xaa);
+		}
+
+		inline static void ConditionalSwap(const Boolean& condition,ThisType& valA,ThisType& valB)
+		{
+			__m256 temp = _mm256_blendv_ps(valA._value,valB._value,_mm256_castsi256_ps(condition._value));
+			valB._value = _mm256_blendv_ps(valB._value,valA._value,_mm256_castsi256_ps(condition._value));
+			valA._value = temp;
+		}
+
+		inline static ThisType Condition(const Boolean& condition,const ThisType& trueVal,const ThisType& falseVal)
+		{
+			return _mm256_blendv_ps(falseVal._value,trueVal._value,_mm256_castsi256_ps(condition._value));
+		}
+
+		inline void ConditionalAssign(const Boolean& condition,const ThisType& trueVal,const ThisType& falseVal)
+		{
+			*this = Condition(condition,trueVal,falseVal);
+		}
+	private:
+		__m256	_value;
+	};
+#endif
+
+	namespace detail
+	{
+		// single precision Cephes approximations, exp(x) = 2^n exp(r) with |r| <= ln(2)/2
+		template<class _Float> inline _Float SimdExp(const _Float& x)
+		{
+			typedef typename _Float::Boolean Int;
+
+			// the clamp keeps 2^n a normal float, NaN passes through
+			const _Float clamped = _Float(-88.3762626647949f).Max(_Float(88.0f).Min(x));
+
+			const _Float fx = clamped * _Float(1.44269504088896341f) + _Float(0.5f);
+			const Int truncated = fx.Truncate();
+			// floor, true lanes are -1
+			const Int n = truncated + (_Float(truncated) > fx);
+			const _Float fn(n);
+
+			// ln(2) split in two so the reduction stays exact
+			const _Float r = clamped - fn * _Float(0.693359375f) - fn * _Float(-2.12194440e-4f);
+			const _Float r2 = r * r;
+
+			_Float y = _Float(1.9875691500e-4f);
+			y = y * r + _Float(1.3981999507e-3f);
+			y = y * r + _Float(8.3334519073e-3f);
+			y = y * r + _Float(4.1665795894e-2f);
+			y = y * r + _Float(1.6666665459e-1f);
+			y = y * r + _Float(5.0000001201e-1f);
+			y = y * r2 + r + _Float(1.0f);
+
+			return y * _Float::FromBits((n + Int(127)).ShiftLeft(23));
+		}
+
+		// log(x) = e ln(2) + log(m) with the mantissa m in [sqrt(0.5),sqrt(2))
+		template<class _Float> inline _Float SimdLog(const _Float& x)
+		{
+			typedef typename _Float::Boolean Int;
+
+			// denormals are flushed to the smallest normal
+			const Int bits = x.Max(_Float::FromBits(Int(0x00800000))).AsBits();
+
+			_Float e(bits.ShiftRight(23) - Int(126));
+			_Float m = _Float::FromBits((bits & Int(0x007fffff)) | Int(0x3f000000));
+
+			const Int small = m < _Float(0.707106781186547524f);
+			e = e - (_Float(1.0f) & small);
+			m = m + (m & small) - _Float(1.0f);
+
+			const _Float m2 = m * m;
+
+			_Float y = _Float(7.0376836292e-2f);
+			y = y * m + _Float(-1.1514610310e-1f);
+			y = y * m + _Float(1.1676998740e-1f);
+			y = y * m + _Float(-1.2420140846e-1f);
+			y = y * m + _Float(1.4249322787e-1f);
+			y = y * m + _Float(-1.6668057665e-1f);
+			y = y * m + _Float(2.0000714765e-1f);
+			y = y * m + _Float(-2.4999993993e-1f);
+			y = y * m + _Float(3.3333331174e-1f);
+			y = y * m * m2;
+
+			y = y + e * _Float(-2.12194440e-4f) - m2 * _Float(0.5f);
+			const _Float result = m + y + e * _Float(0.693359375f);
+
+			const _Float zero = _Float::Zero();
+			return _Float::Condition(x < zero, _Float(std::numeric_limits<float>::quiet_NaN()),
+				_Float::Condition(x == zero, _Float(-std::numeric_limits<float>::infinity()), result));
+		}
+
+		// reduces to an octant of pi/4 and picks the sine or cosine polynomial from it
+		// accurate for |x| up to about 8192, the reduction loses precision beyond that
+		template<class _Float> inline _Float SimdSinCos(const _Float& x,bool cosine)
+		{
+			typedef typename _Float::Boolean Int;
+
+			const _Float absolute = x.Absolute();
+
+			// octant rounded up to even
+			Int j = (absolute * _Float(1.27323954473516f)).Truncate();
+			j = (j + Int(1)) & Int(~1);
+			const _Float fj(j);
+
+			Int sign;
+			if(cosine)
+			{
+				j = j - Int(2);
+				sign = Int(4).AndNot(j).ShiftLeft(29);
+			}
+			else
+				sign = (j & Int(4)).ShiftLeft(29) ^ (x.AsBits() & Int((int)0x80000000));
+
+			const Int sinePolynomial = (j & Int(2)) == Int::Zero();
+
+			// pi/4 split in three
+			const _Float r = absolute + fj * _Float(-0.78515625f) + fj * _Float(-2.4187564849853515625e-4f) + fj * _Float(-3.77489497744594108e-8f);
+			const _Float r2 = r * r;
+
+			_Float c = _Float(2.443315711809948e-5f);
+			c = c * r2 + _Float(-1.388731625493765e-3f);
+			c = c * r2 + _Float(4.166664568298827e-2f);
+			c = c * r2 * r2 - r2 * _Float(0.5f) + _Float(1.0f);
+
+			_Float s = _Float(-1.9515295891e-4f);
+			s = s * r2 + _Float(8.3321608736e-3f);
+			s = s * r2 + _Float(-1.6666654611e-1f);
+			s = s * r2 * r + r;
+
+			return _Float::Condition(sinePolynomial, s, c) ^ sign;
+		}
+
+		// exp(y log(x)), only defined for x >= 0 like the shading code needs it
+		template<class _Float> inline _Float SimdPow(const _Float& x,const _Float& y)
+		{
+			return _Float::Condition(y == _Float::Zero(), _Float(1.0f), SimdExp(y * SimdLog(x)));
+		}
+	}
+
 	//mappings for eigen
 	namespace internal
 	{
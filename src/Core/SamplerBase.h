@@ -25,6 +25,9 @@
 #include "SampleData.h"
 #include "ISampler.h"
 #include "SceneReader.h"
+#include "Aligned.h"
+#include "PixelFilter.h"
+#include <algorithm>
 
 
 namespace Raytrace {
@@ -47,10 +50,12 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		_maxGenerateSamples = std::min<size_t>(MaxGeneratedSamples,_imageSize.x()*_imageSize.y());
 		size_t size = _imageSize.x()*_imageSize.y();
 		_finalImage.resize(size);
+		_lightImage.assign(size,Vector4(0.0f,0.0f,0.0f,0.0f));
 		
 		_numGeneratedSamples = 0;
 		_numCompletedSamples = 0;
 		_numDrawnSamples = 0;
+		_numSplattedSamples = 0;
 		_nextGenerateSamples = 0;
 
 		_nextGenerateBlock = 0;
@@ -62,8 +67,14 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		_sampleData= &sampleData;
 				
 		_threadStats.resize(numThreads);
+		for(auto it = _threadStats.begin(); it != _threadStats.end(); ++it)
+			it->_completed.resize(numThreads);
 
 		_numDesiredSamples = _finalImage.size()*multisampleCount;
+
+		_deterministic = scene->isDeterministic();
+
+		_filter.Initialize(scene->getPixelFilter());
 	}
 
 	virtual void InitializeMT(size_t threadId) 
@@ -85,6 +96,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		{
 			it->_numGenerated = 0;
 			it->_numCompleted = 0;
+			it->_numSplatted = 0;
 		}
 	}
 
@@ -92,16 +104,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 	{
 		const Vector2u size(_imageSize);
 
-		//read completed
-		typename SampleData::SampleOutput completed;
-
-		while(_sampleData->popCompletedSample(threadId,completed))
-		{
-			size_t imageIndex = completed._index % _finalImage.size();
-
-			_finalImage[imageIndex].pushData(completed._result);
-			_threadStats[threadId]._numCompleted++;
-		}
+		ReadCompletedMT(threadId);
 
 		//write new
 
@@ -123,15 +126,18 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 			{
 				generated._index = i;
 				_sampleData->pushGeneratedSample(threadId,generated);
-				_threadStats[threadId]._numGenerated++;
 			}
+			_threadStats[threadId]._numGenerated += (size_t)numSamples;
 		}
 	}
 
 	virtual f32 GenerateCompleteST() 
 	{
 		for(auto it = _threadStats.begin(); it != _threadStats.end(); ++it)
+		{
 			_numCompletedSamples += it->_numCompleted;
+			_numSplattedSamples += it->_numSplatted;
+		}
 
 		//assert(_numCompletedSamples == _numGeneratedSamples);
 
@@ -142,6 +148,179 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		return (float)_numCompletedSamples / (float)_numDesiredSamples;
 	}
 
+	// Pixels are owned by threads in tiles of PixelsPerTile, each thread sorts the samples it pops
+	// into one bin per owner and after all threads are done popping accumulates its own tiles,
+	// so no pixel is ever written by two threads and tiles don't share cache lines.
+	// With a filter wider than a pixel a sample goes to every owner its footprint touches.
+	// In deterministic mode the samples of a tile are accumulated in sample index order. The sort
+	// costs about 60ns per sample with the box filter, wider filters gain more than that back from
+	// splatting neighbouring pixels one after the other.
+	// Splats are binned around their image location the same way and aren't counted as completed samples.
+	inline void ReadCompletedMT(size_t threadId)
+	{
+		ThreadStats& stats = _threadStats[threadId];
+		size_t numCompleted = 0;
+		size_t numSplatted = 0;
+
+		typename SampleData::SampleOutput completed;
+
+		while(_sampleData->popCompletedSample(threadId,completed))
+		{
+			BinCompleted(threadId,completed);
+			if(completed._splat)
+				++numSplatted;
+			else
+				++numCompleted;
+		}
+
+		stats._numCompleted += numCompleted;
+		stats._numSplatted += numSplatted;
+
+		_generateBarrier->wait();
+
+		if(_deterministic)
+		{
+			stats._owned.clear();
+			for(auto it = _threadStats.begin(); it != _threadStats.end(); ++it)
+			{
+				stats._owned.insert(stats._owned.end(),it->_completed[threadId].begin(),it->_completed[threadId].end());
+				it->_completed[threadId].clear();
+			}
+
+			std::sort(stats._owned.begin(),stats._owned.end(),SampleOrder());
+
+			for(auto it = stats._owned.begin(); it != stats._owned.end(); ++it)
+				AccumulateOwned(threadId,*it);
+		}
+		else
+		{
+			for(auto it = _threadStats.begin(); it != _threadStats.end(); ++it)
+			{
+				CompletedSampleArray& samples = it->_completed[threadId];
+				for(auto is = samples.begin(); is != samples.end(); ++is)
+					AccumulateOwned(threadId,*is);
+				samples.clear();
+			}
+		}
+	}
+
+	inline size_t PixelOwner(size_t imageIndex) const
+	{
+		return (imageIndex / PixelsPerTile) % _threadStats.size();
+	}
+
+	// the pixel a splat's image location falls into
+	inline size_t SplatPixel(const typename SampleData::SampleOutput& sample) const
+	{
+		const size_t x = (size_t)std::min<int>((int)_imageSize.x() - 1,std::max<int>(0,(int)(sample._imageXY.x() * (Real)_imageSize.x())));
+		const size_t y = (size_t)std::min<int>((int)_imageSize.y() - 1,std::max<int>(0,(int)(sample._imageXY.y() * (Real)_imageSize.y())));
+		return y*_imageSize.x() + x;
+	}
+
+	// pixels whose centers lie within the filter radius of the sample, clipped to the image
+	inline void FilterFootprint(const typename SampleData::SampleOutput& sample,Vector2i& begin,Vector2i& end) const
+	{
+		const Real px = sample._imageXY.x() * (Real)_imageSize.x() - 0.5f;
+		const Real py = sample._imageXY.y() * (Real)_imageSize.y() - 0.5f;
+		const Real radius = _filter.radius();
+
+		begin = Vector2i( std::max<int>(0,(int)ceil(px - radius)), std::max<int>(0,(int)ceil(py - radius)) );
+		end = Vector2i( std::min<int>((int)_imageSize.x(),(int)floor(px + radius) + 1), std::min<int>((int)_imageSize.y(),(int)floor(py + radius) + 1) );
+	}
+
+	inline void BinCompleted(size_t threadId,const typename SampleData::SampleOutput& completed)
+	{
+		const size_t imageIndex = completed._splat ? SplatPixel(completed) : (size_t)(completed._index % _finalImage.size());
+
+		// the owner of the sample's own pixel keeps its statistics
+		size_t owners[MaxFootprintOwners];
+		size_t numOwners = 0;
+		owners[numOwners++] = PixelOwner(imageIndex);
+
+		if(!_filter.isBox())
+		{
+			Vector2i begin,end;
+			FilterFootprint(completed,begin,end);
+
+			for(int y = begin.y(); y < end.y(); ++y)
+			{
+				const size_t row = (size_t)y*_imageSize.x();
+				const size_t firstTile = (row + begin.x()) / PixelsPerTile;
+				const size_t lastTile = (row + std::max<int>(begin.x(),end.x() - 1)) / PixelsPerTile;
+
+				for(size_t tile = firstTile; tile <= lastTile && numOwners < MaxFootprintOwners; ++tile)
+				{
+					const size_t owner = tile % _threadStats.size();
+					if(std::find(owners,owners + numOwners,owner) == owners + numOwners)
+						owners[numOwners++] = owner;
+				}
+			}
+		}
+
+		for(size_t i = 0; i < numOwners; ++i)
+			_threadStats[threadId]._completed[owners[i]].push_back(completed);
+	}
+
+	// adds the sample to the pixels of this thread, the box filter only touches the sample's own pixel
+	// splats are filtered with the same weights as camera samples, but summed into the light image
+	// so they are scaled by the filter's integral instead of divided by the accumulated weight
+	inline void AccumulateOwned(size_t threadId,const typename SampleData::SampleOutput& sample)
+	{
+		if(sample._splat)
+		{
+			if(_filter.isBox())
+			{
+				const size_t pixel = SplatPixel(sample);
+				if(PixelOwner(pixel) == threadId)
+					_lightImage[pixel] += sample._result;
+				return;
+			}
+		}
+		else
+		{
+			const size_t imageIndex = (size_t)(sample._index % _finalImage.size());
+
+			if(PixelOwner(imageIndex) == threadId)
+				_finalImage[imageIndex].pushData(sample._result);
+
+			if(_filter.isBox())
+				return;
+		}
+
+		Vector2i begin,end;
+		FilterFootprint(sample,begin,end);
+
+		// separable, one table lookup per footprint column and row
+		const Real px = sample._imageXY.x() * (Real)_imageSize.x() - 0.5f;
+		const Real py = sample._imageXY.y() * (Real)_imageSize.y() - 0.5f;
+
+		const Real scale = sample._splat ? _filter.normalization() : 1.0f;
+
+		Real weightX[2*PixelFilter::MaxRadius + 1];
+		for(int x = begin.x(); x < end.x(); ++x)
+			weightX[x - begin.x()] = _filter((Real)x - px) * scale;
+
+		for(int y = begin.y(); y < end.y(); ++y)
+		{
+			const Real weightY = _filter((Real)y - py);
+			const size_t row = (size_t)y*_imageSize.x();
+
+			for(int x = begin.x(); x < end.x(); ++x)
+			{
+				const size_t pixel = row + (size_t)x;
+				const Real weight = weightX[x - begin.x()] * weightY;
+
+				if(weight == 0.0f || PixelOwner(pixel) != threadId)
+					continue;
+
+				if(sample._splat)
+					_lightImage[pixel] += sample._result * weight;
+				else
+					_finalImage[pixel].splatData(sample._result,weight);
+			}
+		}
+	}
+
 	template<IMAGE_FORMAT _Format> inline void Gather(ImageRect<_Format> out) const
 	{	
 		up completed = _numCompletedSamples;
@@ -171,7 +350,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 
 		for(size_t i = begin1; i < end1; ++i)
 		{
-			Vector4 color = _finalImage[i].Mean();
+			Vector4 color = PixelMean(i);
 
 			color.head<3>() = (color.head<3>().array() / (color.head<3>().array() + Vector3(1.0f,1.0f,1.0f).array())).matrix();
 
@@ -184,7 +363,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		}
 		for(size_t i = begin2; i < end2; ++i)
 		{
-			Vector4 color = _finalImage[i].Mean();
+			Vector4 color = PixelMean(i);
 
 			color.head<3>() = (color.head<3>().array() / (color.head<3>().array() + Vector3(1.0f,1.0f,1.0f).array())).matrix();
 
@@ -226,13 +405,13 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 
 		for(size_t i = begin1; i < end1; ++i)
 		{
-			Vector4 color = _finalImage[i].Mean();
+			Vector4 color = PixelMean(i);
 			color.w() = std::min<f32>(1.0f,std::max<f32>(0.0f,color.w()));
 			out( (u32)(i % _imageSize.x()) , (u32)(i / _imageSize.x()) ) = Pixel<RGBA_FLOAT32>(color);
 		}
 		for(size_t i = begin2; i < end2; ++i)
 		{
-			Vector4 color = _finalImage[i].Mean();
+			Vector4 color = PixelMean(i);
 			color.w() = std::min<f32>(1.0f,std::max<f32>(0.0f,color.w()));
 			out( (u32)(i % _imageSize.x()) , (u32)(i / _imageSize.x()) ) = Pixel<RGBA_FLOAT32>(color);
 		}
@@ -243,6 +422,10 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		assert(xRes == _imageSize.x());
 		assert(yRes == _imageSize.y());
 
+		// splats reach beyond the pixels of the latest samples, redraw the whole image
+		if((!_filter.isBox() || _numSplattedSamples) && _numDrawnSamples < _numCompletedSamples)
+			_numDrawnSamples = (_numCompletedSamples > _finalImage.size()) ? _numCompletedSamples - _finalImage.size() : 0;
+
 		switch(format)
 		{
 		case A8R8G8B8:
@@ -259,14 +442,41 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		GatherPreview(format,xRes,yRes,pDataOut);
 	}
 
+	// every sample traced one light subpath, so the splats are scaled by the pixel count over the samples
+	inline Vector4 PixelMean(size_t pixel) const
+	{
+		Vector4 mean = _finalImage[pixel].Mean();
+		if(_numCompletedSamples)
+			mean += _lightImage[pixel] * ((Real)_finalImage.size() / (Real)_numCompletedSamples);
+		return mean;
+	}
+
+	// index order, splats of the same sample after it by image location so ties are ordered too
+	struct SampleOrder
+	{
+		inline bool operator()(const typename SampleData::SampleOutput& a,const typename SampleData::SampleOutput& b) const
+		{
+			if(a._index != b._index)
+				return a._index < b._index;
+			if(a._splat != b._splat)
+				return b._splat;
+			if(a._imageXY.x() != b._imageXY.x())
+				return a._imageXY.x() < b._imageXY.x();
+			return a._imageXY.y() < b._imageXY.y();
+		}
+	};
+
 	struct FinalImageElement
 	{
 		
 		Vector4				_mean;
 		Vector4				_s;
+		// filter weighted sum of the samples around the pixel, unused by the box filter
+		Vector4				_filtered;
 		size_t				_numSamples;
+		Real				_filterWeight;
 
-		inline FinalImageElement() : _numSamples(0) {}
+		inline FinalImageElement() : _mean(0.0f,0.0f,0.0f,0.0f), _s(0.0f,0.0f,0.0f,0.0f), _filtered(0.0f,0.0f,0.0f,0.0f), _numSamples(0), _filterWeight(0.0f) {}
 
 		inline void pushData(const Vector4& element)
 		{
@@ -274,7 +484,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 			{
 				++_numSamples;
 				Vector4 newMean = _mean + (element - _mean)/(Real)_numSamples;
-				_s += ((element - _mean).array()/(element - newMean).array()).matrix();
+				_s += ((element - _mean).array()*(element - newMean).array()).matrix();
 				_mean = newMean;
 			}
 			else
@@ -285,14 +495,25 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 			}
 		}
 
+		inline void splatData(const Vector4& element,Real weight)
+		{
+			_filtered += element * weight;
+			_filterWeight += weight;
+		}
+
 		inline Real Variance() const
 		{
 			Vector4 variance = (_numSamples > 1) ? Vector4(_s/(Real)(_numSamples - 1) ) : Vector4(0.0f,0.0f,0.0f,0.0f);
 			return variance.x() + variance.y() + variance.z() + variance.w();
 		}
 
+		// the weight grows by the filter's integral per sample, one for Mitchell and up to two for the others.
+		// Mitchell's negative lobes can still leave it near zero where the samples fell on them, the ratio
+		// blows up there, so below a quarter per sample the unfiltered mean of the pixel's own samples is used
 		inline Vector4 Mean() const
 		{
+			if(_filterWeight > 0.25f * (Real)std::max<size_t>(_numSamples,1))
+				return _filtered / _filterWeight;
 			return _mean;
 		}
 
@@ -300,16 +521,32 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 		EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 	};
 
+	// elements are 64 bytes, a tile is a whole number of cache lines
+	static const size_t PixelsPerTile = 64;
+	static const size_t CacheLineSize = 64;
+	// a footprint row spans at most two tiles, plus the owner of the sample's own pixel
+	static const size_t MaxFootprintOwners = 2*(2*PixelFilter::MaxRadius + 1) + 1;
+
+	typedef std::vector<FinalImageElement,AlignedAllocator<FinalImageElement,CacheLineSize>> FinalImageArray;
+	typedef std::vector<typename SampleData::SampleOutput,AlignedAllocator<typename SampleData::SampleOutput,CacheLineSize>> CompletedSampleArray;
+
 	struct ThreadStats
 	{
 		size_t						_numGenerated;
 		size_t						_numCompleted;
+		size_t						_numSplatted;
+		// samples popped by this thread, one array per owning thread
+		std::vector<CompletedSampleArray,AlignedAllocator<CompletedSampleArray,CacheLineSize>>	_completed;
+		// samples of this thread's tiles, deterministic mode only
+		CompletedSampleArray		_owned;
 	};
 
 	std::auto_ptr<boost::barrier>	_generateBarrier;
 
 	Vector2u						_imageSize;
-	std::vector<FinalImageElement>	_finalImage;
+	FinalImageArray					_finalImage;
+	// sum of the splats landing in each pixel, owned like the pixels
+	std::vector<Vector4,AlignedAllocator<Vector4,CacheLineSize>>	_lightImage;
 	std::vector<ThreadStats>			_threadStats;
 	
 	size_t					_maxGenerateSamples;
@@ -317,6 +554,7 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 	size_t					_nextGenerateSamples;
 	size_t					_numGeneratedSamples;
 	size_t					_numCompletedSamples;
+	size_t					_numSplattedSamples;
 	size_t					_numDesiredSamples;
 	mutable size_t			_numDrawnSamples;
 
@@ -324,6 +562,10 @@ template<class _SampleData,class _SceneReader> struct SamplerBase : public ISamp
 
 	Vector2					_pixelSize;
 
+	bool					_deterministic;
+
+	PixelFilter				_filter;
+
 	SampleData*				_sampleData;
 };
 
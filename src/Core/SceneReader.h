@@ -20,10 +20,12 @@
 #define RAYTRACE_SCENE_READER_GUARD
 
 #include <RaytraceCommon.h>
+#include <array>
 #include <boost/icl/split_interval_map.hpp>
 #include "SceneImp.h"
 #include "TriMeshImp.h"
 #include "MaterialImp.h"
+#include "LightImp.h"
 #include "MathHelper.h"
 #include "OutputImp.h"
 
@@ -39,7 +41,13 @@ namespace Raytrace {
 				(SceneReaderProperty_FieldOfView,Property(&LoadedSceneReader::GetFieldOfView))
 				(SceneReaderProperty_Aspect,Property(&LoadedSceneReader::GetAspect))
 				(SceneReaderProperty_MultisampleCount,Property(&LoadedSceneReader::GetMultisampleCount))
-				(SceneReaderProperty_PrimitiveType_Triangle,Property(&LoadedSceneReader::GetPrimitiveType));
+				(SceneReaderProperty_PrimitiveType,Property(&LoadedSceneReader::GetPrimitiveType))
+				(SceneReaderProperty_CacheDirectory,Property(&LoadedSceneReader::GetCacheDirectory))
+				(SceneReaderProperty_Deterministic,Property(&LoadedSceneReader::GetDeterministic))
+				(SceneReaderProperty_PixelFilter,Property(&LoadedSceneReader::GetPixelFilter))
+				(SceneReaderProperty_IntersectorStatistics,Property(&LoadedSceneReader::GetIntersectorStatistics))
+				(SceneReaderProperty_OutOfCoreChunkPrimitives,Property(&LoadedSceneReader::GetOutOfCoreChunkPrimitives))
+				(SceneReaderProperty_OutOfCoreMemory,Property(&LoadedSceneReader::GetOutOfCoreMemory));
 			return set;
 		}
 
@@ -72,6 +80,14 @@ namespace Raytrace {
 			Vector3 up = (camera->GetUp() - from).normalized();
 
 			_viewMatrix = FromLookAt(from,to,up);
+
+			curr = scene->GetFirstObject(ObjectType::Light);
+			while(curr.get())
+			{
+				parseLight(curr);
+
+				curr = scene->GetNextObject(curr,ObjectType::Light);
+			}
 		}
 
 		virtual size_t GetNumPrimitives() const
@@ -153,12 +169,25 @@ namespace Raytrace {
 		
 		virtual size_t			GetNumLights() const
 		{
-			return 0;
+			return _lights.size();
 		}
 
-		virtual void			GetLight(size_t i,LightData* pMaterialOut) const
+		// in view space like the primitives
+		virtual void			GetLight(size_t i,LightData* pLightOut) const
 		{
-			return;
+			const Light& light = _lights[i];
+
+			Vector4 position,edge1,edge2;
+			position.head<3>() = light->GetPosition();
+			edge1.head<3>() = light->GetEdge1();
+			edge2.head<3>() = light->GetEdge2();
+			position.w() = 1.0f; edge1.w() = 0.0f; edge2.w() = 0.0f;
+
+			pLightOut->_type = (light->GetLightType() == "area") ? LightData::LIGHT_AREA : LightData::LIGHT_POINT;
+			pLightOut->_color = light->GetColor().head<3>() * light->GetIntensity();
+			pLightOut->_location = (_viewMatrix*position).head<3>();
+			pLightOut->_edge1 = (_viewMatrix*edge1).head<3>();
+			pLightOut->_edge2 = (_viewMatrix*edge2).head<3>();
 		}
 		
 		Vector2u		GetBackgroundRadianceSize() const
@@ -203,12 +232,59 @@ namespace Raytrace {
 		{
 			return SceneReaderProperty_PrimitiveType_Triangle;
 		}
+		inline String GetCacheDirectory() const 
+		{
+			String directory;
+			if(!_output->GetPropertyValue(SceneReaderProperty_CacheDirectory,directory))
+				return String();
+			return directory;
+		}
+		inline bool GetDeterministic() const 
+		{
+			bool deterministic;
+			if(!_output->GetPropertyValueTyped(SceneReaderProperty_Deterministic,deterministic))
+				return false;
+			return deterministic;
+		}
+		inline String GetPixelFilter() const 
+		{
+			String filter;
+			if(!_output->GetPropertyValue(SceneReaderProperty_PixelFilter,filter))
+				return String();
+			return filter;
+		}
+		inline bool GetIntersectorStatistics() const 
+		{
+			bool statistics;
+			if(!_output->GetPropertyValueTyped(SceneReaderProperty_IntersectorStatistics,statistics))
+				return false;
+			return statistics;
+		}
+		inline u32 GetOutOfCoreChunkPrimitives() const 
+		{
+			u32 primitives;
+			if(!_output->GetPropertyValueTyped(SceneReaderProperty_OutOfCoreChunkPrimitives,primitives))
+				return 0;
+			return primitives;
+		}
+		inline u32 GetOutOfCoreMemory() const 
+		{
+			u32 megabytes;
+			if(!_output->GetPropertyValueTyped(SceneReaderProperty_OutOfCoreMemory,megabytes))
+				return 0;
+			return megabytes;
+		}
 
 		void parseMaterial(const Material& material)
 		{
 			_materials.push_back(material);
 		}
 
+		void parseLight(const Light& light)
+		{
+			_lights.push_back(light);
+		}
+
 		void parseTriMesh(const TriMesh& triMesh)
 		{
 			boost::intrusive_ptr<TriMeshImp> imp(dynamic_cast<TriMeshImp*>(triMesh.get()));
@@ -271,6 +347,7 @@ namespace Raytrace {
 		Matrix4										_viewMatrix;
 		IntervalMap									_primitives;
 		std::vector<Material>						_materials;
+		std::vector<Light>							_lights;
 		Vector2u									_resolution;
 		public:
 		  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -282,19 +359,53 @@ namespace Raytrace {
 		typedef SimpleTriangle PrimitiveType;
 		typedef ISceneReader::MaterialData MaterialData;
 
-		SceneReaderAdapter( const boost::shared_ptr<ISceneReader>& sceneReader) : _sceneReader(sceneReader)
+		SceneReaderAdapter( const boost::shared_ptr<ISceneReader>& sceneReader) : _sceneReader(sceneReader),_primitiveStride(1)
+		{
+			String type;
+			_sceneReader->GetPropertyValue(SceneReaderProperty_PrimitiveType,type);
+			_analytic = type == SceneReaderProperty_PrimitiveType_Analytic;
+			_moving = type == SceneReaderProperty_PrimitiveType_Moving;
+		}
+
+		// every primitiveStride'th primitive of another reader, used to build throwaway acceleration structures
+		SceneReaderAdapter( const SceneReaderAdapter& sceneReader,size_t primitiveStride) : _sceneReader(sceneReader._sceneReader),_primitiveStride(sceneReader._primitiveStride*primitiveStride),_primitives(sceneReader._primitives),_analytic(sceneReader._analytic),_moving(sceneReader._moving)
 		{
 		}
+
+		// the listed primitives of another reader, used to build one part of the scene at a time
+		SceneReaderAdapter( const SceneReaderAdapter& sceneReader,const std::vector<u32>& primitives) : _sceneReader(sceneReader._sceneReader),_primitiveStride(1),_analytic(sceneReader._analytic),_moving(sceneReader._moving)
+		{
+			boost::shared_ptr<std::vector<u32>> sourcePrimitives(new std::vector<u32>(primitives.size()));
+
+			for(size_t i = 0; i < primitives.size(); ++i)
+				(*sourcePrimitives)[i] = (u32)sceneReader.getSourceIndex(primitives[i]);
+
+			_primitives = sourcePrimitives;
+		}
 		
 		inline size_t getNumPrimitives() const
 		{
-			return (int)_sceneReader->GetNumPrimitives();
+			const size_t sourceCount = _primitives ? _primitives->size() : (size_t)_sceneReader->GetNumPrimitives();
+			return (sourceCount + _primitiveStride - 1) / _primitiveStride;
 		}
 		
 		inline void getPrimitive(size_t i,PrimitiveType& t,int& material) const
 		{
+			if(_analytic)
+			{
+				getAnalyticPrimitive(i,t,material);
+				return;
+			}
+
+			if(_moving)
+			{
+				std::array<Vector3,3> motion;
+				getPrimitive(i,t,motion,material);
+				return;
+			}
+
 			ISceneReader::PrimitiveTriangle triangle;
-			_sceneReader->GetPrimitive(i,&triangle);
+			_sceneReader->GetPrimitive(getSourceIndex(i),&triangle);
 
 			t.setPoint(0, triangle._p1);
 			t.setPoint(1, triangle._p2);
@@ -302,6 +413,38 @@ namespace Raytrace {
 			material = triangle._material;
 		}
 
+		// the primitive when the shutter opens and how far its vertices move until it closes
+		inline void getPrimitive(size_t i,PrimitiveType& t,std::array<Vector3,3>& motion,int& material) const
+		{
+			if(!_moving)
+			{
+				getPrimitive(i,t,material);
+				motion.fill(Vector3(0.0f,0.0f,0.0f));
+				return;
+			}
+
+			ISceneReader::PrimitiveMoving moving;
+			_sceneReader->GetPrimitive(getSourceIndex(i),&moving);
+
+			t.setPoint(0, moving._p1);
+			t.setPoint(1, moving._p2);
+			t.setPoint(2, moving._p3);
+			motion[0] = moving._motion1;
+			motion[1] = moving._motion2;
+			motion[2] = moving._motion3;
+			material = moving._material;
+		}
+
+		inline bool hasAnalyticPrimitives() const
+		{
+			return _analytic;
+		}
+
+		inline bool hasMovingPrimitives() const
+		{
+			return _moving;
+		}
+
 		inline size_t getNumMaterials() const
 		{
 			return (int)_sceneReader->GetNumMaterials();
@@ -366,6 +509,79 @@ namespace Raytrace {
 
 		}
 		
+		// empty if the reader has no place to keep cached acceleration data or is only a sample of the scene
+		inline String getCacheDirectory() const
+		{
+			String directory;
+			if(_primitiveStride == 1 && _sceneReader->GetPropertyValue(SceneReaderProperty_CacheDirectory,directory))
+			{
+				return directory;
+			}
+			else
+				return String();
+
+		}
+		
+		inline bool isDeterministic() const
+		{
+			bool deterministic;
+			if(_sceneReader->GetPropertyValueTyped(SceneReaderProperty_Deterministic,deterministic))
+			{
+				return deterministic;
+			}
+			else
+				return false;
+
+		}
+		
+		inline bool collectIntersectorStatistics() const
+		{
+			bool statistics;
+			if(_sceneReader->GetPropertyValueTyped(SceneReaderProperty_IntersectorStatistics,statistics))
+			{
+				return statistics;
+			}
+			else
+				return false;
+
+		}
+		
+		inline size_t getOutOfCoreChunkPrimitives() const
+		{
+			u32 primitives;
+			if(_sceneReader->GetPropertyValueTyped(SceneReaderProperty_OutOfCoreChunkPrimitives,primitives) && primitives > 0)
+			{
+				return primitives;
+			}
+			else
+				return 1 << 18;
+
+		}
+		
+		inline u64 getOutOfCoreResidentBytes() const
+		{
+			u32 megabytes;
+			if(_sceneReader->GetPropertyValueTyped(SceneReaderProperty_OutOfCoreMemory,megabytes) && megabytes > 0)
+			{
+				return (u64)megabytes << 20;
+			}
+			else
+				return (u64)512 << 20;
+
+		}
+		
+		inline String getPixelFilter() const
+		{
+			String filter;
+			if(_sceneReader->GetPropertyValue(SceneReaderProperty_PixelFilter,filter))
+			{
+				return filter;
+			}
+			else
+				return String();
+
+		}
+		
 		inline Real getFoV() const
 		{
 			Real fov;
@@ -395,7 +611,49 @@ namespace Raytrace {
 		}
 	private:
 
+		inline size_t getSourceIndex(size_t i) const
+		{
+			return _primitives ? (*_primitives)[i*_primitiveStride] : i*_primitiveStride;
+		}
+
+		// disks and spheres are stored as their center and two points at right angles to each other
+		inline void getAnalyticPrimitive(size_t i,PrimitiveType& t,int& material) const
+		{
+			typedef ISceneReader::PrimitiveAnalytic PrimitiveAnalytic;
+
+			PrimitiveAnalytic analytic;
+			_sceneReader->GetPrimitive(getSourceIndex(i),&analytic);
+
+			material = analytic._material;
+			t.setPoint(0, analytic._p1);
+
+			switch(analytic._shape)
+			{
+			case PrimitiveAnalytic::SHAPE_DISK:
+			case PrimitiveAnalytic::SHAPE_SPHERE:
+				{
+					const Vector3 normal = analytic._shape == PrimitiveAnalytic::SHAPE_DISK ? Vector3(analytic._normal.normalized()) : Vector3(0.0f,0.0f,1.0f);
+					Vector3 tangent = normal.cross(fabs(normal.x()) < 0.9f ? Vector3(1.0f,0.0f,0.0f) : Vector3(0.0f,1.0f,0.0f)).normalized();
+					Vector3 bitangent = normal.cross(tangent);
+
+					t.setPoint(1, analytic._p1 + tangent * analytic._radius);
+					t.setPoint(2, analytic._p1 + bitangent * analytic._radius);
+					t.setShape(analytic._shape == PrimitiveAnalytic::SHAPE_DISK ? PrimitiveShapeDisk : PrimitiveShapeSphere);
+				}
+				break;
+			default:
+				t.setPoint(1, analytic._p2);
+				t.setPoint(2, analytic._p3);
+				t.setShape(analytic._shape == PrimitiveAnalytic::SHAPE_QUAD ? PrimitiveShapeQuad : PrimitiveShapeTriangle);
+				break;
+			}
+		}
+
 		boost::shared_ptr<ISceneReader> _sceneReader;
+		size_t							_primitiveStride;
+		boost::shared_ptr<const std::vector<u32>>	_primitives;
+		bool							_analytic;
+		bool							_moving;
 	};
 
 
@@ -0,0 +1,533 @@
+/********************************************************/
+// FILE: SobolDirections.cpp
+// DESCRIPTION: Sobol direction numbers, generated by projects/scripts/GenerateSobolDirections.py
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)    
+/********************************************************/
+// This work is licensed under the Creative Commons 
+// Attribution-NonCommercial 3.0 Unported License. 
+// To view a copy of this license, visit 
+// http://creativecommons.org/licenses/by-nc/3.0/ or send 
+// a letter to Creative Commons, 444 Castro Street, 
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+#include "SobolDirections.h"
+
+namespace Raytrace {
+
+extern const u32 __data_sobolDirections[SobolDirectionDimensions][SobolDirectionBits+1] = {
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0x08000000,0x04000000,0x02000000,0x01000000,0x00800000,0x00400000,0x00200000,0x00100000,0x00080000,0x00040000,0x00020000,0x00010000,0x00008000,0x00004000,0x00002000,0x00001000,0x00000800,0x00000400,0x00000200,0x00000100,0x00000080,0x00000040,0x00000020,0x00000010,0x00000008,0x00000004,0x00000002,0x00000001 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0x88000000,0xcc000000,0xaa000000,0xff000000,0x80800000,0xc0c00000,0xa0a00000,0xf0f00000,0x88880000,0xcccc0000,0xaaaa0000,0xffff0000,0x80008000,0xc000c000,0xa000a000,0xf000f000,0x88008800,0xcc00cc00,0xaa00aa00,0xff00ff00,0x80808080,0xc0c0c0c0,0xa0a0a0a0,0xf0f0f0f0,0x88888888,0xcccccccc,0xaaaaaaaa,0xffffffff },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0xe8000000,0x5c000000,0x8e000000,0xc5000000,0x68800000,0x9cc00000,0xee600000,0x55900000,0x80680000,0xc09c0000,0x60ee0000,0x90550000,0xe8808000,0x5cc0c000,0x8e606000,0xc5909000,0x6868e800,0x9c9c5c00,0xeeee8e00,0x5555c500,0x8000e880,0xc0005cc0,0x60008e60,0x9000c590,0xe8006868,0x5c009c9c,0x8e00eeee,0xc5005555 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xf8000000,0x74000000,0xa2000000,0x93000000,0xd8800000,0x25400000,0x59e00000,0xe6d00000,0x78080000,0xb40c0000,0x82020000,0xc3050000,0x208f8000,0x51474000,0xfbea2000,0x75d93000,0xa0858800,0x914e5400,0xdbe79e00,0x25db6d00,0x58800080,0xe54000c0,0x79e00020,0xb6d00050,0x800800f8,0xc00c0074,0x200200a2,0x50050093 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0xf8000000,0xdc000000,0x7a000000,0x9d000000,0x5a800000,0x2fc00000,0xa1600000,0xf0b00000,0xda880000,0x6fc40000,0x81620000,0x40bb0000,0x22878000,0xb3c9c000,0xfb65a000,0xddb2d000,0x78022800,0x9c0b3c00,0x5a0fb600,0x2d0ddb00,0xa2878080,0xf3c9c040,0xdb65a020,0x6db2d0b0,0x800228f8,0x400b3cdc,0x200fb67a,0xb00ddb9d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0xc8000000,0x24000000,0x56000000,0xfb000000,0xe0800000,0x70400000,0xa8600000,0x14300000,0x9ec80000,0xdf240000,0xb6d60000,0x8bbb0000,0x48008000,0x64004000,0x36006000,0xcb003000,0x2880c800,0x54402400,0xfe605600,0xef30fb00,0x7e48e080,0xaf647040,0x1eb6a860,0x9f8b1430,0xd6c81ec8,0xbb249f24,0x80d6d6d6,0x40bbbbbb },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x58000000,0x94000000,0x3e000000,0xe3000000,0xbe800000,0x23c00000,0x1e200000,0xf3100000,0x46780000,0x67840000,0x78460000,0x84670000,0xc6788000,0xa784c000,0xd846a000,0x5467d000,0x9e78d800,0x33845400,0xe6469e00,0xb7673300,0x20f86680,0x104477c0,0xf8668020,0x4477c010,0x668020f8,0x77c01044,0x8020f866,0xc0104477 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x88000000,0x24000000,0x12000000,0x2d000000,0x76800000,0x9e400000,0x08200000,0x64100000,0xb2280000,0x7d140000,0xfea20000,0xba490000,0x1a248000,0x491b4000,0xc4b5a000,0xe3739000,0xf6800800,0xde400400,0xa8200a00,0x34100500,0x3a280880,0x59140240,0xeca20120,0x974902d0,0x6ca48768,0xd75b49e4,0xcc95a082,0x87639641 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x28000000,0xd4000000,0x6a000000,0x71000000,0x38800000,0x58400000,0xea200000,0x31100000,0x98a80000,0x08540000,0xc22a0000,0xe5250000,0xf2b28000,0x79484000,0xfaa42000,0xbd731000,0x18a80800,0x48540400,0x622a0a00,0xb5250500,0xdab28280,0xad484d40,0x90a426a0,0xcc731710,0x20280b88,0x10140184,0x880a04a2,0x84350611 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0x98000000,0x94000000,0x8a000000,0x5b000000,0x33800000,0xd9c00000,0x72200000,0x3f100000,0xc1b80000,0xa6ec0000,0x53860000,0x29f50000,0x0a3a8000,0x1b2ac000,0xd392e000,0x69ff7000,0xea380800,0xab2c0400,0x4ba60e00,0xfde50b00,0x60028980,0xf006c940,0x7834e8a0,0x241a75b0,0x123a8b38,0xcf2ac99c,0xb992e922,0x82ff78f1 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0x08000000,0x6c000000,0x9e000000,0x23000000,0x57800000,0xadc00000,0x7fa00000,0x91d00000,0x49880000,0xced40000,0x880a0000,0x2c0f0000,0x3e0d8000,0x3317c000,0x5fb06000,0xc1f8b000,0xe18d8800,0xb2d7c400,0x1e106a00,0x6328b100,0xf7858880,0xbdc3c2c0,0x77ba63e0,0xfdf7b330,0xd7800df8,0xedc0081c,0xdfa0041a,0x81d00a2d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0x58000000,0xac000000,0x96000000,0x2b000000,0xd4800000,0x09400000,0xe2a00000,0x52500000,0x4e280000,0xc71c0000,0x629e0000,0x12670000,0x6e138000,0xf731c000,0x3a98a000,0xbe449000,0xf83b8800,0xdc2dc400,0xee06a200,0xb7239300,0x1aa80d80,0x8e5c0ec0,0xa03e0b60,0x703701b0,0x783b88c8,0x9c2dca54,0xce06a74a,0x87239795 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0xf8000000,0x8c000000,0xe2000000,0x33000000,0x0f800000,0x21400000,0x95a00000,0x5e700000,0xd8080000,0x1c240000,0xba160000,0xef370000,0x15868000,0x9e6fc000,0x781b6000,0x4c349000,0x420e8800,0x630bcc00,0xf7ad6a00,0xad739500,0x77800780,0x6d4004c0,0xd7a00420,0x3d700630,0x2f880f78,0xb1640ad4,0xcdb6077a,0x824706d7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x38000000,0xc4000000,0x42000000,0xa3000000,0xf1800000,0xaa400000,0xfce00000,0x85100000,0xe0080000,0x500c0000,0x58060000,0x54090000,0x7a038000,0x670c4000,0xb3842000,0x094a3000,0x0d6f1800,0x2f5aa400,0x1ce7ce00,0xd5145100,0xb8000080,0x040000c0,0x22000060,0x33000090,0xc9800038,0x6e4000c4,0xbee00042,0x261000a3 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xa8000000,0x54000000,0x9a000000,0x9d000000,0x1e800000,0x5cc00000,0x7d200000,0x8d100000,0x24880000,0x71c40000,0xeba20000,0x75df0000,0x6ba28000,0x35d14000,0x4ba3a000,0xc5d2d000,0xe3a16800,0x91db8c00,0x79aef200,0x0cdf4100,0x672a8080,0x50154040,0x1a01a020,0xdd0dd0f0,0x3e83e8a8,0xaccacc54,0xd52d529a,0xd91d919d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0xd8000000,0xc4000000,0x46000000,0x85000000,0xa5800000,0x76c00000,0xada00000,0x6ab00000,0x2da80000,0xaabc0000,0x0daa0000,0x7ab10000,0xd5a78000,0xbebd4000,0x93a3e000,0x3bb51000,0x3629b800,0x4d727c00,0x9b836200,0x27c4d700,0xb629b880,0x8d727cc0,0xbb836220,0xf7c4d7d0,0x6e29b858,0x49727c04,0xfd836266,0x72c4d755 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0x38000000,0x14000000,0xf6000000,0x67000000,0x8f800000,0x50400000,0x8aa00000,0x0ff00000,0x12a80000,0xabf40000,0xfcaa0000,0x28fb0000,0xbd298000,0x0bba4000,0x4e06e000,0x330c3000,0x59861800,0xc74d3400,0x3d2cb200,0x4bb2cb00,0x6e061880,0xc30d3440,0x618cb220,0xd342cbf0,0xcb2e18b8,0x2cb93454,0xe186b2d6,0x9349cb97 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0x68000000,0x64000000,0x36000000,0x6d000000,0x41800000,0xe0400000,0xd2e00000,0x9bf00000,0x0ce80000,0x52fc0000,0x5b6a0000,0x2fb30000,0xa00c8000,0x30054000,0x4807e000,0x940f9000,0x5e01f800,0x090e9400,0x778a5600,0x8d416b00,0x9369f880,0x7bb294c0,0xde005620,0xc9026bf0,0x578d78e8,0x7d4bd4a4,0xfb6db616,0x1fbefb9d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x98000000,0xf4000000,0xae000000,0xbb000000,0xe7800000,0x95c00000,0x1c200000,0xd0300000,0xdba80000,0x55f40000,0xff820000,0x21c10000,0x12238000,0x3b3a4000,0xa42b6000,0x3430f000,0x4da69800,0x4af3ec00,0x2e043a00,0xfb0a1f00,0x47851880,0xc5c9ac40,0x842f5aa0,0x243aef50,0x75a38018,0xeefa40b4,0x180b600e,0xb400f0eb },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0xb8000000,0x3c000000,0xce000000,0x41000000,0x21800000,0x51c00000,0x09600000,0x85700000,0xf2780000,0x8e9c0000,0x60020000,0x70030000,0x58038000,0x8c02c000,0x7602e000,0x7d00f000,0xef833800,0x10c10400,0x28e08600,0xd4b14700,0xfb182580,0x0bee15c0,0x9279c9e0,0xfe9d3a70,0x38000008,0xfc00000c,0x2e00000e,0xf100000b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0x68000000,0x3c000000,0x8a000000,0x51000000,0xa9800000,0xddc00000,0x5ba00000,0x39d00000,0x95f80000,0x56d40000,0x0a020000,0x91030000,0x49838000,0x0dc34000,0x33a1a000,0x05d0f000,0x1ffa2800,0x07d54400,0xa380a600,0x4cc07700,0x1222ee80,0x3413a740,0xa65bf7e0,0x5305ab50,0x15f80008,0x96d4000c,0xea02000e,0x4103000d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0x38000000,0x8c000000,0x7e000000,0x71000000,0xc8800000,0x04c00000,0x1ba00000,0xbb700000,0x4a980000,0xc3bc0000,0xa6020000,0x6d010000,0xee818000,0x29c34000,0x9520e000,0x42b23000,0xe7b9f800,0x0d0dc400,0x3fb92200,0x110d1300,0x19bbee80,0x3c0cadc0,0x973a4a60,0xc5cf7ef0,0x3a180008,0x0b7c0004,0xa3a20006,0x7771000d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x90000000,0x08000000,0x64000000,0x6a000000,0x89000000,0xa5800000,0xcb400000,0x18200000,0xad900000,0xaf880000,0x72f40000,0x25820000,0x0b430000,0xb8228000,0x3d924000,0xa7882000,0x16f59000,0x4f83a800,0x82412400,0x1da01600,0xf6d16d00,0xbfa84080,0xbb672640,0xe0091620,0xf0b4efd0,0x38228008,0xfd92400c,0x0788200a,0x86f59009 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x48000000,0x8c000000,0xd6000000,0x39000000,0xd5800000,0x32400000,0xb2a00000,0x72100000,0x53d80000,0x82cc0000,0xcb820000,0x47430000,0x91208000,0xa9534000,0x7cf92000,0x4e9e3000,0xfcf95800,0x8e9fe400,0xdcf9d600,0x5e9c8900,0x94f96a80,0xd29fb840,0x42f9b760,0xeb9c9f30,0x97788008,0xd9df400c,0x25db2002,0xabcd300d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xd8000000,0xf4000000,0x3e000000,0x95000000,0x8f800000,0x3d400000,0xf3200000,0x2ef00000,0xadc80000,0x0a0c0000,0x8b220000,0x4af30000,0x6bc88000,0x3b0d4000,0xe2a16000,0x16b0d000,0x29687800,0xbdbf1400,0x33cb5e00,0x0f0c2500,0xfca1b480,0xd3b0afc0,0x7eeb6920,0x74fe4d30,0xfee87808,0xb4ff140c,0xdeeb5e02,0xe4fc2505 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x98000000,0xa4000000,0x7a000000,0xd5000000,0x02800000,0x60400000,0x51e00000,0x88700000,0x8c280000,0x47c40000,0x0be20000,0xad710000,0xb6aa8000,0x3386c000,0xb8006000,0x54039000,0x42036800,0xc1019400,0xe0826a00,0x11431100,0x2960af80,0x3d3175c0,0xdf4a3aa0,0xaff49e10,0xd62b6808,0x62c59404,0x31606a0a,0xd932110b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0x18000000,0x34000000,0x8a000000,0x9d000000,0x67800000,0x82400000,0x40e00000,0x60f00000,0x91480000,0x29440000,0x2d620000,0xbfb30000,0x162a8000,0xfbf4c000,0xe4ca6000,0xc207d000,0x2002a800,0xf001b400,0xb8037e00,0x04021900,0x92034b80,0xa90327c0,0xed81f320,0x1f40d810,0x27602808,0xe2b1740c,0xd1ab1e0a,0x49b6c903 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0x08000000,0x4c000000,0x02000000,0xb5000000,0x36800000,0xc2c00000,0x14200000,0x07500000,0x1bf80000,0x50340000,0x48a20000,0xac910000,0xd35b8000,0xbca74000,0x7bfa2000,0xc0343000,0xa0a18800,0x30909400,0xd95b7a00,0x45a57b00,0x4f7a7880,0xb7f6f940,0x82013de0,0xf502dfd0,0xd6820808,0x12c3d404,0x1c235a0e,0x4b504b0d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x50000000,0x68000000,0x4c000000,0x76000000,0xf7000000,0x36800000,0xd7400000,0x87e00000,0xef300000,0xa3a80000,0xd5440000,0x23aa0000,0x15470000,0xc3a98000,0x45464000,0xaba82000,0x09477000,0xdda9f800,0xfe44ac00,0xeb292200,0x2907f100,0x6ccb3d80,0xc6344dc0,0xcf61b320,0x137318d0,0xeccb3d88,0x06344dcc,0x2f61b32e,0x437318d5 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0xc8000000,0x74000000,0x52000000,0x03000000,0xeb800000,0x6f400000,0x64600000,0xdaf00000,0x17980000,0x297c0000,0xa59a0000,0xfa7d0000,0xe61b8000,0x713f4000,0x1878a000,0xdcce9000,0xb661e800,0x99f29c00,0x9c184600,0xd63e2100,0x09fa5780,0x548e0ac0,0xa380a9e0,0x5b413f30,0x56625788,0x49f20ac4,0x341aa9e6,0x323c3f39 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0xb8000000,0x04000000,0x6e000000,0x97000000,0xf2800000,0xedc00000,0x13600000,0x5c900000,0xdb580000,0x31e40000,0x09da0000,0xcc270000,0x02b88000,0x44b44000,0x0fe26000,0xe6505000,0x9ab9d800,0x50b50c00,0x79e29200,0xa552fb00,0xbe38bf80,0x2e77d940,0xf6000ae0,0x830112d0,0x84803f88,0xaec3994c,0x37e26aea,0x225142dd },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x68000000,0xec000000,0x22000000,0x2b000000,0x36800000,0x9d400000,0x6a200000,0x16700000,0x4de80000,0x330c0000,0x936a0000,0x824f0000,0x3b498000,0x8f3fc000,0x28202000,0xcd707000,0xf36aa800,0x724fdc00,0xb34bf200,0x533e6900,0x62207a80,0x0a7140c0,0xe7ea6520,0xc40d90f0,0xefe9fa88,0xd80e80cc,0x45ea452e,0x2f0de0f3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0x28000000,0xd4000000,0x8a000000,0xff000000,0x84800000,0x73c00000,0x13200000,0xc2b00000,0xfb380000,0x361c0000,0x401a0000,0xe0af0000,0x11228000,0x19b3c000,0xfdb82000,0x5edf9000,0x75b88800,0x7adfac00,0xf7baba00,0x61ddf300,0xd1387e80,0x391e55c0,0xcc9ba860,0x776cbeb0,0xa000f688,0xf001f9cc,0x08011262,0xe4014db3 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0xb8000000,0x84000000,0x1a000000,0xaf000000,0xbd800000,0xdfc00000,0x14e00000,0x43500000,0xda380000,0x4e1c0000,0x4cda0000,0x364d0000,0x29608000,0xdc904000,0x6ed86000,0x5d4f5000,0x2ee08800,0xfc51ac00,0x7fb81e00,0x45dc8300,0xfa3a4580,0x5e1d6240,0x54dbd360,0xe24ec930,0x8b62cd88,0xf790ce44,0xc959cd6a,0x2d8f4a35 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x08000000,0xf4000000,0xf6000000,0x8b000000,0xc9800000,0x55400000,0x67200000,0xf3f00000,0x34780000,0x57440000,0x1ada0000,0xb1f50000,0xa9818000,0x6540c000,0x8f23a000,0x77f21000,0xca7bf800,0x2845fc00,0x255afe00,0x6fb67900,0x07233a80,0xc3f25ac0,0xdc7aed60,0xd34482d0,0xe4d94288,0xcef766c4,0x9603b36e,0xbb00ebd7 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0x68000000,0xf4000000,0x62000000,0xdf000000,0x79800000,0xdd400000,0x76e00000,0x2cf00000,0xcfb80000,0x51ec0000,0xc8da0000,0x845d0000,0x9b818000,0x42434000,0xef622000,0x61b19000,0xd1582800,0x891cac00,0x65626e00,0x0ab10900,0x2adbbd80,0x1b5d86c0,0x02014560,0x0f032470,0xf1821588,0xb9426ac4,0x7ce10b6e,0x07f3bd79 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x18000000,0xdc000000,0x42000000,0x37000000,0x20800000,0xf1400000,0x28600000,0x94900000,0x87880000,0xa83c0000,0x556a0000,0xe6ef0000,0xf8038000,0x4c024000,0x3a01e000,0xbb023000,0x7a816800,0x1a43ac00,0x4ae18a00,0x52d31900,0x8f682380,0xcded9740,0xfa80bfa0,0xda43f2b0,0x2ae2cb88,0x02d07b4c,0x976ad5a6,0x11eddbb5 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0xf8000000,0x34000000,0x62000000,0xf5000000,0xa8800000,0xfcc00000,0x8e200000,0x53f00000,0xc7780000,0x95740000,0xb8020000,0xd4e50000,0xb2808000,0xfdc0c000,0x64a02000,0xaa30f000,0x19d8f800,0x0e443400,0x935a6200,0xe761f500,0x657a2880,0x40913cc0,0xe0022e20,0xd0e563f0,0x08809f78,0xccc09174,0x56200202,0x97f0e5e5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0xf8000000,0xec000000,0x7e000000,0x61000000,0x5c800000,0xe6c00000,0xdda00000,0x2a700000,0x93380000,0x13cc0000,0xd3ce0000,0x73790000,0x83a08000,0x7b70c000,0x97b8a000,0xe90cf000,0x886ef800,0xd409ec00,0x3218fe00,0xef7ca100,0xc556fc80,0x56c516c0,0x4556a5a0,0x96c50670,0xe556cd38,0x66c542cc,0x1d56574e,0x8ac549b9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0x58000000,0x2c000000,0x9a000000,0xf9000000,0x3c800000,0xb2c00000,0xad200000,0x3a300000,0x89980000,0x448c0000,0x2eea0000,0x6f810000,0xef208000,0x2f30c000,0x0f182000,0xbf4cb000,0xe74a5800,0xcb712c00,0x51981a00,0xa88c3900,0x94ea1c80,0x268102c0,0x8ba07520,0xb1f0d630,0x38383398,0x7c7c0d8c,0x52524a6a,0x3d3df141 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0xd8000000,0xac000000,0x8e000000,0x09000000,0x9e800000,0xa1c00000,0xcaa00000,0x33700000,0x95780000,0x085c0000,0x24b60000,0x6a350000,0x43788000,0x6d5cc000,0x14362000,0x72f5b000,0xcf585800,0x53ec6c00,0xc5eeae00,0x40d9b900,0xe016c680,0x9045cdc0,0x6880e4a0,0x74c04a70,0x2220f3f8,0x87b0b59c,0x9758b816,0x3fecfc45 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0xa8000000,0x2c000000,0xa2000000,0x2d000000,0xda800000,0xf9400000,0xec600000,0x02b00000,0x3d480000,0x825c0000,0x7d4a0000,0x62610000,0x8dc88000,0xca1c4000,0xa1aae000,0x6891f000,0x8c602800,0xb2b06c00,0x75484200,0x5e5cdd00,0x774a7280,0x6361d540,0xf548ce60,0x1e5c6fb0,0x974a07c8,0x93618b1c,0x5d48b92a,0x325c0cd1 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0xc8000000,0x7c000000,0x82000000,0x4f000000,0xbe800000,0xedc00000,0x21600000,0xab700000,0x78680000,0x746c0000,0x1e9a0000,0xfdcb0000,0x39088000,0x2f1cc000,0x4ef2e000,0xc5a73000,0x6d924800,0xe1d7bc00,0x4b7ae200,0x487bbf00,0xbc801680,0x62c061c0,0x7fe08b60,0x76b0a870,0x91088ce8,0xa31caaac,0xe4f2037a,0xc6a7f47b },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x98000000,0x2c000000,0x06000000,0xcd000000,0x8a800000,0x1bc00000,0xffa00000,0xad500000,0x7af80000,0xb3dc0000,0x5b2e0000,0x1f290000,0x9d588000,0xf28cc000,0x07d62000,0x71f51000,0xd4f61800,0xda65ec00,0x632ea600,0xe3291d00,0x2358b280,0x038ce7c0,0x135641a0,0x8b355c50,0xa7d6ee78,0xa1f5891c,0x6cf6880e,0xe665b4b9 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x98000000,0x54000000,0x3a000000,0x9d000000,0x7e800000,0x7f400000,0x17200000,0xab500000,0x6df80000,0x96a40000,0x83d20000,0x71e10000,0xc0d88000,0xe0f44000,0x30aaa000,0x08059000,0xcc2a1800,0x6e451400,0xa78a1a00,0xe3554d00,0x01d2c680,0x68e1fb40,0xbc589520,0xc6b4b250,0xfb0a1178,0x1515b0e4,0xf272c872,0xb1f12cf1 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x08000000,0x84000000,0xb2000000,0xb9000000,0xbe800000,0x4fc00000,0x55600000,0xf8f00000,0xac280000,0x66d40000,0xb30a0000,0x8bb50000,0xc7c88000,0x11e4c000,0xaa42e000,0xa591b000,0xd0ea8800,0x78854400,0x6c80d200,0x86c0c900,0x03e05680,0x83307bc0,0x4348ef60,0xa324c5f0,0x13a2a0a8,0x1ba19014,0x9f22d8ea,0x2d61fc85 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x78000000,0x24000000,0x9e000000,0x47000000,0x67800000,0xf7400000,0xdf200000,0xb3100000,0x71680000,0x8c4c0000,0x32520000,0xe5d50000,0xaa528000,0x31d5c000,0x2c52e000,0x62d5f000,0xadd29800,0xf695d400,0x8b720600,0xf5c59300,0x42ba6180,0x3dd96440,0xdea0bea0,0xe750d750,0x37c84fc8,0xbf1c9b1c,0x839a1d9a,0x09c94ec9 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x78000000,0x9c000000,0xee000000,0x1b000000,0xcb800000,0xc3400000,0xc7a00000,0x05100000,0x88680000,0xc4740000,0x225a0000,0x3da10000,0x345a8000,0x7aa1c000,0xf1da6000,0x12e17000,0x85fa1800,0x48b1ec00,0x2432f600,0x92d5f700,0x45803d80,0xa8403440,0x94207a20,0xea50f150,0xd9c81248,0x46648524,0x8fb24812,0x21952485 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x58000000,0x7c000000,0xc2000000,0xe1000000,0x0d800000,0xd7c00000,0x2aa00000,0xf5300000,0x9ba80000,0xc0f40000,0x20c60000,0x702f0000,0x48668000,0x241f4000,0xbe4ee000,0x232b5000,0xec28b800,0xda342c00,0xfde6fa00,0xdfdf8d00,0x6eee1780,0x5b1b0ac0,0xe0000520,0x500093f0,0x38008488,0x6c008e04,0x9a000bce,0x9d00d8eb },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xb8000000,0xac000000,0x72000000,0xb1000000,0x03800000,0xd2c00000,0xc1600000,0x9b900000,0x4e480000,0x0b740000,0x864e0000,0x3f0b0000,0x68068000,0x447f4000,0x7648a000,0xe7747000,0xd44e9800,0xbe0b9c00,0xd3864a00,0x3abf5d00,0xc528d180,0xcde413c0,0x99865ae0,0x67bfd550,0x94a8c528,0x9e24cde4,0xe3669986,0x82ef67bf },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x88000000,0x44000000,0x4a000000,0x47000000,0xdd800000,0x42400000,0xc3200000,0x77100000,0x75b80000,0x966c0000,0x715e0000,0xfc950000,0xa6e68000,0xd9f9c000,0x28386000,0x142cb000,0x527e6800,0xfb853400,0x5b5e4200,0x0b95c300,0x1366f780,0xafb9b540,0x2918f6a0,0x603cc150,0xb0469498,0x68a9927c,0x34a09b66,0xc250ebb9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xd8000000,0xfc000000,0xf6000000,0xd5000000,0xbf800000,0x2c400000,0xeee00000,0x09700000,0x19080000,0x21640000,0xad6a0000,0xd3130000,0x22828000,0x9707c000,0x98e0a000,0x1c709000,0x8688f800,0x5d24ac00,0x9b8a2e00,0x26632900,0xcd8ac980,0x63633940,0x8a0af160,0xe323b530,0x4aea8fe8,0xc3534414,0x1a623a62,0x1b774b77 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x58000000,0xac000000,0x6a000000,0x85000000,0xfb800000,0xa8c00000,0x84200000,0xae300000,0x4b080000,0xe0740000,0x10860000,0x388f0000,0xfc2e8000,0x320b4000,0x2980e000,0x91c01000,0x2da03800,0x7ff0fc00,0x06a83200,0xcf842900,0x4e2e9180,0x5b0b2dc0,0xd800ffa0,0xec0046f0,0x0a00af28,0xd5001e44,0xa380038e,0x04c074fb },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0xe8000000,0x44000000,0x5e000000,0xad000000,0xef800000,0x68400000,0x84600000,0xfe500000,0xfd280000,0x07f40000,0x2c620000,0xda4f0000,0x53068000,0x12dfc000,0x6f802000,0xa8403000,0x24602800,0xae501400,0x15283a00,0x43f41100,0x72621780,0x774f2b40,0xbc86bbe0,0x7a9fda10,0xebe00118,0x56100f94,0xd948174a,0xa9a415fd },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0x18000000,0x04000000,0xda000000,0x09000000,0x22800000,0xe8400000,0xbc600000,0x0e300000,0x7b580000,0x378c0000,0x14c20000,0x874d0000,0x99d48000,0xbfb94000,0x18802000,0x91403000,0xe6e01800,0x52702c00,0x05380600,0x34bc0100,0x971a3680,0x51810240,0x13f688a0,0xde847a10,0x466c8f18,0x1745738c,0x91fa26d6,0x73f111e3 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x88000000,0x9c000000,0x2e000000,0x05000000,0xab800000,0x1c400000,0x6e200000,0x25100000,0xfba80000,0x94040000,0xf26e0000,0x0b070000,0xfeaa8000,0x3fd1c000,0xee202000,0x65101000,0xdba80800,0xc4041400,0x7a6e2200,0x97072700,0xd0aa8b80,0x3ad1c140,0x45a00ae0,0x79501710,0xb5881388,0xe1141d44,0x81c61cea,0x03030201 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xc8000000,0x3c000000,0x3e000000,0x67000000,0xf9800000,0xcc400000,0x66600000,0xb3100000,0xaba80000,0x5d240000,0xc4fe0000,0xb8cf0000,0x66bb8000,0x71a8c000,0x10602000,0x28103000,0x4c280800,0xa6641400,0x931e3200,0xfb9f0f00,0x95738f80,0xf89cd9c0,0x86b61e60,0x01bb0310,0x880d9198,0xdc13f8c4,0x4e6db8ea,0xff03e849 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x58000000,0x44000000,0x7e000000,0x69000000,0x5b800000,0xdc400000,0x5a200000,0x87100000,0xdad80000,0x9bec0000,0xbc420000,0xca0f0000,0x6f7c8000,0xc6d9c000,0xa1a02000,0xab501000,0xf8f80800,0xe8fc2c00,0x409a1600,0x7ce31100,0xf6be9f80,0xb996da40,0xcf7cb6e0,0x36d9e710,0xd9a03e88,0x5f501dc4,0xdef828b6,0xc5fc1bfb },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x48000000,0x74000000,0xc2000000,0xe7000000,0xb5800000,0xba400000,0x9b200000,0xa3d00000,0x2f180000,0x81840000,0xd82a0000,0xcc190000,0x5e078000,0xe138c000,0xd8982000,0x9cc41000,0x568a2800,0x65892c00,0xa23f9200,0xb76cdd00,0xedaa1080,0x365929c0,0x65278560,0xf2e8c290,0xbf8014c8,0x694025f4,0x4ca01346,0x4e9035a1 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0x98000000,0xb4000000,0x52000000,0x07000000,0xbf800000,0x5a400000,0x3b200000,0x91d00000,0xd3380000,0xfdec0000,0x954a0000,0x58f10000,0xb5df8000,0x091dc000,0x86b82000,0xa4ac1000,0x7bea2800,0xd0613c00,0x2847a600,0x8c61ed00,0x166a3480,0xcd2111c0,0x0ce787e0,0xb7f1ea90,0x667208c8,0x151d1974,0x1895884e,0x15ecc2bb },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0xf8000000,0x4c000000,0xa6000000,0x89000000,0x6e800000,0x1a400000,0x17600000,0x4bf00000,0xa2f80000,0x7c5c0000,0x7e360000,0x551b0000,0x40808000,0x272d4000,0x93982000,0x7eac3000,0x524e3800,0x43071c00,0xd1d6be00,0x75c65300,0xd7e08980,0xacdd5240,0xd16003a0,0x72f02a90,0xd47803d8,0x5a1c1dfc,0x37563f3e,0xdbeb2e57 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xb8000000,0x3c000000,0xde000000,0xdf000000,0x29800000,0x32400000,0xe9200000,0x62900000,0x71d80000,0x5e3c0000,0x9f2e0000,0x09e70000,0x026b8000,0x5176c000,0x5ef82000,0xafac1000,0x81760800,0xb69b0c00,0x3be5ae00,0xeb41cf00,0x33eb9780,0x2f36e7c0,0xf1d82260,0x1e3c1090,0xbf2e1c48,0x39e71ba4,0xba6b85f6,0x6d76ef4f },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0xf8000000,0x3c000000,0x6e000000,0x19000000,0x50800000,0xca400000,0x7b200000,0xafd00000,0x97a80000,0x4b9c0000,0x55ae0000,0x64ef0000,0xf0288000,0x68524000,0x64082000,0x820c1000,0x8f262800,0x75a33400,0xf4aebe00,0xa8614f00,0x842ebb80,0xf2215640,0xa70e9c20,0xb1f15690,0xa6a6a8c8,0xdf6d40f4,0xcd88886a,0x68c27fa7 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0xc8000000,0xbc000000,0x4e000000,0x57000000,0x80800000,0x0a400000,0xfd200000,0x8db00000,0xffa80000,0xa6840000,0x110e0000,0x4bdf0000,0x74d78000,0xb8724000,0x84082000,0x8a741000,0xbd061800,0xedab3400,0x2fd1b200,0x6ed96f00,0xad59b380,0x05ed45c0,0x23ff9820,0x38b66690,0x8e263548,0x771b286c,0x30f9866a,0x121d6761 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0xa8000000,0xd4000000,0xfa000000,0xf9000000,0x92800000,0x19400000,0x42a00000,0x21500000,0x8ef80000,0xa7040000,0x59920000,0x36f90000,0x2b2e8000,0xffd04000,0x51922000,0x12f91000,0x592e8800,0x62d06c00,0x91120a00,0x26b92500,0x730eb680,0xa3c05240,0xcfca2ea0,0xb9ad2350,0xe6c4a628,0x136d5a14,0x338e8d1e,0xd7804a91 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0x58000000,0x1c000000,0x72000000,0x4f000000,0xa1800000,0x77400000,0x4da00000,0xbd300000,0xaef80000,0x369c0000,0x8ab60000,0xa8850000,0x0fe18000,0xea0dc000,0xf3362000,0x83c51000,0xd041b800,0xa83dec00,0xa44e3600,0xde191700,0x6557a480,0xf288ffc0,0xa4d79e60,0x75c8cad0,0x517797e8,0x64f8c08c,0xd58f8dde,0x0164eb77 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x88000000,0x34000000,0xa2000000,0x03000000,0x41800000,0xf7400000,0x03a00000,0x04100000,0x9a080000,0x4f140000,0x0fb20000,0xea550000,0xd73b8000,0x13a1c000,0x2c122000,0xfe451000,0x6533a800,0x38b5d400,0x09a00200,0x23101d00,0x51880080,0xdf5414c0,0x67923260,0x2e0530d0,0xad13a868,0xace5c1c4,0xfb8816e2,0xa8543e15 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0xb8000000,0x1c000000,0x82000000,0xfb000000,0xed800000,0x87400000,0xffa00000,0x24300000,0xde480000,0x992c0000,0xc6e60000,0xd2dd0000,0x64938000,0x59a7c000,0x01462000,0xaaed1000,0xd8dbb800,0xeb8bf400,0x92200e00,0xe3701700,0xc1e81880,0x6d1c0ac0,0xa0ae1560,0x57f126d0,0x20759f68,0x707af7cc,0x8855acf2,0x740ad79b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0x48000000,0xac000000,0x06000000,0x95000000,0x05800000,0xc9400000,0x3be00000,0x08100000,0xcc680000,0xb6740000,0xcd5e0000,0xe1a70000,0x635c8000,0xa8e1c000,0x98be2000,0x00b73000,0x44b4a800,0xfed5c400,0x25803200,0x19401b00,0xd3e02980,0xb4102140,0x82681360,0x8f741950,0xcede0f78,0xbde72744,0x5d3cb27a,0x69b1dfcd },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0xf8000000,0x34000000,0x1a000000,0xff000000,0xf3800000,0x93400000,0x2da00000,0x3e700000,0x3d480000,0x88cc0000,0x52b20000,0x8d910000,0xce358000,0x750cc000,0x94922000,0x84a11000,0x5cdd9800,0xd8b0f400,0xeae81e00,0xd9bc1d00,0x047a1e80,0x721d0bc0,0x532782e0,0x0dede9d0,0x8e6fade8,0x1521e05c,0x44dd8bb2,0x7cb0e2e3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x10000000,0x28000000,0xfc000000,0xb2000000,0x5b000000,0x3f800000,0x7f400000,0x89e00000,0x22700000,0xb3680000,0xa3a40000,0xdd360000,0xfaad0000,0xe1a38000,0x7e6ec000,0x71562000,0xc09d3000,0x36ab9800,0xcbfac400,0x81682a00,0x38a40f00,0x82b63480,0x95ed12c0,0x404385e0,0xa01ee0d0,0x703e2ef8,0x38392e5c,0xd41dbb3a,0x4e17f339 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0x08000000,0x4c000000,0xf6000000,0x7f000000,0x76800000,0x19400000,0x11a00000,0x7bf00000,0x8af80000,0xa7540000,0x42ae0000,0xcb170000,0xe4a58000,0x8c124000,0xd6562000,0x2f431000,0x4e8b9800,0x5d454c00,0xabd3a200,0xf2e14300,0x83058580,0xc8e243c0,0x4a2e27a0,0xa1570950,0x1585a3e8,0xa1a25e3c,0x338e209e,0xa6a73345 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x70000000,0xb8000000,0x7c000000,0x4a000000,0xf3000000,0x90800000,0x81400000,0x5fa00000,0xfb900000,0x5dd80000,0x8cec0000,0x5b360000,0xc4b10000,0xdf338000,0x52974000,0x166e2000,0x891d1000,0x7ba5a800,0x1db65c00,0x2c858e00,0x2b664f00,0x7cfd9a80,0xa31a70c0,0x18938220,0xe5077350,0x19b62368,0xfaf11124,0x4213a7d6,0xd7477cab },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x88000000,0xd4000000,0xea000000,0xb7000000,0xf5800000,0xa5400000,0xfea00000,0x7e900000,0x3eb80000,0x9ef40000,0x2e820000,0xa6d90000,0x729d8000,0x98c9c000,0x2fba2000,0xda6d1000,0x7f3fa800,0x81c0ec00,0xff3f8200,0xc1c0e500,0x5f3fb280,0x71c0d1c0,0xd73f9760,0xa5c0e050,0x3d3faf28,0x12c0fb64,0xc8bfa24e,0xb780ea2d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x08000000,0x34000000,0x1a000000,0xd1000000,0xac800000,0x57400000,0x43a00000,0x18d00000,0x0d480000,0xb2b40000,0xe4620000,0x52010000,0xc5668000,0xe6e94000,0x8e0a2000,0xdb251000,0x55ec8800,0x9f8c5400,0x06c6a200,0xbe395d00,0xa3422e80,0x39913040,0xb98ea120,0xf98d4cd0,0xd9a03468,0x89d02f74,0x81c826f2,0xb5f4193d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0x08000000,0xe4000000,0xe6000000,0x07000000,0x10800000,0x7d400000,0x5da00000,0x08f00000,0x21180000,0x37940000,0xfdfa0000,0xd8ef0000,0xb9258000,0x2be14000,0xf7c22000,0xddcb1000,0x48e79800,0x412a7c00,0xc7a5a200,0xf5a16900,0x3ce20180,0x5f7b2dc0,0x2cdf9e20,0xe70e5a50,0xa0e78ce8,0x152a6afc,0x49a58de6,0xe6a17f75 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0x38000000,0xac000000,0xa2000000,0xcf000000,0x57800000,0x2fc00000,0x63a00000,0x51b00000,0x16e80000,0xd5740000,0xf4e20000,0xfa130000,0x33448000,0x5dc74000,0xc4c4a000,0x02077000,0xbf64a800,0x4fb75c00,0x338ca600,0xf9c37700,0x32ee8e80,0xe31044c0,0x358a1b60,0xc0a70f30,0x8406a388,0x46646b5c,0xd9680e32,0x26b40201 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x78000000,0x6c000000,0x7e000000,0xff000000,0x18800000,0xc0c00000,0x7ca00000,0x5ab00000,0xd9b80000,0xc7040000,0x94f20000,0x8eed0000,0xebe28000,0x5676c000,0x0b62a000,0x3ab6f000,0x29c2a800,0x8f06f400,0x90fab600,0xe4c2ef00,0x06a8a980,0xcf9fd0c0,0x2c722fa0,0x9e2d20f0,0xcf429088,0x70c6c65c,0xd4da8ee6,0x6eb2c39d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xd8000000,0xf4000000,0xd2000000,0xab000000,0x98800000,0x90c00000,0xeca00000,0x82f00000,0xe7e80000,0x2a040000,0xaf3e0000,0x32b70000,0xfff28000,0x7e46c000,0x4d72a000,0x4186f000,0x93528800,0x3cb6fc00,0x0a9abe00,0x5b82c100,0xe46c8a80,0xfa01ebc0,0x27682ca0,0x8ec40ff0,0x319e3788,0x2b471f4c,0x589aa672,0x3082d9cd },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x08000000,0x0c000000,0x72000000,0xf9000000,0x4a800000,0x86c00000,0x14e00000,0x7db00000,0x0f280000,0x8dec0000,0xe70a0000,0x11830000,0xad578000,0xecdec000,0x99b7a000,0xe16ed000,0x3e9f8800,0x5082dc00,0xa3958a00,0xb401df00,0x36421680,0x271f2140,0xf195a420,0x3d01d0f0,0xd4c22918,0x9ddf139c,0x9f75a0d2,0xb5b1efe7 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x28000000,0xe4000000,0x1e000000,0x0d000000,0x4f800000,0x03c00000,0xb9e00000,0xcad00000,0xd8780000,0xbc2c0000,0xe27e0000,0x8f410000,0x90ef8000,0xbb1c4000,0xe68fa000,0x320c5000,0xe717b800,0x14f04400,0xf511b200,0xc39d7d00,0x99803580,0xfac03e40,0xa0600660,0x70102eb0,0x18183018,0x9c3c0804,0xd2660c06,0xf77d1e0f },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x38000000,0x2c000000,0xd2000000,0x8d000000,0x70800000,0x14c00000,0xb2e00000,0x51f00000,0xf6280000,0x0b740000,0x23c20000,0x8b7b0000,0x63858000,0xab51c000,0xd3e5a000,0x9361d000,0xffada800,0x4125fc00,0x72a7a600,0x31daf700,0x66481280,0x83441440,0x378a2ea0,0x753f0170,0x3c8f8a18,0x56aef90c,0xb78a1992,0x353f20d1 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xd8000000,0xec000000,0xf2000000,0x65000000,0x87800000,0x05c00000,0x48a00000,0xcb100000,0x58f80000,0xb3340000,0x84d20000,0xc9130000,0xd5f58000,0x50944000,0x470da000,0xfaa07000,0x0e5fb800,0xef736400,0x3e8a0e00,0xf8371f00,0x1c5f9280,0x1a737640,0x010a0b60,0x41f71330,0x7eff9748,0x58637ef4,0x2c7233f6,0x92031479 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x90000000,0x58000000,0xc4000000,0x66000000,0x3b000000,0x39800000,0xd7c00000,0x10a00000,0xbb700000,0xf9f80000,0x77f40000,0x80a60000,0xe30d0000,0x3db48000,0x11c64000,0xbbcca000,0xdaf27000,0xea4a8800,0x014f5400,0x00a61e00,0x230d2500,0x9db4a780,0x81c65bc0,0xe3cca1e0,0x1ef27a30,0x8c4a9bc8,0x3a4f41ec,0x39262a36,0xf4cd23d1 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0xb8000000,0xb4000000,0xfa000000,0x47000000,0xd1800000,0x1fc00000,0xe2e00000,0x94100000,0x4a580000,0x0f240000,0xcd8e0000,0xe9bb0000,0xebe48000,0xf8a64000,0xc35ca000,0x23925000,0xa48a9800,0xd50d5400,0x3ae03600,0x70103900,0xe8582880,0xec2438c0,0x5e0e24e0,0x057b3b30,0x2284b258,0x34767334,0xba64be4e,0xa766713d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0xb8000000,0x14000000,0xd2000000,0x6d000000,0x25800000,0x73c00000,0x54e00000,0x38500000,0x54380000,0xb2440000,0x3d7e0000,0x9dbf0000,0x67958000,0x86ad4000,0x554da000,0x71b95000,0xc18bb800,0x69824400,0xa5801600,0x33c00100,0x34e00280,0x68500a40,0xec3813e0,0xa64402b0,0xef7e28d8,0xf0bf09a4,0x42158956,0xf56d7e75 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x38000000,0x2c000000,0x86000000,0x79000000,0xe2800000,0xd8c00000,0xafe00000,0xc0100000,0xa0280000,0x10140000,0xc8720000,0x14490000,0xaa698000,0xff0ec000,0x9ba1a000,0x3a0ad000,0x777b9800,0x6f97ec00,0x60001600,0xb0002700,0xd8001780,0xdc002940,0xbe001720,0x55002370,0x648032d8,0xa1c01874,0x4d603b52,0x18d00231 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x48000000,0x34000000,0x3e000000,0x1b000000,0xe0800000,0xe2c00000,0xd3a00000,0xc6500000,0xa7080000,0x0acc0000,0xf7e60000,0x60010000,0xf0188000,0xa80ac000,0x0430a000,0x7656f000,0x2f7e9800,0xdecbfc00,0xf9880a00,0x330c3100,0x24c62580,0x749107c0,0xccb0a5a0,0x5096f370,0x6adea348,0x079bffe4,0xc8003d0a,0xf4003797 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0x98000000,0x9c000000,0x4e000000,0x59000000,0x07800000,0xddc00000,0xdea00000,0x1a300000,0x23080000,0x34a40000,0xa13a0000,0x8bc50000,0xdb958000,0x73d04000,0x57bda000,0x75847000,0xfaafa800,0x38154c00,0xac280e00,0xf6542b00,0x35123d80,0xd1910d40,0x1887b460,0x97414630,0x9eba05c8,0xfa0517bc,0xf335b68a,0x5ce040d5 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0x08000000,0x84000000,0x92000000,0x91000000,0xbd800000,0x8cc00000,0x61600000,0xc5b00000,0x30d80000,0x6f6c0000,0x4af60000,0x0a530000,0x5d2d8000,0x8bc04000,0x9fdba000,0x45935000,0x70f62800,0x4f531400,0x5aad8a00,0x02006500,0xd93b8680,0x19e35540,0x0ece23e0,0xf84f1370,0xfc63bd38,0x2e4f775c,0x9f5812ee,0x32ac3ff7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0x78000000,0xac000000,0x3a000000,0x0d000000,0xf1800000,0x6cc00000,0xf5200000,0x9df00000,0x76a80000,0x08640000,0x141a0000,0xb6230000,0xc75f8000,0x84944000,0x3145a000,0xa3b77000,0x659a2800,0x1ae30c00,0x127f9600,0xe9645700,0x3fedb080,0x07d35840,0x4b801ae0,0xa1c01470,0x24a01728,0x01302b4c,0xfb883062,0x39940d25 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x98000000,0x6c000000,0xaa000000,0x83000000,0xd7800000,0xc0c00000,0xa1600000,0x30d00000,0x99280000,0x8cf40000,0x9b4a0000,0xfbdb0000,0x8ae88000,0x12644000,0x7f42a000,0x35af5000,0x87e21800,0x28ef1c00,0xb5429e00,0xc6af5700,0x28622c80,0xb42f2bc0,0x2622a760,0x197f5cf0,0xccca1bb8,0x7b1b3704,0xcb889c92,0x12b443c9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x28000000,0x8c000000,0x2e000000,0xc3000000,0xae800000,0x79c00000,0x9d200000,0xe5d00000,0x0b680000,0xd2ec0000,0x1fa20000,0xe2690000,0x4d328000,0x3dd8c000,0xcf30a000,0x40a1f000,0xdaca3800,0x03853c00,0xb4109200,0x1a71ef00,0x19222180,0xd7a923c0,0x9e12b820,0x2b08e2b0,0x42d8a6e8,0x678df404,0x76481612,0xc73c010f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x48000000,0x6c000000,0x4e000000,0x3b000000,0x94800000,0xc1c00000,0xbe200000,0xb3500000,0x98880000,0xffdc0000,0xcd320000,0x4bc10000,0x17728000,0x7aabc000,0xeac8a000,0x12b6f000,0x56883800,0x04dc2c00,0x39b20a00,0xfa010700,0xe1528180,0xa5fbd5c0,0x3c4096a0,0xd66aceb0,0x0f3a32a8,0x8edd30a4,0x90e083aa,0x33fad423 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0x58000000,0x44000000,0x1a000000,0xf1000000,0x4e800000,0xf5c00000,0x32600000,0x3d100000,0x28f80000,0xcaa40000,0xcfee0000,0x337f0000,0xbbad8000,0xc14bc000,0xa6bba000,0x1990d000,0xa4783800,0xca643400,0xc90e0e00,0x9aaf3500,0xb7b59080,0x873fed40,0x69cdb520,0x2c5bd130,0xb643a738,0x0734c634,0x299628a6,0x4c1b18ed },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0xc8000000,0xe4000000,0x42000000,0xbd000000,0x6a800000,0x05c00000,0x2a200000,0x89100000,0xf0880000,0x64dc0000,0x2eb60000,0x97830000,0x4f578000,0x3fe7c000,0x9b69a000,0x55b8f000,0x32081800,0xb51c0c00,0x6e960a00,0xb7930500,0x5f5fa280,0x07fbd640,0xb77faa20,0xf3ebde30,0xcd778828,0x62f7ef34,0x01e19caa,0x9864ce73 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0x48000000,0xdc000000,0x92000000,0x53000000,0x6c800000,0x85c00000,0x36600000,0xe5500000,0xc9f80000,0xac6c0000,0x8a6a0000,0x27570000,0x32e88000,0x0cfbc000,0xd5faa000,0x9e00d000,0x29181800,0x13fc1400,0x23722a00,0x74ab3300,0xf19ab680,0x6850e3c0,0x6c601fa0,0x2a5025b0,0xd7782eb8,0x6aac1c24,0x988a2de6,0x9bc7254f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0x98000000,0x6c000000,0x2e000000,0x71000000,0x7c800000,0xebc00000,0xd2200000,0x67500000,0xd1d80000,0xf1640000,0xbc9a0000,0x8bd10000,0x02678000,0xff1ac000,0xbda5a000,0xdf6ff000,0xcdf83800,0xf7340400,0xe9c23e00,0x2d752f00,0xdaddad80,0x0e9bc740,0x3c9a34a0,0x4bd116b0,0x6267b3a8,0x2f1ad724,0x25a586fe,0xb36fce8d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xb8000000,0xac000000,0x06000000,0xfd000000,0xef800000,0xf8c00000,0x8c200000,0xf6300000,0xe5480000,0x73c40000,0x46ca0000,0xdd750000,0x1fcd8000,0xe0814000,0x106fa000,0x48007000,0xb4200800,0x9a303c00,0x43480600,0xbec42700,0x114a2f80,0x89b51440,0x95edba60,0xebb14170,0x1aa7b8e8,0xc30473bc,0x7eca125a,0xb1751d7d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x58000000,0x14000000,0x5a000000,0x75000000,0x6c800000,0x87c00000,0xdc600000,0xf6700000,0xcb780000,0x4b840000,0xd2660000,0x79070000,0x82c78000,0xf8e4c000,0x9db9a000,0x0917d000,0xcae00800,0x14b00400,0x83983e00,0x7e341100,0xc77e0080,0xa5f31840,0xad598da0,0x38a7fcb0,0x7df80c38,0xf9440c6c,0xc2862dc6,0x58b73b7d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0xe8000000,0x94000000,0x42000000,0x7b000000,0x49800000,0x3cc00000,0x90200000,0x58500000,0x1c080000,0xa64c0000,0xd13e0000,0xa6eb0000,0x375c8000,0xd7f94000,0x81caa000,0x78ce7000,0x2a003800,0x2f002c00,0x6b802200,0x37c03900,0x31a02a80,0xf0903bc0,0xce2802e0,0x851c11f0,0x84b63668,0x3c671924,0x7642a30a,0x29427f87 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0x28000000,0x14000000,0x4a000000,0xe3000000,0x6f800000,0x72c00000,0x70200000,0xe8300000,0x34080000,0xba3c0000,0xcb0a0000,0x7b850000,0x38d28000,0x9318c000,0x87abe000,0x46d4b000,0xca000800,0x23000c00,0x4f800200,0x82c00f00,0x58200280,0xfc300140,0x7e0804a0,0x593c0e30,0xa48a06f8,0x0945072c,0x48f28702,0x7b28ce83 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x50000000,0x28000000,0x9c000000,0x7e000000,0xff000000,0x43800000,0x79c00000,0xb8200000,0x14100000,0x52380000,0xf9140000,0x088a0000,0xd8670000,0x40ff8000,0x108fc000,0x7c78e000,0x6ad27000,0x5d800800,0x96c00400,0x33a00e00,0xa1d00500,0xbc180280,0x8e0409c0,0x673207e0,0xa7b30ff0,0xb3d58438,0xa538c79c,0xd69f6b82,0x9759b141 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0x48000000,0x1c000000,0xae000000,0xf9000000,0x6c800000,0x95c00000,0x7c200000,0x3e300000,0xe1080000,0x489c0000,0x6fd20000,0x37270000,0x059b8000,0xe1764000,0xcde72000,0xb8277000,0x94200800,0x92300c00,0x27080200,0xdd9c0700,0xe5520480,0x47e701c0,0xbb3b8ae0,0xb3864f90,0x3c4f26c8,0x5b4b795c,0x66da0fc2,0xd3bb0fe3 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0x48000000,0xbc000000,0x0e000000,0xe1000000,0xb5800000,0x3dc00000,0x8c200000,0xd6100000,0x75180000,0xd7b40000,0x9ad20000,0x648f0000,0x50538000,0x25c04000,0x38296000,0x04157000,0x4a200800,0xcb100400,0xae980600,0xdb740d00,0xeb720480,0x335f0bc0,0xa76b80e0,0xc5644e10,0x62636b58,0x8aee73dc,0x0c8180c2,0x5c4f4961 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0x98000000,0x34000000,0x12000000,0x43000000,0x04800000,0xb8400000,0x46200000,0x41300000,0x3fb80000,0x58f40000,0x74460000,0x701d0000,0x680c8000,0x9c1cc000,0x6e132000,0xfd051000,0x61980800,0xedc40c00,0xb9fe0e00,0xbbe90d00,0x80ca8980,0x6041c340,0x523fa120,0x6329d430,0x34b32848,0xf0751784,0xea000262,0x67000513 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0x98000000,0xec000000,0x0e000000,0x29000000,0x9f800000,0xa9400000,0x52200000,0x8f300000,0x32a80000,0x1cd40000,0xa8460000,0x89ab0000,0xac5b8000,0x63964000,0x5f65e000,0x673f5000,0xd6880800,0xc6e40c00,0x336e0a00,0xa93f0500,0x5fbd8980,0x094d4ec0,0x023660e0,0x170d1290,0xdea3e1f8,0x12d45694,0x81738722,0x160241f3 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0xf8000000,0xfc000000,0x1e000000,0x2b000000,0x67800000,0xc5400000,0xab200000,0x27900000,0x65680000,0x9b2c0000,0xdfae0000,0x99570000,0x852b8000,0xf4a4c000,0xfecee000,0x405ad000,0x5fae0800,0xd9570400,0x252b8a00,0xc4a4c300,0x06ceef80,0xbc5adfc0,0x41ae09e0,0xf25706b0,0x42ab8c78,0x01e4cf54,0xadeee532,0x9bcaddb9 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0x68000000,0x9c000000,0x06000000,0x2f000000,0xf8800000,0x2a400000,0x7f200000,0x30900000,0xc6780000,0x81040000,0xeb8a0000,0xa4df0000,0x82458000,0x4321c000,0x46b12000,0x11571000,0x8d8a0800,0x5bdf0400,0xf2c58e00,0x6561c900,0x57912680,0x92c719c0,0xb5720860,0xdf9b06f0,0x9eef8188,0xdb6ecba4,0x6c8ca172,0x6072dac9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0xa8000000,0x44000000,0xc2000000,0x13000000,0xcf800000,0xe2400000,0x71200000,0x6cb00000,0xa5c80000,0xa77c0000,0x77ba0000,0x9e690000,0x0f048000,0x2182c000,0x5740e000,0x1fa51000,0xfa720800,0xbd150c00,0x9abe8200,0xdcebc700,0x3fc46a80,0x9867d440,0x1e12e420,0xdd001d30,0x0a8486f8,0x24c2c524,0xa3e0ef92,0xb655158b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x18000000,0x7c000000,0x8e000000,0x6f000000,0x52800000,0x1fc00000,0x59200000,0x71b00000,0x2b780000,0x5de40000,0x90160000,0xd8170000,0x9c1f8000,0x9e19c000,0x770da000,0x2ebb7000,0x91ee0800,0x36330c00,0x23298e00,0x34bec100,0x04ea2180,0xe186b7c0,0xf355a0e0,0xc1ef7af0,0x0e000328,0xaf000cfc,0xb2800a12,0x0fc001db },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x08000000,0xf4000000,0xa6000000,0x77000000,0x65800000,0xd3c00000,0x45200000,0xe4900000,0xd9680000,0xbf4c0000,0x28720000,0x5de50000,0x361d8000,0x8f0bc000,0x39a26000,0x31ce7000,0x9c3a0800,0x02390400,0xc9078a00,0x5ea2cb00,0xec4de080,0xb3e0bf40,0x1525e260,0xfcacb370,0x9557e458,0xe549b23c,0x0d4a66d2,0xe9427e09 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0x48000000,0xf4000000,0x26000000,0x61000000,0x17800000,0x08c00000,0xbb200000,0x04b00000,0xe8580000,0x5d540000,0x1cc20000,0x8d350000,0x4d958000,0xdbe64000,0x3bbee000,0x32d4b000,0xb83a0800,0xcc110c00,0x2a2f8600,0x2b374d00,0xecb16480,0xac53ff40,0xe3536a60,0xc1d6fa10,0x489eef78,0x0264b18c,0x16620132,0x20450e0b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x78000000,0x74000000,0x7e000000,0x5f000000,0xd0800000,0x75400000,0x7d200000,0x2d900000,0x18f80000,0x85fc0000,0xd86e0000,0xb8950000,0x496b8000,0xef0dc000,0x08bb2000,0x9179d000,0x0b360800,0x7eb90400,0xc25d8e00,0xd1b4c700,0x2ae6a780,0x30cd1740,0x59d0afe0,0x3a7411f0,0xe58d2b08,0xb4c0d454,0x1feb8652,0xf14dc699 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0xc8000000,0x24000000,0x8e000000,0x39000000,0x6a800000,0x60400000,0x5aa00000,0xf8700000,0x96a80000,0xc2540000,0xe99a0000,0xb5dd0000,0x6d798000,0xb6334000,0xa5332000,0xb8b35000,0xab798800,0x6b334c00,0x61b32200,0x71f35900,0x53598480,0xd7034e40,0x23bb2ae0,0x72d75a90,0x46eb8228,0xc0ca4844,0xfdf8af4a,0x89491517 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0xf8000000,0xbc000000,0xca000000,0x39000000,0x13800000,0x55400000,0xbba00000,0xd1700000,0x6d880000,0xf2440000,0xbf360000,0x08ab0000,0x9be48000,0x5b754000,0x34986000,0x91ec1000,0xc2648800,0xf7354c00,0x3cb86a00,0xc5dc1d00,0xec4c8780,0x680147c0,0x240666a0,0x06331e90,0xdb1e06b8,0x6e9f0294,0x30da8d1a,0x1dda4387 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0xf8000000,0xe4000000,0xfa000000,0xad000000,0xb6800000,0x89c00000,0x92a00000,0x53d00000,0x6fb80000,0x2d5c0000,0xfa460000,0xa1c50000,0xfea88000,0xd5d64000,0xec992000,0x34d23000,0x8c088800,0xf6064400,0x1b212600,0xcd8e3300,0x744e8780,0x1ec34a40,0xa909a9a0,0x3c9879d0,0xbcf7ace8,0xf00172dc,0xd819288a,0xb41238ed },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x68000000,0xe4000000,0x86000000,0x9d000000,0xe1800000,0xb0c00000,0xeda00000,0x12f00000,0x16980000,0x7e740000,0x2fc20000,0xc72d0000,0x56b38000,0x5e624000,0xdfe7e000,0xbf387000,0xda938800,0x3c524c00,0xc4dfee00,0xc3bc7100,0x8bc98e80,0x610b4240,0x3bae6660,0xc7f338d0,0xe31de098,0x3091794c,0xd37a00ba,0x566905ff },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0xa8000000,0x34000000,0xd2000000,0x59000000,0xd6800000,0xf1400000,0x9aa00000,0x8f500000,0xada80000,0x96cc0000,0xa9420000,0x46a10000,0x49468000,0x56af4000,0xb1672000,0xbaa51000,0xff668800,0x05bf4400,0xa2ef2200,0x7b791700,0x1fac8280,0x9fc24740,0xa7e3af20,0x2beb5290,0x35e72fe8,0x52e51854,0x93468e8a,0x0baf4e65 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x88000000,0xcc000000,0x5a000000,0x77000000,0x4e800000,0x23400000,0xd4a00000,0xb4500000,0xaa080000,0x8f340000,0x3a8a0000,0xad570000,0xbd948000,0x1bfec000,0xeacd2000,0x41411000,0x379c8800,0x44cac400,0xf8472a00,0xb0161900,0x58080080,0xe43408c0,0x060a0fa0,0xa5170e70,0xf5b48c68,0x37eecef4,0x80e528ea,0x2e651c35 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x68000000,0xb4000000,0xb6000000,0x09000000,0x40800000,0xb9400000,0x3ea00000,0x54700000,0x30180000,0x482c0000,0x24220000,0xae310000,0xd5378000,0x42af4000,0x067da000,0x770c1000,0xadaf8800,0xb7c34c00,0x22ffae00,0x404d1700,0xd6000e80,0xb9000740,0xc8800560,0x7d400790,0xe0a00288,0xe97000d4,0xc698088a,0xf86c05d7 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0xb8000000,0xe4000000,0x86000000,0x8d000000,0x4b800000,0x8ec00000,0x79a00000,0x1df00000,0xab180000,0xf6b40000,0x8d560000,0xbb5d0000,0xbe5f8000,0x59f24000,0x1d1f6000,0x33a2f000,0x8ae78800,0xefb64c00,0x28d16e00,0x048bf100,0xfe4e0380,0x79e90240,0xed098660,0x9baf49d0,0xd6c0ef38,0x8d90b6ac,0x23d8e7fa,0xc224b50f },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x88000000,0xbc000000,0xba000000,0x6b000000,0xbb800000,0x27400000,0x30a00000,0x6cd00000,0xfff80000,0x505c0000,0xa10a0000,0x788b0000,0xf0f88000,0x95dbc000,0x037d6000,0x2eba9000,0x59f28800,0x1150c400,0x2985e600,0x60615b00,0x690fe080,0xa4aa5fc0,0xfad765a0,0x76e199b0,0x04f20d38,0xb3d706b4,0x0272862a,0xc610c0bd },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x58000000,0x54000000,0x56000000,0x33000000,0x54800000,0xe4c00000,0x17a00000,0x18700000,0xcf780000,0x05c40000,0xbe1e0000,0xaf290000,0x6e8f8000,0x85dbc000,0x7e23a000,0xcf057000,0x3e918800,0xddf2cc00,0x2a2c2600,0x991eb500,0x0d922d80,0x8947b940,0xcee5ab60,0x8e987a30,0x15f80ec8,0x4604020c,0xcb3e079a,0x309902f7 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x78000000,0xdc000000,0xca000000,0x43000000,0xe3800000,0x9c400000,0xb8a00000,0x73d00000,0x06c80000,0x1c7c0000,0xf8860000,0xd3c30000,0x36e88000,0x6445c000,0x24bb6000,0x19c65000,0x75ee8800,0x87c6c400,0xb8f3ea00,0xa1539300,0x061def80,0x813c99c0,0xa4bb6ea0,0x59c65330,0xd5ee8bb8,0xb7c6c304,0xc0f3eaaa,0x7d539dcd },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x90000000,0x08000000,0x5c000000,0x3a000000,0x2f000000,0xac800000,0x94c00000,0x5fa00000,0xc2700000,0x44480000,0xa1740000,0x1afa0000,0xe68b0000,0x43f08000,0x9732c000,0xa8a4a000,0x5add7000,0x86aa8800,0x73c9cc00,0x0f1c2a00,0xfc9bb900,0x3cf42880,0x939fb9c0,0xf04621a0,0x3760b7f0,0x37cca848,0xa119798c,0x15b884da,0x1546ce17 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x28000000,0xc4000000,0x3a000000,0x9b000000,0xa1800000,0x93400000,0xa0a00000,0xf9f00000,0x2a580000,0x560c0000,0xa5020000,0xe0950000,0xd9d88000,0xba7dc000,0x0e07e000,0x49049000,0x1e828800,0x78e4cc00,0x80dd6e00,0x3cec5700,0x7addea80,0x47dd9040,0xab7805a0,0xfcbc02b0,0xcffa0698,0x3f690274,0x7e828b2a,0xc8e4ca6f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x28000000,0xa4000000,0xfe000000,0x3d000000,0x82800000,0xb3400000,0x05a00000,0x42f00000,0x41780000,0xa28c0000,0x63620000,0x3d8d0000,0xbed98000,0x33544000,0xc5ba2000,0x22fe1000,0x31638800,0x8aa54c00,0xc779a600,0xc3ab5700,0x83e22a80,0xb1c21640,0x76d981e0,0x275448d0,0x73ba2ca8,0xcbfe1674,0x65e3853a,0xa0e541bf },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x88000000,0x5c000000,0xea000000,0x43000000,0x40800000,0xfc400000,0x9da00000,0x19f00000,0x90580000,0xdf8c0000,0x96ea0000,0xc2d30000,0xb4d48000,0xfdcdc000,0x8e49a000,0xba835000,0x87468800,0xe922cc00,0x238f2e00,0x2ce19700,0x99e9a080,0x507359c0,0x3f9e88a0,0xe6eecf30,0x4ac52288,0xe8c29d04,0x17e527fa,0xcd729c6f },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0x58000000,0x9c000000,0x2a000000,0xcf000000,0x3d800000,0x4c400000,0x0ca00000,0x70d00000,0xb4780000,0x60840000,0xb2de0000,0x6f6b0000,0xb3188000,0x878ac000,0xbb4ee000,0x7d285000,0x4e9e8800,0xebf5c400,0x07d06600,0x85dd9d00,0x3eceed80,0x3d685dc0,0x503e8ca0,0x1825c5f0,0xfc286058,0xfa199004,0x9730efea,0xa193563d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0xe8000000,0x0c000000,0xbe000000,0x2f000000,0x73800000,0x12400000,0x3a600000,0x16700000,0x58680000,0x0f4c0000,0x98f60000,0x38b50000,0x93fa8000,0xd9014000,0xe0b5a000,0xc7dd3000,0x7335a800,0x059d3400,0xc155ae00,0x8fed3d00,0xcf3da080,0xa3a13dc0,0x9a4bab60,0xa6543f30,0x40512c58,0x7b657e14,0xc2ec8ffe,0xa5844f73 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x08000000,0x74000000,0xea000000,0x15000000,0xdc800000,0x40c00000,0xe8e00000,0xccd00000,0x0ed80000,0xfffc0000,0xc17e0000,0xe0a30000,0x3ef98000,0xa7ecc000,0x9d63e000,0xee9fd000,0xc9e3e800,0x1a5fdc00,0xeb03ea00,0x538fd500,0x315bea80,0x98b3d240,0xf2c5e420,0xa1c0d310,0x1e6469e8,0xb910171c,0xaa998766,0x7bfccbd1 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0xa8000000,0x9c000000,0xfa000000,0xd3000000,0xdb800000,0xb4c00000,0x88e00000,0x62d00000,0x39d80000,0xae6c0000,0x48860000,0x8f410000,0xcc2f8000,0x92034000,0x6f39a000,0xf1829000,0xcfd9a800,0xcf529c00,0x2c01aa00,0x623e9100,0x1707a080,0xc5bf98c0,0xa9c82f20,0xe66cd5f0,0x24a98298,0x0d424ebc,0x2b162216,0x2f81d491 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x88000000,0xfc000000,0xe6000000,0x59000000,0x18800000,0xc1400000,0x95600000,0x1f700000,0xf8480000,0xfdc40000,0xb6260000,0xa1390000,0x8c908000,0xeb7ec000,0xa254e000,0xa2d6b000,0xc7b4e800,0xf0e6b400,0x249ce600,0x8752b700,0x1c72ee80,0xbfefb8c0,0x4d2460e0,0x72987d50,0x16480168,0x18c40144,0xa8a6003e,0x097904b3 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0x58000000,0x84000000,0xca000000,0x6b000000,0x1f800000,0x12400000,0x98600000,0xd3500000,0xfce80000,0x669c0000,0x22ea0000,0xbf9b0000,0xe2418000,0xf0474000,0xdf6aa000,0xead53000,0x4382a800,0x9c493c00,0xd968a600,0x77d23100,0xa9292380,0x68957940,0xa3c38f20,0xfb004ff0,0x67a126d8,0xa65972d4,0xda41895e,0x64474ee1 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x68000000,0xe4000000,0x7e000000,0x87000000,0xda800000,0x2c400000,0x62600000,0x3d700000,0x9bd80000,0x158c0000,0x02f60000,0xf83f0000,0x6c388000,0x6a354000,0xc125e000,0xd199f000,0x6cfde800,0xb715f400,0x028be200,0x506af100,0xc0536480,0x486fbf40,0x5c4e8360,0x1a4a4730,0x117d66c8,0x51dcb1f4,0x848002ee,0xbb400323 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0xd8000000,0xfc000000,0xba000000,0x2f000000,0xd0800000,0x78c00000,0xaae00000,0x81f00000,0x07680000,0x42b40000,0x33e20000,0x5c6d0000,0x1c0b8000,0x8a244000,0x972a6000,0x5ca55000,0x1ac26800,0x79d15400,0xeb406e00,0x508c5300,0x38c3e380,0xcaec1cc0,0xf1e38820,0xdf504e30,0xbea86d28,0x89f85dbc,0x7341e986,0xccb116a3 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0xb8000000,0x74000000,0x02000000,0xbf000000,0x18800000,0x05c00000,0x5be00000,0x6af00000,0xdb680000,0x6b2c0000,0x2aa20000,0x72ef0000,0x9f578000,0xa12c4000,0x49bc6000,0xa4741000,0x53b46800,0x5f681400,0x811e6e00,0x399b1500,0x0c63e580,0x9f845240,0x294205a0,0x3c1f09b0,0x9e3f8c28,0x11004dec,0xc19e6f96,0x185b1a43 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0xc8000000,0xdc000000,0x12000000,0x65000000,0x6d800000,0x97c00000,0xc1e00000,0x72f00000,0xec680000,0x85140000,0xdd860000,0x3fe10000,0xeddd8000,0xa8e8c000,0x5559a000,0xfab75000,0x2f51a800,0x93935400,0x08dfae00,0x85565b00,0xa28c2280,0xcb7b96c0,0x958603a0,0xa3e10090,0x9fdd8d78,0x3de8cdec,0xf0d9a766,0xb17755c3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0x38000000,0x4c000000,0x66000000,0xfb000000,0xc4800000,0x4cc00000,0x47e00000,0x7b500000,0x5b980000,0x0a640000,0xb23a0000,0x61310000,0x418c8000,0x4f684000,0x91b86000,0xc77fd000,0xc5826800,0x9d4edc00,0x608eea00,0xeee69b00,0x8ed68980,0x1ec94fc0,0x76cce7e0,0x72e39c70,0x60f801a8,0xb1f403bc,0xe8420c56,0x9b050bc9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0xc8000000,0xdc000000,0x22000000,0x4b000000,0xa8800000,0x00c00000,0xbfe00000,0x19500000,0xd8880000,0x68e40000,0x33c60000,0xc3590000,0x87858000,0x3e494000,0x5a366000,0x9f01d000,0x36906800,0x59c8dc00,0x947dee00,0x6d359f00,0x45858280,0x854942c0,0x5ab668a0,0x73c1da70,0x63706c28,0xd798d57c,0xc675ed56,0x4e119a29 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xd0000000,0xc8000000,0x44000000,0x82000000,0x2d000000,0xef800000,0x67400000,0x48600000,0xcaf00000,0x62380000,0x9d2c0000,0xd78e0000,0x3b570000,0x46638000,0x21cac000,0x22a82000,0x38c57000,0x171e2800,0xdebe7400,0xa6f3aa00,0x1423b900,0x0a380680,0x492c0d40,0xbd8e06a0,0x82570b90,0xe3e38a58,0x2f8ac0e4,0x0748225e,0xb875780b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0xd8000000,0xc4000000,0xc6000000,0xa1000000,0x6a800000,0xb5c00000,0xcae00000,0x65700000,0xec080000,0x9a340000,0x43120000,0x7d9b0000,0xa6768000,0xd188c000,0xdc536000,0xe2879000,0x79c96800,0x80e89400,0x6e4de600,0xfd8b5300,0xe6600b80,0x31b00f40,0xac680fe0,0x3a840150,0xbdfa0748,0x46df0d0c,0xcf6c8666,0x9727c71b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0xb8000000,0x14000000,0x56000000,0x29000000,0x7d800000,0xd6400000,0xe1600000,0x69d00000,0x88380000,0x7c1c0000,0x5a020000,0x7b2f0000,0xbabe8000,0x96dac000,0x1ca0a000,0x77d0b000,0x7d1aa800,0x4ba3bc00,0x4f462200,0x34c67d00,0x13800980,0x2b400c40,0x6ae004e0,0x869002d0,0xacd80938,0xd78c0eb4,0x655a0cae,0x47e30969 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x58000000,0xf4000000,0x4e000000,0x57000000,0xbf800000,0xd0c00000,0xf5e00000,0x4f500000,0xf5080000,0xf2b40000,0x66520000,0xe5970000,0x79c88000,0x25434000,0xa425a000,0xc6301000,0xeb1fa800,0x2d831c00,0x65ed2e00,0xa7735b00,0x393a0b80,0x38b30440,0x27728760,0xf9304d30,0x58b72a98,0x5750573c,0xa1208846,0xaca74089 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0x68000000,0x1c000000,0x3a000000,0x07000000,0xfc800000,0xe6c00000,0xd2600000,0xf8b00000,0xe8c80000,0x93440000,0xc9160000,0x9d950000,0x476d8000,0x3f094000,0x58b3e000,0x38d71000,0x6b5e6800,0x4d1e5400,0xd38d8e00,0x66794b00,0xfe9be080,0x45e31ec0,0xf0e06d20,0xa77f55b0,0x8f3e0268,0x50a1051c,0xd4d3826e,0x39684f27 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x28000000,0x7c000000,0x5e000000,0x9d000000,0xde800000,0x7d400000,0xfbe00000,0x02900000,0x13480000,0xbedc0000,0x981e0000,0x641d0000,0xfa348000,0x873ec000,0x4985e000,0x1ce07000,0x9b316800,0xc79ebc00,0x49d48600,0x29aecd00,0xcccdec80,0x533c76c0,0xabaf6f60,0x3fc3b210,0xc8800e08,0x4c400304,0xb3600ed6,0x8ed0013d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0x08000000,0xac000000,0x12000000,0x93000000,0x39800000,0x97400000,0x82e00000,0x47b00000,0x36480000,0x38640000,0x916e0000,0x87c10000,0x431b8000,0x61b64000,0x2347a000,0x44fa3000,0x62bc2800,0x22fc7400,0x17b38e00,0x2e624300,0xec61a680,0x275f3dc0,0xaac9a9a0,0xfb8b37f0,0x5c6facb8,0x0f6e3344,0x16fa2536,0x91a974cf },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0x28000000,0x04000000,0xee000000,0xd3000000,0xe3800000,0xfa400000,0x65e00000,0x9d900000,0xa1680000,0x324c0000,0x71ee0000,0x3b830000,0xa6668000,0x17c94000,0x5ca32000,0x53def000,0x12a5a800,0x30c7bc00,0x090e8e00,0xe6854100,0x86cd2480,0x461dfd40,0x17232460,0x6d9ef170,0xf945aed8,0xae57b394,0x63e684e6,0x2a89473d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x68000000,0x4c000000,0x06000000,0xf3000000,0x25800000,0xd2c00000,0x51600000,0x00b00000,0x2c480000,0x8a2c0000,0xd51e0000,0xe6910000,0xcf468000,0xa7874000,0x1bf6a000,0xd9c45000,0x70f82800,0xa86f1400,0xb0108e00,0x783a4100,0x442e2080,0x1a1211c0,0x9d280ee0,0x9a9c0ff0,0xf1560438,0x70bd071c,0x745881ce,0xfe1649e7 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x08000000,0x4c000000,0xb6000000,0xf9000000,0xb2800000,0x93400000,0x87e00000,0x55900000,0xc4c80000,0x88040000,0x8c2e0000,0x56290000,0x89228000,0xba91c000,0xdf41e000,0x31c5f000,0xacab6800,0x76503c00,0x1b448600,0x0bfccb00,0x03ad6e80,0x4ded33c0,0x328003e0,0x53400750,0x67e00e48,0x259001a4,0xccc803d6,0xc40408ad },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x90000000,0x08000000,0x64000000,0xda000000,0xc5000000,0x8b800000,0x66c00000,0x9f600000,0x88b00000,0x6e580000,0xb10c0000,0x19b60000,0xe7d30000,0x5eeb8000,0x2375c000,0x1eb2a000,0x8571d000,0x2d812800,0x55c81400,0x4fe58a00,0xeadacd00,0xd1572280,0x2fab1f40,0xdcd60520,0xea630e10,0x9b338718,0x64b9c33c,0x9064a1ce,0x8e12d8a7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0xb8000000,0xe4000000,0x76000000,0x87000000,0x5f800000,0x12c00000,0xf3600000,0xfa900000,0xe4780000,0x0d140000,0x7aa20000,0x245f0000,0x2d388000,0x8aa24000,0x9c472000,0xc912d000,0xfc87a800,0x1b649c00,0x96828a00,0xee794300,0xe825a980,0x6c3b9140,0x0a3a04e0,0xe51b0a30,0x16828098,0x2e79465c,0xc825a14e,0x9c3b90c5 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0xe8000000,0x54000000,0x4e000000,0xfd000000,0xbf800000,0x57400000,0x32e00000,0x36b00000,0x16f80000,0xd0b40000,0x1fd60000,0xd1270000,0x5daa8000,0x087ec000,0x7259a000,0xd163b000,0x2beb2800,0x8f197400,0x189c8200,0xfbe9cb00,0xd70b2480,0x04a97a40,0x11e48260,0x8c1dce90,0x123d2518,0xb73e75a4,0x14b60e56,0xa9d7075f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x98000000,0xb4000000,0x7a000000,0x97000000,0x63800000,0xf5400000,0x70e00000,0xd4900000,0x66e80000,0x2dac0000,0xd8420000,0xe4730000,0x12778000,0x7b554000,0x3dcc2000,0x10013000,0x3833a800,0x84287c00,0xb2358e00,0xbb264900,0xadbbaf80,0x18547e40,0x847f8620,0x42694e30,0xe3662798,0x89de3324,0x6a0620b6,0xaf0e355d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x48000000,0xf4000000,0xd6000000,0x8d000000,0x46800000,0x00400000,0x3be00000,0x25100000,0x02980000,0xee5c0000,0xdac60000,0x09bf0000,0xadd08000,0xc82ac000,0x3424e000,0x7616b000,0x5d326800,0x0e837c00,0xf4460200,0xedff0100,0xa8308e80,0x443ac240,0xee3ce9e0,0xe10ab790,0x2c946108,0xaf6c74d4,0x266e85d6,0xeed9c355 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0xd8000000,0x64000000,0xaa000000,0x69000000,0x9a800000,0xf4c00000,0x9f600000,0x75100000,0x24b80000,0xcfe40000,0xb8fa0000,0x697f0000,0x422b8000,0x1524c000,0x74aee000,0x87d89000,0xb4ff6800,0x7f435c00,0xe51a0a00,0x4caf0700,0x73f38f80,0x76d0cd40,0xaa6ce720,0xb18390d0,0x7b4eeb08,0x1f0895dc,0x6da76a5e,0xe5775f1d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0x98000000,0x1c000000,0xe6000000,0xdf000000,0xae800000,0x0ac00000,0x7f600000,0xe1100000,0xcda80000,0x92740000,0x82aa0000,0xb4d10000,0xdc468000,0x19b24000,0x80526000,0x5fba1000,0x8f5ee800,0xd9095c00,0x01820e00,0x5c650700,0xd98c8f80,0xe0734ac0,0xefbce7e0,0x177c5c30,0xc5268c88,0xe7a2415c,0x837a6b1e,0x770e15bd },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0xa8000000,0x9c000000,0xf6000000,0x15000000,0x89800000,0xe7c00000,0x75600000,0x9a300000,0x9b280000,0x489c0000,0x944e0000,0xd9ad0000,0xefca8000,0x9960c000,0x54332000,0xba199000,0xab1fa800,0x90885400,0x30480600,0x1bac0d00,0x90e60480,0xf3f100c0,0x2f6485e0,0xa13dc890,0xa3b1a7f8,0xe4d55f2c,0x79ca87ce,0x5c60c3df },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0x78000000,0xa4000000,0x5e000000,0xf3000000,0x97800000,0x6d400000,0x4be00000,0x18300000,0x34280000,0xc60c0000,0x872a0000,0xb1b70000,0x3a7e8000,0x824b4000,0x86692000,0xe876b000,0xb375a800,0xf8f6f400,0x6f800600,0x89400900,0xf5e00980,0x3b300740,0xdba80260,0x0f4c0570,0x92ca0c98,0x5a8709e4,0x99d68dc6,0x29074757 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0x38000000,0x0c000000,0x1e000000,0x63000000,0xcc800000,0xb3c00000,0xc6600000,0xb0300000,0x58180000,0x5c140000,0x56120000,0x570d0000,0xde848000,0xcedf4000,0x69cbe000,0xcf6fd000,0x2da56800,0x2a599400,0xbe000a00,0x53000300,0xd4800180,0xcfc007c0,0xe0600260,0xdf3006f0,0x8a980d28,0x8cd40d0c,0x5cf200ae,0x54fd003f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xd8000000,0xc4000000,0xe2000000,0x7b000000,0x38800000,0x10c00000,0x3aa00000,0xe0100000,0x30180000,0xb80c0000,0x341e0000,0x3a1b0000,0xbf188000,0xda9c4000,0x6bcf6000,0x02271000,0xf0d21800,0x0abf5400,0x58000200,0x04000300,0x82000180,0x8b0003c0,0xe0800360,0xd4c00310,0xd8a00388,0x9b1001ec,0x089800e2,0xa8cc0043 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x18000000,0x5c000000,0xae000000,0xa9000000,0x3b800000,0x78c00000,0x18e00000,0xb8100000,0xcc180000,0xe61c0000,0x5d160000,0xd1830000,0x23cb8000,0x2475c000,0x52452000,0x97bf7000,0x3e231800,0x31fd1c00,0x43800200,0x54c00300,0x4ee00380,0xfd1002c0,0x41980060,0x6bdc0170,0xd07602b8,0xb85302a4,0xccb380ee,0x02b9c1e3 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0x38000000,0x44000000,0xda000000,0xe5000000,0x59800000,0x35400000,0x5ca00000,0x74100000,0x02080000,0xf1140000,0x4b9e0000,0xac470000,0x9b288000,0x7e4b4000,0xe234a000,0xe9cf3000,0x2070a800,0x75e89400,0xa6a00200,0x21100100,0xc3880280,0x705403c0,0xf53e00e0,0x79570110,0x1aa08368,0x5f1f4394,0xac8aa166,0x04d830d5 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0x58000000,0x44000000,0x32000000,0x87000000,0xc9800000,0x8b400000,0xb3200000,0xb4100000,0xfa080000,0x3b140000,0x6f9a0000,0x664b0000,0xb9a88000,0xc4d64000,0x4578e000,0xf5bd3000,0xaad36800,0x14616400,0x59200200,0x37100100,0xa1880280,0xe7540340,0x4d3a0160,0x1d1b0110,0xc28080c8,0xccd2421c,0x196ae326,0x23a2322d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x08000000,0xf4000000,0x86000000,0xd7000000,0x5e800000,0xec400000,0x9b600000,0xe6100000,0x27180000,0x66840000,0x00420000,0xe1610000,0x430e8000,0x2888c000,0x035ee000,0x29e9d000,0x704c8800,0x1975ec00,0x8f180200,0x42840300,0xae420080,0xd2610040,0x938e8020,0xe7c8c3d0,0x40bee218,0xf4b9d35c,0x92b4897a,0x75a1efb1 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0x88000000,0x84000000,0x12000000,0xdd000000,0xd6800000,0x36400000,0xd1e00000,0x56100000,0x6f080000,0x3b9c0000,0xb8da0000,0xebb10000,0x11e08000,0xf61a4000,0x5f0fa000,0x639cd000,0xb4cdc800,0x7dbbbc00,0xdee80200,0xfd8c0100,0xbfd20380,0x842d0340,0x333a8220,0x44ab4210,0x8a6f2048,0x7ec69374,0xeca26b5a,0x7e776cd9 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0xd8000000,0x0c000000,0x1e000000,0x5d000000,0x2e800000,0xd8400000,0x83200000,0xf2100000,0xb3080000,0xcb8c0000,0x4ad60000,0x9d7b0000,0x20318000,0x719bc000,0xfdcfa000,0x2cffd000,0xfde60800,0x8d72e400,0x68280200,0x759c0100,0x87de0180,0xbbf702c0,0x9c678360,0x38a0c030,0x40de2078,0xf2741174,0x9da1a8ba,0xb2413761 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0xc8000000,0xa4000000,0xf2000000,0x23000000,0xba800000,0x5ec00000,0xc1600000,0x1e100000,0xb5180000,0x8b9c0000,0xb74e0000,0xed390000,0x25a48000,0x98764000,0x03906000,0x335d5000,0x8f20d800,0xbeabac00,0x4ef80200,0x0b4c0300,0x23360380,0x08b501c0,0xeff28320,0x5ad34290,0x637ae3c8,0x6512108c,0x13943aea,0x4b40bd7b },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x58000000,0x8c000000,0x5a000000,0xcd000000,0x78800000,0x02400000,0x07600000,0x5e100000,0xe3180000,0x938c0000,0x25d20000,0x64ab0000,0xf5a18000,0x2f234000,0x9c7da000,0x71991000,0x34cd4800,0x7e246c00,0x26f80200,0x52dc0300,0x812a0180,0xb7770240,0x360b8160,0xc7144230,0x8d962168,0x66dd5334,0x072369e2,0x18653c09 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0x18000000,0xcc000000,0x0e000000,0xb1000000,0x1a800000,0xf3c00000,0x0b200000,0x61100000,0xb2980000,0x07c40000,0xb92e0000,0xc6130000,0xd5018000,0xe085c000,0xf0d82000,0xb6a05000,0xf557f800,0x5ef8a400,0x2f2e0200,0x7b130300,0xe1818080,0xd245c1c0,0xf9782060,0xe8705330,0x42eff838,0x892ca6c4,0x3e18026a,0x490400cf },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0xd8000000,0x04000000,0xe2000000,0xe7000000,0x95800000,0xbdc00000,0x6ba00000,0xdf100000,0x81880000,0xe7cc0000,0xd8aa0000,0x708b0000,0xdf488000,0xfbf04000,0x5d66e000,0x0f31b000,0x5a433800,0xc97f3400,0x152a0200,0x894b0100,0x36e88180,0x93e04140,0x916ee360,0x513db010,0x0b493b88,0x81e4379c,0xde6a8056,0x28b743f7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xc8000000,0x74000000,0x0a000000,0xff000000,0x45800000,0xdec00000,0xfde00000,0xe7100000,0xa9980000,0xf8cc0000,0x44fe0000,0xeb890000,0xb3d68000,0x6b6d4000,0x3a51e000,0xc3a9b000,0x26a95800,0x6428fc00,0x237e0200,0x8e490300,0xa9b68180,0x29bd43c0,0xe9a9e320,0x89b5b1d0,0x79af5828,0xb1bdfffc,0xc5ae8316,0xcfb1407b },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x68000000,0x24000000,0xda000000,0xc1000000,0xd1800000,0x17c00000,0x02200000,0x75100000,0xa3980000,0xd2c40000,0x19a20000,0xcbdd0000,0x543c8000,0x6a0f4000,0x79022000,0xbd933000,0xf9c47800,0x71360400,0x41820200,0xbfcd0300,0x06248080,0xbf0b4040,0x0a8021a0,0x275e3090,0xd460fb68,0x08fd4704,0xf0a22146,0xde43335f },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0x18000000,0x1c000000,0x3a000000,0x29000000,0x43800000,0xd1c00000,0x6c600000,0xad100000,0x25880000,0x22dc0000,0x96f20000,0x27530000,0x842b8000,0xd9ab4000,0x376f2000,0x638f7000,0xe1dfb800,0x0467cc00,0x39120200,0x1b830100,0x2dc38380,0xc6674240,0x9c152060,0x7a007070,0xc90638e8,0xd39f8ca4,0xc9d6a30e,0x70673247 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0xc8000000,0xc4000000,0xf6000000,0xd9000000,0x38800000,0xe3400000,0x1ae00000,0x9f100000,0x19880000,0xa7dc0000,0x93b20000,0xa6e90000,0x55008000,0x4a8ac000,0x2c552000,0x6b6c1000,0x8ccde800,0x242d1c00,0xd43a0200,0xcc350100,0x20328380,0x8223c240,0x6535a320,0x40b6d310,0x6d70cbd8,0x4dcd0f64,0xf0adeae2,0x957d1e8d },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0xb8000000,0x3c000000,0x56000000,0x85000000,0x6c800000,0x51c00000,0x70a00000,0xeb100000,0x95880000,0x8b5c0000,0x94660000,0x4f270000,0x135f8000,0x387ec000,0x713aa000,0x22449000,0x86eeb800,0xcfe95400,0xed6e0200,0xd5bb0100,0x17998380,0xac49c0c0,0x4fed22e0,0xad6650f0,0x35b21958,0x278ac614,0x145f3bb2,0x73ec9447 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0x68000000,0xd4000000,0x7e000000,0x7b000000,0xee800000,0xb1c00000,0xad600000,0x51100000,0xab880000,0x444c0000,0xc2260000,0x25bd0000,0x83e28000,0xc0dbc000,0x56ed6000,0x4d4ad000,0xd5afb800,0xcbf1ec00,0x44ce0200,0x70e10100,0x8a4c8180,0x912ac0c0,0x7f29e1a0,0x7c2c1350,0x7ea059f8,0x3d60fdec,0x290cd9ba,0x479a3fc7 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0x38000000,0x74000000,0x96000000,0x77000000,0x5a800000,0xef400000,0x1ee00000,0x35100000,0x6b880000,0x6acc0000,0x173e0000,0x1eb70000,0xd5768000,0x8fc6c000,0xd4b4e000,0xc86e5000,0x18526800,0x047c9c00,0xba560200,0x856b0100,0x67c08180,0x08bdc3c0,0xe27c60e0,0xb55f91d0,0xcbf00a58,0xee840ddc,0x59588b6a,0xf9e5cebd },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0xd8000000,0x64000000,0xda000000,0x97000000,0x85800000,0x18c00000,0xb6a00000,0x59100000,0x70880000,0xfe440000,0x99f60000,0xdc6b0000,0xa4b48000,0x82074000,0xb308e000,0x7f99b000,0x3fc29800,0xeb3a1400,0x25de0200,0x1c3f0100,0x304a8080,0x6ce842c0,0x3aea6360,0x8be5f190,0x0776fb68,0x6720e65c,0x03c27816,0x1527a563 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0x28000000,0x14000000,0x6a000000,0x91000000,0x05800000,0xb5400000,0xbba00000,0xa7100000,0xda980000,0x83dc0000,0x7e7e0000,0xee750000,0xf66a8000,0x2a794000,0xa4782000,0x776fb000,0xf7fb2800,0x2d37b400,0xb2c60200,0xabf90300,0x632c8380,0x81c043c0,0xdb74a0a0,0x91fff050,0x0a3789a8,0xa8444644,0xc8378a16,0xed4445d5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x48000000,0xac000000,0x8e000000,0xe5000000,0x4e800000,0x97c00000,0xe5600000,0x3e900000,0x0fd80000,0xe17c0000,0x0c920000,0x2cd10000,0xe6e98000,0x5bc3c000,0xbb6da000,0x73905000,0xfd593800,0xb0b50c00,0xa0e98200,0xd2c3c300,0x9beda380,0x11505040,0x1eb93920,0xb5e50eb0,0xc4518038,0xe82fc094,0xd627a2ba,0x4b3d521f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0xc8000000,0x04000000,0x0a000000,0x1b000000,0xeb800000,0x57400000,0x0fe00000,0x63900000,0xf3580000,0xb5ec0000,0x608a0000,0xd4c10000,0xecac8000,0x7e6b4000,0x47d26000,0xa329f000,0x932da800,0x4b299c00,0xe72c8200,0x392b4300,0xe0326180,0x14b9f340,0xa275ab20,0xe1c59c10,0x66268228,0xa1aa436c,0xe8fee22e,0x5e02b21d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0xb8000000,0x94000000,0x12000000,0xdd000000,0x86800000,0xe0400000,0xd2a00000,0xb2900000,0xa2480000,0x97a40000,0xb0120000,0xe81f0000,0x0c168000,0x96004000,0x770ca000,0xcf825000,0x74de4800,0xefe1f400,0xe6b68200,0xf0904100,0xe744a080,0x95265040,0xfa4c4ae0,0x73bef650,0x2a000248,0x09000274,0xb480029a,0x2d4003c1 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0xf8000000,0x74000000,0x66000000,0x13000000,0x9b800000,0x8a400000,0xf6200000,0x5f900000,0x54480000,0xf12c0000,0x92160000,0x35170000,0xe8828000,0x21cac000,0x847d6000,0xddadf000,0x6dc58800,0xb678a400,0xf8a28200,0x2d5ac100,0x2bb56180,0x96c1f0c0,0xf1f38be0,0xa8ffa5d0,0x22680398,0xeebc014c,0xa65e03ee,0xf43b02e9 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x50000000,0x28000000,0xdc000000,0x22000000,0x27000000,0xed800000,0xa7c00000,0xbf200000,0x09900000,0x51d80000,0xd63c0000,0x991a0000,0xc89d0000,0xdd478000,0x8d6e4000,0xe571e000,0x196e3000,0x8b64b800,0xd46d0400,0xcde78200,0x943e4300,0x2e09e380,0xed023140,0xf686b8a0,0x385c0770,0x17e20288,0x8731039c,0xdd858036,0x1fcf43df },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0x08000000,0x8c000000,0x5e000000,0x1b000000,0xda800000,0x62c00000,0xcc600000,0x2e900000,0xe8c80000,0xed7c0000,0x2d120000,0x1d890000,0x0e4d8000,0x29a9c000,0x6e726000,0x3392d000,0x4d539800,0x9724ec00,0xcead8200,0xb2f9c100,0x2e5a6380,0x99bed040,0x96699820,0xa781ee30,0x975a0378,0x5e35016c,0x513f80ea,0x11b0c1cb },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x68000000,0x5c000000,0x56000000,0x87000000,0xa3800000,0x22c00000,0x30a00000,0x95900000,0xd5c80000,0x1b3c0000,0xdb560000,0xdb650000,0x55a78000,0xfb14c000,0x6589e000,0x1dc5f000,0x97259800,0xd5407400,0x686f8200,0xfc28c100,0x08dfe380,0x71a0f0c0,0x090219a0,0x5094b570,0x6b466358,0xf37d331c,0xe9b2790e,0x9d1c844b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x48000000,0x64000000,0xb6000000,0x19000000,0xd6800000,0x36c00000,0x40200000,0xd0900000,0xa7d80000,0x12bc0000,0x60560000,0xb6f10000,0x70a08000,0x4758c000,0xfd6e2000,0x16fc5000,0x60b71800,0xdf5aa400,0xe1788200,0x8ce4c300,0xabb82380,0xa6cd50c0,0x18379920,0x2c926590,0x0dcea0d8,0x91a49364,0x7dd938da,0xf9a6f41b },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x68000000,0x74000000,0xee000000,0xc9000000,0x8a800000,0x27400000,0xff600000,0x8c900000,0xda480000,0xfbec0000,0x32da0000,0xc7a50000,0x24328000,0xf9efc000,0x79c02000,0x4631d000,0xe2e22800,0x90574c00,0xf4fa8200,0x6543c100,0xd47a2180,0x5d04d140,0x7498a9a0,0xe6548dd0,0x51e0a1b8,0x2dd71224,0x982a8baa,0x13fc5ddd },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xe8000000,0xe4000000,0x1a000000,0x11000000,0x53800000,0xb8c00000,0x80e00000,0xd1900000,0xc5d80000,0xbd740000,0xba560000,0x0ba50000,0x79b88000,0x4cad4000,0xa5232000,0x3cecf000,0x07935800,0x8ad9bc00,0xd5e08200,0xa8194300,0x84152280,0x8a19f0c0,0xc913dba0,0x5f90ff90,0x46cda268,0x8be4b344,0x9308fbce,0x2e980e23 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xe8000000,0x54000000,0xbe000000,0x1b000000,0x7f800000,0xa9c00000,0xbf600000,0x3d900000,0xf8d80000,0x55ec0000,0x48da0000,0x2de50000,0x94d68000,0x97e5c000,0xd9c26000,0xa7777000,0xb183f800,0xaacc0c00,0x4cee8200,0xc659c300,0x5ea06180,0xe6ee7140,0xc3577ba0,0x0a20cd50,0x88a060f8,0x69ee736c,0x62d7787e,0xe8e0cfe7 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0x48000000,0x14000000,0x2a000000,0x47000000,0x1e800000,0xf0400000,0x96200000,0x08900000,0xb9580000,0x4dbc0000,0x454e0000,0xa3b10000,0x704e8000,0x56234000,0xe88de000,0x49475000,0x05ae4800,0x5156a400,0x89b68200,0x374f4300,0x48bbe380,0x18da53c0,0xdf76c920,0x0d38e450,0xe81be2a8,0xc40a521c,0x720ecbfa,0xeb14e401 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x78000000,0xe4000000,0x42000000,0x5d000000,0xe5800000,0xd8c00000,0x1be00000,0x0b900000,0xebd80000,0x0d740000,0x65ca0000,0x4e770000,0xdb588000,0xbc2a4000,0xd8e0a000,0x75123000,0xb9905800,0xdeda5c00,0xd4e08200,0xcb0e4300,0x3292a280,0x8c413340,0x28bad9e0,0x4ba31f90,0xe52aa308,0xcf653274,0xf8c8d916,0x0bf01c23 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0x88000000,0xac000000,0xfe000000,0xbf000000,0x21800000,0x2c400000,0x86200000,0x5e900000,0x6dc80000,0x7a640000,0xa0ae0000,0x17490000,0x45b98000,0x9bd5c000,0x2970e000,0x5f34b000,0x7409c800,0x6a05e400,0x45178200,0x3c9cc100,0xc4c96080,0x98e173c0,0x2b792a20,0x263156b0,0xee9e49f8,0xc5d927fc,0x267ee206,0xd6adb271 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xb8000000,0x1c000000,0x2a000000,0xc7000000,0x25800000,0x49400000,0xc9600000,0xf2900000,0x44c80000,0xf4240000,0x45ee0000,0xff4f0000,0x646f8000,0x300f4000,0xd819e000,0xcc143000,0x6211e800,0x63138c00,0x13818200,0xa4404100,0x2bf66080,0x9e5b73c0,0xc4e80ae0,0xcfd7bc70,0xf3b86aa8,0x4fa7ce1c,0xd5b1e216,0x8aa033e5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0x78000000,0x9c000000,0x2a000000,0x95000000,0x20800000,0xb9400000,0x27e00000,0xb9900000,0xebd80000,0xa7bc0000,0x3cea0000,0x9a070000,0xfd178000,0x24834000,0xdf47a000,0xe0f89000,0x9011e800,0x580b1c00,0xac1d8200,0x82144300,0x71082380,0x9687d340,0x065c49e0,0x92648e70,0x2043eaa8,0x75601d54,0x39d80102,0x6ebc02a5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0xb8000000,0x34000000,0xca000000,0x59000000,0x8a800000,0x81c00000,0x58e00000,0x37900000,0x09580000,0xec3c0000,0xabe60000,0x941f0000,0x5a028000,0xb1134000,0xb68a2000,0xc7c0d000,0xffeff800,0x2e097c00,0x5b048200,0xbf9c4300,0x4550a380,0xf22f92c0,0x88e3dae0,0xff86acd0,0x6551f928,0xa22a7e64,0x80e003aa,0x739003c7 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0x98000000,0x6c000000,0xaa000000,0xcb000000,0xdc800000,0x18400000,0xece00000,0x93900000,0x5ad80000,0x19bc0000,0x32ee0000,0x5e9b0000,0x07498000,0xe6774000,0x82c46000,0x55bd1000,0x88f7c800,0xfd87bc00,0x2fc78200,0x383c4300,0x0f35e380,0xd1a653c0,0x16e5aa60,0x108dadb0,0x624fc8a8,0xafebbc2c,0x4b1182f2,0x1c8b40a1 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0xe8000000,0x64000000,0x2a000000,0x9b000000,0x05800000,0x2fc00000,0x18a00000,0xd4900000,0x61580000,0xcae40000,0x5ff60000,0x0b750000,0xaa208000,0x40cf4000,0x2f346000,0xcc433000,0x026f3800,0x68b0b400,0xdc8e8200,0x155e4300,0x38e2e080,0x48f970c0,0x40fbdba0,0x34fcc590,0xc6f5daa8,0xd1fdc56c,0x9a7b5a96,0x04a3877f },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x50000000,0xd8000000,0x2c000000,0xa2000000,0x65000000,0xe4800000,0xa8c00000,0xd2e00000,0x2b900000,0x9d480000,0xf0bc0000,0xc6ba0000,0x3da30000,0x26218000,0x737a4000,0x97d9a000,0x8f7c1000,0xadd9d800,0x267e3c00,0xbb538200,0x33a54100,0xa1222380,0x12f55140,0x8b89fb60,0x2d546cb0,0x78a1f888,0x32b86c94,0xb3b3fa12,0xe1376ee3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xc8000000,0x14000000,0x82000000,0xc1000000,0x14800000,0x8dc00000,0x61a00000,0xe3900000,0x4a580000,0xd1e40000,0x5f7a0000,0x0fb10000,0xcc8e8000,0xb1c64000,0x87af2000,0x38831000,0x43c27800,0xdea2d400,0xf00c8200,0x58034300,0xfc03a080,0xc6105140,0x8b19db20,0xc1968450,0x1b4f5808,0x2d74c404,0x96ba7ad2,0x2416d477 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0x58000000,0x3c000000,0xe2000000,0x4d000000,0xcd800000,0xadc00000,0x8ae00000,0x66900000,0x43580000,0x6da40000,0xf53a0000,0x49630000,0xfc4b8000,0x552a4000,0xd97ca000,0x84573000,0x39397800,0x637d3c00,0xf5498200,0x16bd4300,0x83b52080,0xb22a7140,0xddec5960,0x4a074cf0,0xb91dd988,0x6b8e0e34,0x6ecaf9b6,0xb0637cf7 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0x58000000,0xd4000000,0xee000000,0xab000000,0x1b800000,0x4a400000,0x3fa00000,0xca500000,0x7fa80000,0xaa5c0000,0xefba0000,0xf2570000,0x3ba08000,0x1c4ac000,0x90b5e000,0x07c9b000,0xdafca800,0x386e4400,0x10b5e200,0x47c9b100,0xbafca980,0xa86e4640,0x48b5e360,0x93c9b250,0x54fcaa38,0x036e44ec,0x5335e30e,0xd989b379 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0x58000000,0x9c000000,0xe2000000,0x8b000000,0x52800000,0x56c00000,0x4a600000,0xb6d00000,0x3a680000,0xded40000,0xee6a0000,0xf8df0000,0x1b798000,0xc3434000,0x9428e000,0x8d691000,0x3e523800,0x4bb85c00,0x6c28e200,0x41691100,0xa4523880,0x4cb85c40,0x84a8e360,0x00a91370,0x5eb23b08,0x27a85e6c,0xa620e22a,0x3e6d122b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x48000000,0x44000000,0xca000000,0x0d000000,0x28800000,0x51400000,0xd8a00000,0x59500000,0xbcb80000,0xc34c0000,0x49ae0000,0xe7c50000,0x96e68000,0xf87c4000,0xea372000,0x3d015000,0xa0910800,0xf5444400,0xa2b72200,0x1c415300,0xd0310b80,0x581446c0,0x9c0f2320,0x960d5210,0x7b1f08a8,0xe39146f4,0xfac9a382,0x66611355 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0xa8000000,0xac000000,0xe6000000,0x09000000,0x38800000,0xe2c00000,0x50a00000,0xead00000,0x2cb80000,0x84d40000,0x99ba0000,0xf2410000,0xde6f8000,0x7c7dc000,0xdf7ea000,0x38e2d000,0x53a6f800,0xdd4ac400,0xcffea200,0xb622d300,0xc506f880,0x2e9ac440,0x73c6a0a0,0x7c36d1b0,0xea1cfb18,0x3f0bc464,0xb9912042,0x665f123b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x48000000,0x64000000,0xea000000,0xc5000000,0x4f800000,0x75c00000,0x3b600000,0xa1d00000,0xd9680000,0xe0cc0000,0x4cee0000,0x18050000,0x5c028000,0x26084000,0x7b122000,0x289db000,0x9b5a9800,0xeb33dc00,0x2a722200,0x0c4db100,0xedb29b80,0x4e3fdcc0,0x15fc2320,0xd198b090,0x82d81828,0x4dfb9fd4,0x6d80021e,0x94c00147 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x58000000,0x54000000,0x72000000,0xcf000000,0xf2800000,0x99400000,0xcfa00000,0xfb500000,0x98b80000,0x7dd40000,0xe3ea0000,0x257f0000,0xbe308000,0x56894000,0xc35d6000,0xbcad1000,0xe7c94800,0xb0f06400,0xa9e56200,0xce791300,0xd6a34880,0x9ccf6640,0x8075e360,0x37a05250,0xff462948,0x92b6757c,0x76d6a8aa,0x3b6f3435 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0xd8000000,0xdc000000,0x62000000,0xdf000000,0x2c800000,0x15400000,0xbe600000,0x2b500000,0x43680000,0x38cc0000,0x0aa60000,0x4bf70000,0x438d8000,0x41c34000,0xe7326000,0x5f2cd000,0xb321c800,0xe9219c00,0x9a3a6200,0x0cb0d100,0x1aefcb80,0xea1a9dc0,0x0b11e160,0xda849270,0xdc502a08,0x2bf50ebc,0x738249d2,0x79c9de25 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x98000000,0xa4000000,0x5a000000,0x33000000,0xdf800000,0x4ac00000,0xa9600000,0xa4d00000,0x28680000,0xd4440000,0x732e0000,0xc6f70000,0x360a8000,0x85044000,0x1a80e000,0xf045b000,0x6928b800,0x55e11c00,0xd988e200,0x57d1b100,0x17eeba80,0x0e921cc0,0x724c6060,0x5e32f390,0xe06cdbe8,0x3847ec0c,0x85223b1e,0xa3e55ebb },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x08000000,0x84000000,0xea000000,0x8f000000,0x9c800000,0x2ec00000,0x86200000,0x18d00000,0xaf380000,0x45540000,0xa8620000,0xf6350000,0x00c28000,0x03204000,0xfb4f6000,0xc56dd000,0x61b1b800,0x589c9400,0x24d76200,0xf929d300,0x5c4bb880,0x0ded9740,0xad6fe220,0xd5b89110,0x4a9c5b28,0xf7c1057c,0x03b1b852,0x939c95ab },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x28000000,0x2c000000,0x82000000,0x61000000,0xbc800000,0x5e400000,0xbba00000,0x88500000,0x8ca80000,0x43cc0000,0xf9660000,0xfda90000,0xe7538000,0x43214000,0x980ba000,0xa404d000,0x3e1b6800,0xbb1b2400,0xd983a200,0x4cd8d100,0x06f56b80,0xee6e25c0,0xe63e22a0,0x2a8c91b0,0x89434988,0x003eb444,0xd5936852,0x1ec724c9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0xa8000000,0x8c000000,0xbe000000,0x41000000,0x31800000,0x05c00000,0x9ae00000,0xe4d00000,0x7b780000,0x69140000,0x7d9a0000,0x9bd10000,0xcbf38000,0x7d52c000,0xf2a1a000,0x4de5f000,0xd8429800,0xd13c6c00,0xa73ba200,0x9a34f300,0x8db11880,0xfd6eac40,0xcc1a00a0,0x5e110130,0x71138278,0x8982c144,0x21d9a266,0xa8f1f227 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x18000000,0x94000000,0xbe000000,0xa7000000,0x39800000,0x6a400000,0x6c600000,0x55500000,0x81e80000,0x21040000,0xda9a0000,0x55d70000,0xa5208000,0xa6a4c000,0x8dfe6000,0x4b1cf000,0x6397a800,0x5b4fbc00,0xeee46200,0x348bf100,0x0ad72a80,0x38bb7e40,0xfaf20260,0xca930350,0x0dda8078,0x9123c0dc,0x88b6e086,0x32fc33f9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0x08000000,0x94000000,0x36000000,0xbd000000,0x28800000,0xa9c00000,0x60a00000,0x2cd00000,0xc4380000,0x4f1c0000,0x6b820000,0xc84d0000,0x07e88000,0x50b7c000,0x34cd2000,0x3837d000,0x3d049800,0xe88a0400,0xc9cf2200,0xb0bad300,0x24cc1980,0x502dc740,0x791a0220,0xd6810150,0xe0d28158,0xae26c1b4,0x3007a082,0x181d10f7 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x08000000,0xf4000000,0xc6000000,0xe9000000,0xd6800000,0xf2400000,0x06200000,0x4f500000,0x86a80000,0x8c1c0000,0x1a1e0000,0x0b0d0000,0x41888000,0x31d9c000,0x10e3a000,0x94321000,0xf05b6800,0x613e1400,0xe4dda200,0xd46f1100,0x997be980,0x71fbd6c0,0xf6a00220,0xa41002d0,0x3e080298,0x750c0164,0x5496037a,0xd5410019 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0xc8000000,0xfc000000,0xc6000000,0xa5000000,0x7a800000,0xc6400000,0x8ee00000,0x2f500000,0x9a680000,0xe0140000,0x10060000,0x981d0000,0x44118000,0xf201c000,0x9f0b2000,0x19979000,0x19cc6800,0x323e8c00,0x67ed2200,0x3bda9100,0x5535e880,0x6a6b4dc0,0x68000120,0xcc0002f0,0x2e000398,0x29000354,0x748002ca,0x9f4000e9 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x58000000,0xac000000,0x6e000000,0x41000000,0x23800000,0x46c00000,0x22200000,0x33d00000,0x23a80000,0x4a040000,0x8b1e0000,0xe89f0000,0x0e438000,0x9c66c000,0xf7ada000,0x7811b000,0x5c1cf800,0x96023400,0x5d13a200,0x159eb100,0xabd77a80,0x6fb0f6c0,0x34080360,0x221403b0,0x3f160338,0x8a8b03c4,0x915581ee,0xa6edc3ab },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x48000000,0x0c000000,0xca000000,0xfb000000,0xb1800000,0x5ec00000,0xc9600000,0xc1d00000,0xaee80000,0x46040000,0x71020000,0xea9d0000,0xbf4b8000,0xdfb04000,0x04aee000,0xa5377000,0x13f8b800,0x86891c00,0xc54ce200,0x9cba7100,0xa13b3a80,0x75ed5d40,0xe7880320,0xc7d40130,0x7fea01a8,0xfc9902ac,0x864983e6,0x392d414b },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xa8000000,0xfc000000,0xaa000000,0x63000000,0x18800000,0xbb400000,0xa6e00000,0x7a500000,0x91680000,0xfb940000,0xe3d60000,0x3db10000,0x2cb18000,0x43384000,0x96efe000,0xb2545000,0xbd7c0800,0x09974c00,0xd4d1e200,0x73315100,0x5efb8880,0x9e4e0fc0,0x4f6780a0,0x3e8942f0,0x9a5e6228,0x016c124c,0x8393eac2,0x47c31d1d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0xd8000000,0x24000000,0xf2000000,0x2b000000,0x7f800000,0xb2c00000,0x24200000,0x03d00000,0xbca80000,0xb0840000,0xdf520000,0xcdef0000,0x506e8000,0xf1bd4000,0xfe0de000,0xb517b000,0xfa863800,0xe04ef400,0xe877e200,0xe5bcb100,0xa41aba80,0xb20cb740,0x8b1c8160,0xaf824190,0x6acb6148,0x002ef3ec,0xf1d9da9e,0x97b6465b },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xd8000000,0x4c000000,0x22000000,0xdf000000,0x26800000,0x8ec00000,0xb0e00000,0xefd00000,0x73780000,0xf4940000,0x19d20000,0x227f0000,0x5f138000,0xe6874000,0xaed66000,0xe0ea9000,0x37c13800,0x3f634c00,0xd69c6200,0xc6d19300,0x04f8b880,0xd1cf0d40,0x566b8160,0x41134230,0x93846008,0xc355923c,0x26b2bbfa,0xf4f40f0b },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x68000000,0xec000000,0xfa000000,0xfb000000,0x61800000,0x89c00000,0xd9200000,0x34d00000,0x01a80000,0x33840000,0x7ece0000,0xd2b90000,0x1e0b8000,0x3d1a4000,0x9896e000,0xa7557000,0x4f635800,0x893a9400,0x8cd0e200,0x15b87100,0x7d8eda80,0xfbddd4c0,0x5e2383a0,0xf75e42b0,0xf778e168,0x9d3c732c,0xc2c0d826,0x90a4d597 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0x68000000,0x6c000000,0x62000000,0x69000000,0xc2800000,0xf2c00000,0x5e600000,0x7dd00000,0x3bf80000,0x269c0000,0xccc60000,0x5d610000,0x4a438000,0x01b94000,0x8f3ca000,0x4fe21000,0x809a7800,0xcbd41c00,0x64e2a200,0x7b0f1300,0x0387f980,0x3c405fc0,0x3ea383a0,0x22a942b0,0xe8a4a008,0x8dae1264,0xdd247aaa,0x2ee91e7b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0xb8000000,0xac000000,0x46000000,0x6b000000,0xdf800000,0xbec00000,0x1fa00000,0x37d00000,0x99380000,0x87840000,0x82c60000,0xb1a30000,0xb8db8000,0x14a7c000,0xb85ce000,0x6ff53000,0x8c29b800,0x5f1b8400,0x0582e200,0x8bc23300,0xf72c3a80,0xa88b47c0,0xff5b80e0,0x3667c1b0,0xf9fce398,0x6f25326c,0x3491b99e,0xa15f844b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0xa8000000,0x0c000000,0x22000000,0x27000000,0xf8800000,0x65c00000,0x4c600000,0xdd500000,0x49b80000,0x81240000,0x8cfe0000,0x6c890000,0x23db8000,0xe5734000,0x90d66000,0x5bf7d000,0x5c099800,0x5a183c00,0x930de200,0xce849300,0xc4dffa80,0xbdefeec0,0x450478a0,0xbf9caf30,0x8d521808,0x31ab7d5c,0x353b81c2,0xbae34067 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0x78000000,0x7c000000,0xe2000000,0x11000000,0x0b800000,0x7ec00000,0xf9600000,0x25500000,0xbfa80000,0x402c0000,0xa8e20000,0x968b0000,0x9f418000,0xa2b54000,0xe1a8a000,0x1325b000,0x827a3800,0x4bde3c00,0x1ce92200,0xe090f100,0x88529b80,0xf63b8f40,0x1ff31be0,0xf21eccf0,0xc913ba08,0x47877e04,0x34c3804e,0xec6e424b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x18000000,0x3c000000,0x3e000000,0x99000000,0xd3800000,0x13c00000,0x3ee00000,0x58500000,0x51280000,0xb8ac0000,0x60660000,0x22070000,0xf70d8000,0x4286c000,0x1449a000,0x37393000,0xfda11800,0x7df14c00,0xb0c42200,0x267ff100,0x3708bb80,0xe2987fc0,0x044d3a60,0xdf22bdf0,0xd9aa9978,0x7fe08ca4,0x17c802ae,0x6cfc027f },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0x98000000,0x64000000,0x2e000000,0xab000000,0xfc800000,0xe6c00000,0xf8a00000,0x26500000,0xf4680000,0x2bec0000,0x8daa0000,0x39d70000,0xf22a8000,0xef88c000,0x4e50e000,0xd879d000,0x19e2f800,0xfcbb2400,0xd85a6200,0x27611100,0x237a1b80,0xdd7ef640,0x0e7a9860,0x06e13490,0x5620f938,0x618025ec,0x955ae012,0x2cfed14b },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0xa8000000,0x6c000000,0xf2000000,0xdf000000,0x42800000,0x15c00000,0x57200000,0x63500000,0x04e80000,0xed640000,0x5c2a0000,0x57d90000,0xf0238000,0x45dd4000,0x1f396000,0x3f4a9000,0xcef09800,0xf6761400,0x80bae200,0x6f07d100,0x3a81fa80,0x71c88640,0x592878a0,0xe65cc4b0,0xf57a9b48,0x483f143c,0xc1d1632a,0x212e92a7 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x48000000,0x4c000000,0xd6000000,0x63000000,0x9f800000,0xbf400000,0xb6a00000,0x76d00000,0x2ae80000,0xffe40000,0xb3720000,0x2ba50000,0x764f8000,0x6425c000,0xc102e000,0x3e8bb000,0x31d5c800,0x3f700400,0x1da56200,0xe54a7100,0xe3a52a80,0x7a5eb540,0x123f2b20,0xf21fb430,0xe902abd8,0xc29f75cc,0x5fcfcbde,0x0871078d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0x98000000,0x64000000,0x06000000,0x65000000,0x55800000,0xb6400000,0x17600000,0x15d00000,0x7c280000,0x633c0000,0x71be0000,0x91670000,0x30de8000,0x49b1c000,0xe5692000,0xfecbf000,0xe0a12800,0x4af2bc00,0x4f9fa200,0xc1463100,0xd9f60980,0xc71e4cc0,0x16800860,0xd6d54c90,0x5ca88b98,0x48ef8c54,0x1c8928b6,0x69cebe89 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x68000000,0x5c000000,0xaa000000,0x5d000000,0x91800000,0x34400000,0x04a00000,0xf7d00000,0x19e80000,0xf4fc0000,0x3d7a0000,0x4d390000,0xc79d8000,0xf35e4000,0xd0232000,0x7613f000,0xb716e800,0xac8bc400,0xb5d6a200,0x58f1b100,0xaf6fc980,0x44313440,0xb015cba0,0x58083470,0x44084928,0x8e167434,0xc30b6866,0x3a9584e1 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xc8000000,0x64000000,0x9a000000,0xfd000000,0xa6800000,0xecc00000,0x86200000,0x08500000,0xabe80000,0xcef40000,0x74660000,0x8ea50000,0xfb8e8000,0xfa584000,0x82f02000,0x1a7c1000,0xf1bcf800,0xfc187400,0x8616a200,0xeb105100,0x558ad880,0xe55167c0,0x556cd920,0x5e346490,0x344258e8,0x4dfc2534,0xf5fa7b3a,0x19e434e3 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0x88000000,0x74000000,0x6e000000,0x2f000000,0x7f800000,0x4c400000,0xfea00000,0xc9d00000,0x23e80000,0x8ffc0000,0x3dea0000,0xf8e50000,0xde688000,0x3ebac000,0xe9dc6000,0xd3ebb000,0x97f02800,0xc1ed8400,0xe2fce200,0x9f7d7100,0x6e2e4980,0xda1f3640,0x610e4820,0xa08f34d0,0x2bc64a38,0x4ee337fc,0x2d64485e,0xab2a37a1 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0xe8000000,0xfc000000,0x12000000,0x67000000,0xf4800000,0xeac00000,0xbe600000,0x40500000,0xf9b80000,0x89bc0000,0x31ba0000,0x45b90000,0x3ba98000,0xa6a94000,0xc9386000,0xc5685000,0xf6c77800,0xfc637c00,0xaf49e200,0x612d1300,0x997d1980,0x14ce2e40,0xe37d19a0,0x4fce2cf0,0x65fd1bc8,0x520e2cdc,0xc71d1bf2,0x049e2d1b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0x38000000,0x7c000000,0xb2000000,0xaf000000,0xb8800000,0x54c00000,0x4a600000,0x8a500000,0x77b80000,0xc1ac0000,0x80b60000,0x35330000,0xbe658000,0x5c5b4000,0x06a76000,0xac3bd000,0x87f7b800,0x5d017c00,0x379ae200,0xfc5c9300,0xd6bedb80,0x8435afc0,0x33e6dae0,0xab09aef0,0x5688db48,0x59c6ae7c,0x95e35b82,0x2202ec63 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0xc8000000,0x14000000,0x8e000000,0xcf000000,0x7d800000,0x5bc00000,0x53200000,0x49500000,0x85780000,0xb9ac0000,0x93120000,0x279d0000,0xfac48000,0x31b2c000,0xa7126000,0x9984f000,0x2ddf5800,0x90263400,0x66c4e200,0x8bab3300,0xd609bb80,0x33100740,0xd789d920,0x02c9f750,0x3db203b8,0xf50d037c,0xcc9c8156,0x114ec27f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0xa8000000,0x64000000,0x96000000,0x23000000,0x0f800000,0x50400000,0xc8600000,0x0cd00000,0x9fb80000,0xa0fc0000,0x550e0000,0xdc810000,0x97c68000,0xcc21c000,0xfaade000,0xd477b000,0xa6d8a800,0x86ae9c00,0x4e656200,0x17d77300,0x0c33c980,0x9ab8ecc0,0xe47028a0,0x0ede5e90,0xe2b601d8,0xd87d034c,0x34c8831e,0x03a0c011 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x90000000,0x58000000,0x04000000,0x82000000,0x05000000,0x05800000,0x52400000,0x42e00000,0xcad00000,0x71280000,0xe8740000,0x340a0000,0x0a070000,0x79168000,0x13894000,0x8d4b2000,0x46707000,0x1f0aa800,0x64804c00,0x65d7a200,0xddbe3100,0xd1b70880,0x6fa97e40,0x5cbe2b60,0x163a0d10,0x18e00088,0x8bd00354,0xd6a801f6,0x2f340319 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x98000000,0x34000000,0x22000000,0x2b000000,0xbd800000,0x79400000,0x2fe00000,0x57d00000,0xaf280000,0x1b640000,0xf81e0000,0xe40f0000,0x2a148000,0xb7114000,0x3390e000,0x44557000,0x9b6e0800,0xb8072c00,0x441a6200,0x1a0b3100,0x2f0a6a80,0x07931cc0,0x664c8860,0xb07d6dd0,0x05800008,0x3d40016c,0x35e00216,0x78d001f5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x68000000,0x24000000,0xaa000000,0x93000000,0xf4800000,0xc4c00000,0x8da00000,0xb7500000,0xcff80000,0x51240000,0x37920000,0x98410000,0xcd6a8000,0x40f24000,0x83b3e000,0x4e535000,0x0869b800,0xb16e4400,0x16eb6200,0x86b01300,0x1fc8da80,0x4d2b5740,0x11833ba0,0x255c0790,0xd0f88228,0x8bb3420c,0x1a5960f2,0x1a6110c3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x28000000,0xcc000000,0x4a000000,0x81000000,0x61800000,0x4a400000,0xdee00000,0x2ed00000,0x83380000,0x69740000,0x678a0000,0x41590000,0x1e7f8000,0x151e4000,0x3f94a000,0x5558f000,0x80722800,0x2a12cc00,0x71012200,0x798fb300,0xbe410880,0x70f07c40,0x29d5aaa0,0x29a88c30,0xc3a783a8,0x92ba4144,0xfb26a1a6,0x6d75f259 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0x98000000,0xe4000000,0x76000000,0xb5000000,0xe3800000,0xae400000,0xfe200000,0x94d00000,0x09e80000,0x1bbc0000,0x57860000,0x90570000,0xa72e8000,0x8d53c000,0x18b12000,0x21123000,0x4d9ba800,0x9f4a1400,0x9bb9a200,0x1786f100,0xf04c0980,0x5727e7c0,0x155d2860,0xfca5d690,0x570e8258,0xf883c014,0x7cd9206e,0x35ee32e9 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0xd8000000,0x24000000,0x82000000,0x91000000,0xa2800000,0x2f400000,0x19200000,0x0ed00000,0x1df80000,0x5e2c0000,0xb74a0000,0x1d3f0000,0x7cca8000,0x44f14000,0x00a1a000,0x3e0a9000,0x17188800,0x419fd400,0xd4d92200,0x68e8d300,0x9eb9ab80,0x191b0440,0x7e8a8960,0x795cd790,0xc221a388,0xc14a9104,0x36388a6a,0x7b4fd46d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0xf8000000,0x5c000000,0x26000000,0x05000000,0xf2800000,0x91400000,0x43600000,0x08d00000,0x61b80000,0x82740000,0x90560000,0xfbe30000,0x62818000,0x795dc000,0x37702000,0x7adf1000,0xe6b14800,0x0fe91c00,0xd09fa200,0xde55d300,0x4af6e880,0xc218cfc0,0x9f0749e0,0x019a1e70,0x6ec62218,0x84ac10d4,0xa0e8c8aa,0x0910dcf5 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0x58000000,0x3c000000,0x82000000,0x53000000,0x5c800000,0xd3c00000,0x67e00000,0xb6500000,0x4fa80000,0x58ec0000,0x70c20000,0x137f0000,0x31918000,0x1e494000,0x5bbae000,0x8ef65000,0x15d35800,0xfafe8c00,0x53c16200,0x27ec1100,0x565a3b80,0x9fae9f40,0x00f15b60,0x4cd18df0,0x9178e388,0x6289530c,0x42c2db92,0x8877ccff },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0x38000000,0xdc000000,0x92000000,0x0f000000,0x97800000,0x7fc00000,0xee200000,0x49500000,0x8b780000,0xa8240000,0x50460000,0x8deb0000,0x95718000,0xbd334000,0x8cc16000,0x5bb93000,0xa1915800,0x5ec45400,0x34aee200,0xe6157300,0x691fba80,0x3e8125c0,0xe1495ae0,0x7f705470,0x0e30e2c8,0x594a72fc,0x6370383e,0x3c2d674f },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x90000000,0x38000000,0x54000000,0x5a000000,0x0f000000,0xc6800000,0x60400000,0x4aa00000,0x17d00000,0xd1780000,0x38a40000,0xb4da0000,0xb9eb0000,0x9dfc8000,0x0ff64000,0x5cf06000,0x3c771000,0x652fa800,0xe813e400,0x0c0ee200,0x3e1e5300,0xfd014a80,0xa59db640,0xa8d7aae0,0x7ff7e650,0x94f4e1e8,0x6065517c,0xc325c97a,0xd11ff691 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0xb8000000,0x34000000,0x92000000,0xdd000000,0xff800000,0xdcc00000,0x9e200000,0xee300000,0x76280000,0x92340000,0x88320000,0xd9250000,0x80a38000,0x1371c000,0xafca6000,0x62a59000,0x56760800,0xb441cc00,0xa4760a00,0x9941cf00,0x03f60980,0x4181cfc0,0xb7d60b60,0x46b1cf10,0xac7e0928,0xd545cc64,0x45ec0ad6,0x3e90cf17 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x08000000,0xcc000000,0x92000000,0xb9000000,0x10800000,0xf3c00000,0xb4200000,0xe4300000,0x1c380000,0xb8340000,0x56220000,0x75230000,0x10ba8000,0x61e8c000,0x9f1fe000,0xdf8df000,0xd45b8800,0xc4610c00,0xce5b8a00,0xf1610d00,0x2cdb8b80,0x0ba10fc0,0x807b8ba0,0xd0510cf0,0xba6389e8,0x35550e14,0xe0f989aa,0x0b820ddb },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x98000000,0xec000000,0x2a000000,0x27000000,0xa9800000,0x09400000,0x11e00000,0x99f00000,0x2de80000,0x8be40000,0x16f60000,0x00650000,0x4cb88000,0x7e1dc000,0xd1092000,0xcc841000,0x63c93800,0xef390400,0x60493a00,0x01790700,0xb8293b80,0x01c90540,0x1c2139e0,0xffdd06f0,0x0d3f3948,0x535c066c,0xfef1bbee,0x2464c649 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0xf8000000,0x84000000,0x26000000,0xa7000000,0x3a800000,0x9ec00000,0x4fe00000,0x87f00000,0x4bf80000,0xe1e40000,0x0ce60000,0xcb790000,0x6a298000,0x008d4000,0xcbc9a000,0xec66f000,0x10b92800,0x7e5ad400,0x94392a00,0x939ad500,0xdf592980,0xb9aad540,0x3fc12a60,0x627ed750,0x2bbf2af8,0xf6d3d5cc,0x73e8aa12,0xc5f397b7 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0x28000000,0x34000000,0x76000000,0x53000000,0xb1800000,0x57400000,0xf5e00000,0x4bf00000,0x7cf80000,0x837c0000,0xab3a0000,0x855f0000,0x88e98000,0x957f4000,0xe8392000,0x2ccd1000,0xc3b4f800,0x2291c400,0x86ccfa00,0xb2adc500,0xa616fa80,0x2b02c5c0,0xbd877a20,0x0d418510,0xcce45bf8,0xeb63945c,0xbf21213e,0xc3411101 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x98000000,0x0c000000,0x6a000000,0x85000000,0x30800000,0xd7c00000,0x7ae00000,0x9cf00000,0x33f80000,0xa67c0000,0x11360000,0x24050000,0xce148000,0x0b11c000,0x1b856000,0x9c497000,0x7ea08800,0xee5e5400,0xb7b88a00,0x94d25500,0xb5768a80,0x46ab5440,0xf25408e0,0x65bf9470,0x4dc5e948,0x77e72664,0x1860018a,0xd230013b },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x48000000,0xa4000000,0xb6000000,0x69000000,0x56800000,0x18400000,0x4e200000,0xcc300000,0xbb280000,0xd0ac0000,0xb0760000,0x631f0000,0xa59b8000,0x15d54000,0x0ffc6000,0xeddcb000,0xd3feb800,0x47cffc00,0x30f6ba00,0x2253ff00,0x0528ba80,0xfda0fc40,0xa0e53ba0,0x8a5abed0,0x512ad978,0xd3bf4f74,0x25fe0022,0xcec30315 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0x38000000,0xc4000000,0xe6000000,0x85000000,0x23800000,0x39c00000,0x84e00000,0x5ef00000,0x19f80000,0xc96c0000,0x5e2a0000,0x3c8d0000,0xfd458000,0x5db14000,0x7545e000,0xe1bf9000,0xf753a800,0xb2b1b400,0x69cbaa00,0x6cedb500,0x32f9a880,0x33fcb5c0,0x566e2860,0xdaacf6d0,0x45c44bf8,0xe6ef24c4,0x9df78376,0x8f604023 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x50000000,0x88000000,0xac000000,0x5e000000,0x2d000000,0xf8800000,0x88c00000,0x5ea00000,0x13b00000,0xfb380000,0x1be40000,0xb94e0000,0x7cef0000,0x06c28000,0xbbad4000,0xa726e000,0x7df6f000,0xe0556800,0xfe6bfc00,0x511b6a00,0x6e84fd00,0xe9d9e980,0xa829bc40,0x3e7f0ba0,0xf11f4ef0,0xde8a62d8,0x31c4b244,0x8c290b3a,0xcc644d67 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0xa8000000,0xf4000000,0xf6000000,0xbf000000,0x7c800000,0x07c00000,0x4ee00000,0x81f00000,0x95680000,0xc6bc0000,0x8e420000,0x18a70000,0x05518000,0x32334000,0x4d86a000,0xa85e3000,0x3fa74800,0x85c1d400,0xc7e54a00,0xe266d700,0x1e34c880,0x279594c0,0xb5526a20,0xfa3ba710,0xe99d21f8,0x064671ec,0xdcba6a0a,0xfb47a6f3 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x90000000,0x88000000,0x1c000000,0x16000000,0xb9000000,0x3f800000,0x2a400000,0xf3e00000,0x62f00000,0xf1680000,0x35340000,0x7bc60000,0xa4a70000,0xcc8c8000,0x9ada4000,0x2f3b6000,0x9cd39000,0xde3e5800,0x5f446400,0x72785a00,0x9da36700,0x3314d980,0x50892540,0x4cc7bba0,0x762eb530,0x335fe3f8,0x7c7dd3d4,0xb0a33906,0x0680f47d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0x58000000,0x2c000000,0x12000000,0x31000000,0x0e800000,0x1f400000,0x62e00000,0x1bf00000,0x81780000,0xd02c0000,0x19d60000,0x49ad0000,0xe7108000,0x699ec000,0x36dee000,0xf43a3000,0x3fdd5800,0xe6a5c400,0x1a8b5a00,0x1148c500,0x69fbd880,0x80660640,0xf6bd39e0,0xa28036f0,0x4d4e61a8,0xf3e4f234,0xc563bb92,0xc62ff749 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xf8000000,0xa4000000,0x1a000000,0xa7000000,0x88800000,0x6b400000,0x07200000,0x08300000,0x6cb80000,0x61fc0000,0x8fc20000,0x4a6d0000,0xc6018000,0x591ec000,0x15982000,0xb4cc3000,0x1cf4d800,0xc04cfc00,0x79b6da00,0xa261fd00,0x0a175a80,0xcf0f3ec0,0x04977960,0xdd4f0c50,0xe639a108,0x99a2f2cc,0x3274f92a,0x220cce61 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xd8000000,0x1c000000,0x46000000,0xd1000000,0x20800000,0x42400000,0xae200000,0xfb300000,0xe1a80000,0xa4fc0000,0x135a0000,0x4eb10000,0x197a8000,0x7f9e4000,0x87c66000,0xeee77000,0xac53b800,0xdb233c00,0x11a9ba00,0xdce23f00,0x3f5b3880,0xd0b07fc0,0xd46f5be0,0x191a0fb0,0x149c62f8,0x605670f4,0x1529387a,0x94bd7efd },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0xf8000000,0x4c000000,0x6a000000,0x8f000000,0x43800000,0x02400000,0x7fa00000,0xf4b00000,0x59280000,0xfa6c0000,0x47560000,0xa3390000,0x6d788000,0xb8c9c000,0xe3762000,0x29d35000,0x29e99800,0x5d14ac00,0x609f9a00,0xdbddaf00,0xdaef1a80,0x7c886c40,0x89c73960,0x39fe3d70,0x850820c8,0xfc86534c,0x49c71bc6,0x19e46c45 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xd0000000,0xf8000000,0x14000000,0xe6000000,0x99000000,0x47800000,0xef400000,0x4de00000,0x12f00000,0xbc780000,0xdca40000,0x421e0000,0x17110000,0xd29b8000,0x8adb4000,0x25b26000,0x95959000,0xe052f800,0x5b738400,0x8634fa00,0x14c68500,0xe8b17980,0xd40cc640,0x46189a60,0xa9021610,0x6f9801f8,0x03540074,0xbfe602e6,0x6df502c9 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0xc8000000,0x4c000000,0x3a000000,0x1f000000,0x94800000,0xebc00000,0x37600000,0x82700000,0x31f80000,0x6aac0000,0x701a0000,0x28130000,0x5c128000,0x4201c000,0x9b142000,0xe29fb000,0xcecb4800,0xbceae400,0xfd294a00,0xed55e500,0xdfa1c880,0xc38727c0,0x73476ba0,0x46a956f0,0x1a000348,0xef00028c,0xfc80031a,0x17c00023 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xa8000000,0x2c000000,0xfe000000,0x51000000,0xef800000,0x06400000,0x57600000,0x10700000,0x22e80000,0x05240000,0xfd0e0000,0xd18b0000,0x37568000,0xe8e54000,0xbe356000,0x59859000,0xeb5cd800,0x8efbf400,0x3b3ada00,0xcc14f700,0x6e025b80,0x990ab640,0x9389b920,0x504e66f0,0x2a6e02d8,0x01fb03b4,0x75be8366,0xbdc140ad },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0xc8000000,0x7c000000,0xc2000000,0x13000000,0x61800000,0xc3400000,0x58200000,0xa1300000,0x5fb80000,0x97740000,0xd3020000,0x418b0000,0x134c8000,0x2038c000,0x153ca000,0xe1a19000,0x467a7800,0xa19f3c00,0xe3407a00,0x88203d00,0xd92efb80,0xeba3ffc0,0x2966d8a0,0x020eae30,0x330203a8,0xb18b027c,0xbb4c802e,0xec38c071 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0xf8000000,0x2c000000,0x96000000,0xcf000000,0x62800000,0xdd400000,0xfea00000,0x4bb00000,0x90380000,0x10ec0000,0xf9860000,0x45c90000,0xdae48000,0x48924000,0x9c59a000,0x8f36f000,0xca66d800,0xa8d6cc00,0x7d78da00,0xa643cd00,0x96225880,0xc7f48c40,0x47197b60,0xa6993cf0,0x3f428138,0xdbab43cc,0x882522b2,0xccf8b1b9 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x48000000,0x5c000000,0x3a000000,0xe7000000,0x99800000,0x04400000,0xbb200000,0x0a300000,0x46b80000,0x407c0000,0xec8a0000,0xf6d30000,0xc4f08000,0xf643c000,0x40312000,0x89b71000,0x15e61800,0x2acd3c00,0xbef41a00,0x31523d00,0x69b69a80,0xc5feffc0,0xf2dd3ba0,0x1ae92eb0,0x1f428348,0xe8acc12c,0x816ba32e,0x8817d03d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x58000000,0xac000000,0xde000000,0xe9000000,0x99800000,0x82c00000,0x9d600000,0x3e700000,0x6cf80000,0x08ac0000,0x239a0000,0xb1c10000,0x67fc8000,0x0e234000,0x85c06000,0xf5fc5000,0x29378800,0x1d48e400,0x1ab58a00,0x4495e500,0x894b0880,0x38aba7c0,0x3b95e9e0,0xbdd9b570,0x09e48298,0xbf3f42d4,0xb04262fe,0xa92151df },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x50000000,0x08000000,0x54000000,0xd6000000,0xe5000000,0xab800000,0xe9400000,0x1b200000,0x70b00000,0x39f80000,0x92c40000,0xba7e0000,0xdf870000,0xcf498000,0x462d4000,0xd736e000,0x5aaa1000,0xeefa7800,0x525ffc00,0x41b3fa00,0x0472bd00,0x7e851980,0x5ad8ac40,0x4e7f61a0,0xb9875110,0x724c98f8,0xb1b5ef84,0xbc6983d6,0x729d4061 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x18000000,0x54000000,0xfa000000,0x83000000,0xca800000,0x95c00000,0xb7a00000,0x2d300000,0x70f80000,0x1b5c0000,0x307a0000,0x75810000,0x89578000,0x9f72c000,0x8103a000,0xcd9d7000,0x2d550800,0x5d745c00,0xe6028a00,0xe5069d00,0x6f812a80,0xda5befc0,0xddf422e0,0xe8dfb290,0xcc2eab08,0x2d752d9c,0x9e0d82a2,0x2103c00b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0x48000000,0x9c000000,0x42000000,0x51000000,0xc2800000,0x25c00000,0x65600000,0x9ff00000,0xfe280000,0xad5c0000,0xeda60000,0x8a070000,0x0d088000,0x2086c000,0x24dbe000,0xeff33000,0x26354800,0xd9500400,0x63bdca00,0xd116c700,0x02862880,0x85d5f640,0x357b61a0,0xd7e9f030,0x6228aaa8,0xef543674,0xbca80122,0x489c00a3 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x38000000,0x04000000,0x76000000,0xdf000000,0x84800000,0x84400000,0xfca00000,0x5c300000,0x7e780000,0xf5c40000,0x617a0000,0xd1450000,0x75218000,0x65e54000,0x1503a000,0x6996b000,0x49c97800,0x53784c00,0x9848fa00,0x5ead0d00,0x5d335980,0x69ffbcc0,0xbf002160,0xb482f0d0,0x5c495ab8,0x88babeac,0x1221a12a,0xa567b07d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0x48000000,0x5c000000,0xaa000000,0xb5000000,0x17800000,0x42400000,0x06200000,0xddb00000,0x8de80000,0x0acc0000,0x06fa0000,0x9e5b0000,0x6c3c8000,0x48a3c000,0xaa666000,0x00841000,0x5ccd9800,0xe9f43c00,0x54d11a00,0x55e7ff00,0xeedf7a80,0x98efefc0,0xed48e3a0,0x2cb0d2b0,0xf46d7b08,0x5388ef64,0x2c4661d6,0x1d3411ad },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0x98000000,0x5c000000,0x12000000,0x07000000,0x4e800000,0x4ac00000,0xf7e00000,0x2b700000,0xa6a80000,0xbfdc0000,0x6e7a0000,0xa7210000,0x6f868000,0xb556c000,0xaaab2000,0xe5de7000,0xbd60e800,0x8fb3b400,0xf44e6a00,0x45397700,0x909f4880,0xb7c605c0,0xda7922e0,0xd12370b0,0x969c68a8,0x76c477ac,0xf5e3c912,0x0471c747 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0x78000000,0x14000000,0x2a000000,0x69000000,0x0e800000,0x54c00000,0x82200000,0xc6b00000,0x4b680000,0xcfcc0000,0x61b60000,0xeef10000,0xb08f8000,0xd7d4c000,0xc5a4e000,0xccfcb000,0xe583e800,0x9f40cc00,0xc6646a00,0x03580f00,0x10768a80,0x0c55be40,0x19fae360,0x6d01b210,0xbc9a69c8,0x59d50cb4,0x8ea70b72,0x977c7fa7 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0x28000000,0x84000000,0x82000000,0x55000000,0x37800000,0xb0400000,0x3be00000,0x06700000,0x37380000,0xb15c0000,0xc66e0000,0x57330000,0x814f8000,0xfe69c000,0xfb3c6000,0x87431000,0x2963d800,0x99a14400,0x00945a00,0xa2d48500,0xa4263a80,0x31d49540,0x24b26220,0xd3001350,0xa0945a28,0xf2d48704,0xac263876,0xa5d49485 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0x48000000,0x8c000000,0x9a000000,0x57000000,0x4b800000,0x50400000,0x0ca00000,0x65300000,0xe6780000,0x975c0000,0x1f220000,0xa1730000,0xc4ce8000,0xfb67c000,0xf3d22000,0xe0ffd000,0x9b851800,0x28462c00,0xe8b39a00,0x033ded00,0x6363ba80,0x07c13cc0,0x9ef023a0,0xaa8cd2f0,0xe6cb9bc8,0x2861eeac,0x8e41b866,0x0db23f2d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x70000000,0x88000000,0x04000000,0x66000000,0xc5000000,0x57800000,0xcac00000,0x99a00000,0x6c300000,0xe5f80000,0x3ecc0000,0x37b20000,0x0d3b0000,0xa4678000,0xb9114000,0xfd86e000,0xcdd59000,0x1d348800,0xbc6ddc00,0xe50b0a00,0x67809d00,0xe2c7e880,0xeda20cc0,0x8226e2a0,0x24e590d0,0x0f4c8938,0x3861dec4,0xc31908e6,0x028b9d2f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xb8000000,0x94000000,0xaa000000,0xb9000000,0x77800000,0x87c00000,0x5b600000,0xc2f00000,0xbe280000,0x97c40000,0xd36a0000,0x8ef50000,0x70338000,0x3cd4c000,0x89fae000,0xd4b99000,0x159aa800,0xd2d1a400,0x72e12a00,0xa6316700,0x93d9cb80,0x3179f4c0,0x1bfae160,0x39b99290,0xa81aa9c8,0x1c11a774,0xe6012b96,0x770165ab },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0x38000000,0xdc000000,0xde000000,0x6d000000,0x90800000,0x6dc00000,0x1e600000,0x34f00000,0xf6280000,0xebcc0000,0x3f720000,0x127d0000,0x62fa8000,0x5f2b4000,0x094fe000,0xd9b17000,0x2d948800,0x754d2400,0xb7a60a00,0x589a6700,0x49d3ea80,0x3c6a16c0,0xf7e7e260,0x33bd71b0,0xca868b18,0x92c02704,0x55f48bda,0x30bd2473 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0x88000000,0xd4000000,0x46000000,0xd9000000,0x81800000,0xd5400000,0xd0600000,0xc0f00000,0xe0380000,0xf3040000,0x02820000,0xffdb0000,0xabbd8000,0x15534000,0x70616000,0x90efd000,0xd83fb800,0xaf059400,0x90803a00,0x60cdd500,0xf33cd980,0x418147c0,0x755a03a0,0x806f0090,0xf8e780b8,0xbc3c42f4,0x6106e13e,0x9d939361 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x08000000,0xfc000000,0xae000000,0x11000000,0x24800000,0x8d400000,0x88600000,0x45f00000,0x68280000,0x870c0000,0x918e0000,0xd3d70000,0xd62c8000,0x5e1b4000,0x69106000,0x60977000,0x47451800,0xc3653400,0x22679a00,0x7ee97700,0xb7bb7a80,0xf5d54540,0xfb2602a0,0xf49b02b0,0x65428218,0xc47c41f4,0x73f4e20a,0x8d303181 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0x58000000,0xa4000000,0x02000000,0x39000000,0x93800000,0x41c00000,0x80a00000,0x3e300000,0xf6780000,0xca140000,0xd5020000,0x3d810000,0xb6d98000,0xd43fc000,0x7363e000,0x9f8d1000,0x9fd96800,0x4fa05c00,0xfea2ea00,0xe12e9d00,0x3ee08b80,0x11484dc0,0xdff802e0,0x66d40350,0xfc2200e8,0xef7102b4,0x09818326,0xfcdbc373 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0xd8000000,0xb4000000,0xda000000,0xa1000000,0xcd800000,0x69400000,0xae600000,0x7ef00000,0x8c380000,0x340c0000,0x9a1e0000,0x010d0000,0xdd8f8000,0xb156c000,0x1a79e000,0xa4e6d000,0x2d38b800,0xf98d5400,0xf3493a00,0xaf669500,0xa3675880,0x3d6a8540,0x2e6003e0,0x3ef00390,0x2c380288,0x240c0014,0x421e033e,0xb50d01f1 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0xc8000000,0x8c000000,0x5e000000,0xbf000000,0xa9800000,0x68400000,0xd7e00000,0x15700000,0xbea80000,0x041c0000,0xb21a0000,0xf11b0000,0x6e9e8000,0x85c34000,0x6dada000,0x23991000,0xbd57d800,0x7b76c400,0x09b35a00,0x819e8700,0x34487880,0x51e8d5c0,0x5e6003a0,0x0d3003f0,0x014800d8,0x2d6c020c,0x9ab200fe,0xc607016d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0xa8000000,0x04000000,0xba000000,0xfb000000,0xaf800000,0x36400000,0xdce00000,0x42700000,0xc8b80000,0x298c0000,0xcb420000,0xce7f0000,0xc6bb8000,0x609ac000,0x6bd4a000,0x45b7d000,0xd3175800,0xeb952400,0x2c56da00,0xd7fce500,0x45fbf880,0xfaeef6c0,0x4f638220,0x7226c2d0,0xa94ea2c8,0xd974d03c,0x7736daf6,0xe7cce725 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0x18000000,0x1c000000,0x96000000,0x9b000000,0x9c800000,0x34c00000,0x3d600000,0x94f00000,0xaba80000,0x60840000,0xd2c20000,0xde790000,0xa4668000,0x117a4000,0xdae62000,0x4ca03000,0xda176800,0x65102400,0x639bea00,0x92576700,0x1cb94b80,0xb20415c0,0x010683e0,0x598a41b0,0x874e23b8,0x072430dc,0x8c55684a,0x93a926cf },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x58000000,0x24000000,0xca000000,0xa1000000,0xe2800000,0xe4400000,0x85600000,0x44f00000,0x3f280000,0x62840000,0x245e0000,0xe56d0000,0x14f58000,0x673ec000,0x468de000,0xee4f3000,0x4479f800,0xf665f400,0x837a7a00,0xc3f23700,0xaabc1b80,0x7b5ec640,0x94f582e0,0xa73ec2d0,0x268de3c8,0xbe4f3354,0x1c79f9c2,0xd265f585 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x78000000,0xb4000000,0xfe000000,0x8d000000,0x51800000,0xb5c00000,0xc7a00000,0xd1300000,0x06780000,0xc8940000,0x2a460000,0xf7610000,0x9b0b8000,0x508e4000,0xce54e000,0x11665000,0xb2122800,0x871afc00,0x4287aa00,0x7951bd00,0x5be6cb80,0x174cad40,0xeeed8260,0x92df4390,0xb5276398,0xa07c10a4,0x8180cb5e,0xedddae33 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x08000000,0x84000000,0x7e000000,0x49000000,0x24800000,0x55400000,0xd3600000,0x64f00000,0xf2280000,0x01840000,0x3bda0000,0xd9230000,0x2e0f8000,0x91064000,0xb89a6000,0xd74c7000,0x68661800,0xf374d400,0xb4fb9a00,0xea259700,0xfd9c7b80,0xc9c8a6c0,0x6a3583a0,0x3d9540d0,0xa9dde058,0x1a3e32f4,0x358e794a,0x2ddfa661 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x78000000,0x9c000000,0x6a000000,0xeb000000,0x26800000,0x18c00000,0x76a00000,0x15300000,0x26680000,0x379c0000,0xcd560000,0xa4e10000,0xb9568000,0x4ae9c000,0xd447a000,0x4576f000,0xe511a800,0xfb989c00,0x1f592a00,0x73fc5f00,0x25d60880,0xc12e6c40,0x18688160,0x2294c230,0x5ec722c8,0xffbe329c,0xeca088d2,0x9637adbf },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0xf8000000,0x44000000,0xc2000000,0x0d000000,0x6b800000,0x4b400000,0xf0e00000,0x9bb00000,0xfb580000,0x38fc0000,0x57be0000,0x555d0000,0x4beb8000,0xb72ec000,0xba84e000,0x96c75000,0xfcbad800,0x61db9400,0x3e3e3a00,0xf31cc500,0xa084e080,0x4fc75240,0x0d3ad960,0xb39b9650,0x9f5e3ae8,0x6aecc424,0x02bce226,0xaacb5359 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0x08000000,0x94000000,0xb6000000,0x5d000000,0xdc800000,0x3ec00000,0x8d600000,0xcbb00000,0x8ad80000,0x8b740000,0x6eae0000,0xda5b0000,0x9fa78000,0x9cca4000,0x26766000,0xaa2fb000,0x78820800,0x30de1400,0xbc746a00,0x2d31a500,0xc3166180,0xa59fb140,0xac5a0ba0,0x62aa1610,0xb05a68f8,0x00aaa624,0xbb51e02a,0x9125f0cf },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x90000000,0xc8000000,0x14000000,0xd2000000,0x45000000,0x28800000,0xebc00000,0xb6600000,0xc9b00000,0x6dc80000,0x01640000,0xd43e0000,0xf6830000,0x80df8000,0x6df6c000,0xc5e9e000,0x81fe3000,0x7bf4a800,0xbaff5400,0x887d4a00,0x32b16700,0x7e41e180,0x192a3140,0xea02a8a0,0xc9185610,0xc69cca68,0xf8c4a644,0xc1f7826a,0x5be2c3fb },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0xf8000000,0xac000000,0x1a000000,0xd1000000,0x0d800000,0xfe400000,0x3ea00000,0xccf00000,0x78480000,0xcda40000,0x5c7a0000,0x21810000,0x244e8000,0x0fbcc000,0x71606000,0x7e191000,0x5f0cb800,0x8a8b7c00,0x88ccda00,0xe4626f00,0xad886180,0x6e4d11c0,0x96beb860,0x28ee7c70,0x36585988,0xaaafaef4,0x9aee81de,0x034cc17d },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x08000000,0x84000000,0x3e000000,0xe9000000,0x50800000,0x7ec00000,0x30600000,0xfab00000,0x5cd80000,0xdb740000,0x11320000,0xd1870000,0x1a458000,0x98b54000,0x57d5e000,0xc0eeb000,0x947e8800,0x94b53400,0xadcb6a00,0xf7eb8500,0xddede180,0xb2eab2c0,0x67748ba0,0x033635d0,0x9284ead8,0x65ddc4b4,0xd3f7803a,0xf3f2409f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x28000000,0xd4000000,0x42000000,0xb1000000,0xfb800000,0x9cc00000,0xf0e00000,0xd0300000,0x16c80000,0x05f40000,0x21b60000,0xbf070000,0x648b8000,0x0854c000,0xe0b16000,0x9c86d000,0x34462800,0x16bfe400,0x3f974a00,0x56c93700,0xa5f96380,0x11b2d240,0xc7102920,0x9888e610,0x9e54cba8,0x13a9f694,0xd61e0166,0x530302f7 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0x38000000,0xf4000000,0xee000000,0x1f000000,0xe4800000,0x39400000,0xea600000,0x2f300000,0xa7580000,0x6d740000,0x6fba0000,0xf8090000,0x540d8000,0xbe094000,0x970f2000,0x2886f000,0x2358f800,0x1b644400,0xd4b7da00,0x7a92b500,0xbe572180,0xaaf2f3c0,0x7062fb60,0x9e2d4510,0xbcda5958,0x00abf6ac,0x848001aa,0xc9400359 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0x98000000,0x14000000,0x6a000000,0xc9000000,0x4e800000,0xdd400000,0x84200000,0x53700000,0x0e580000,0xdbbc0000,0x74ba0000,0xcd350000,0x5dfd8000,0x731dc000,0xaf856000,0xbfcb7000,0xd770b800,0xec5ecc00,0xceadda00,0x2c29bd00,0x3f676080,0x204272c0,0x10b738e0,0x7f360f90,0x20f539c8,0xa78f0e74,0x23cab812,0x616bce91 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x90000000,0x08000000,0x8c000000,0x66000000,0x71000000,0x7c800000,0x6a400000,0x7e200000,0xa2700000,0x85480000,0xa7a40000,0xb6be0000,0x9a3b0000,0x18648000,0x7a5b4000,0xb635e000,0xce6f3000,0x73449800,0xdeb4ec00,0x46397a00,0x967fdf00,0x1743e180,0xa4b03140,0x593e1ba0,0x17e4ac70,0x67801bb8,0xc1dfacf4,0xf9e499ea,0x5a84ed2d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0xa8000000,0xd4000000,0x4a000000,0x9b000000,0x3b800000,0x56400000,0x4ee00000,0xdab00000,0x6b480000,0xc86c0000,0xca6a0000,0x95730000,0x9cf38000,0x5da1c000,0x1edd2000,0x97399000,0x58017800,0xbc00b400,0x3e145a00,0xa1152700,0x089f2080,0xb9d692c0,0x52b0f820,0x0f4e7690,0x8a78f988,0xf562763c,0x4cf2f946,0x85a175f5 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0x78000000,0x7c000000,0xda000000,0x45000000,0xfb800000,0x94c00000,0xeae00000,0x4c300000,0xf7c80000,0x4e6c0000,0xc66a0000,0x02690000,0x047c8000,0xeb66c000,0x2deee000,0x3ea55000,0x9a842800,0x795ea400,0x3922ca00,0x1457f700,0x76ace080,0xfe9052c0,0x0f5aab60,0xae3d6430,0xaedaa888,0xbffd67e4,0x1fbaa806,0x170d6587 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x10000000,0xc8000000,0x8c000000,0x82000000,0x83000000,0xc9800000,0xb0400000,0x3ee00000,0xc8b00000,0xbb480000,0xdb740000,0x8afe0000,0xdeb30000,0x9e4c8000,0x8ff7c000,0x3a272000,0x968bd000,0x93c3f800,0xf1ae7400,0x65ccda00,0x04a1a700,0x99592380,0x2878d340,0x9b6f7aa0,0x2ae9b670,0xaea3fb28,0x465e773c,0xcbe4daae,0x3425a78d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x98000000,0x84000000,0x16000000,0x99000000,0x16800000,0x9e400000,0x3e600000,0x9a300000,0x17480000,0x00e40000,0xf8620000,0xcb350000,0x8dd78000,0xe4b84000,0x5500e000,0x4c847000,0x9d4c5800,0xcbfb6400,0x81e4ba00,0xaaeb1700,0xa362e180,0x5ab172c0,0xf01bd9e0,0x580327d0,0x64045838,0x661f6774,0x0106b982,0x929e16dd },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0x58000000,0x0c000000,0x3a000000,0x5d000000,0xf3800000,0x08400000,0x57e00000,0x81b00000,0x75480000,0x54740000,0xe1f60000,0x26a90000,0xbbce8000,0xffb8c000,0xe651e000,0xfced5000,0x752eb800,0x83849400,0xa0575a00,0x33edc700,0xbfa7e380,0x46445240,0xcce038e0,0x7d3c5570,0xd786bb88,0x96409644,0x54e958a6,0x1130c715 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0xa8000000,0xd4000000,0xd6000000,0xb3000000,0xc1800000,0xe7c00000,0xdba00000,0x0f700000,0x55580000,0xdde40000,0xa3020000,0xd9830000,0xfbc38000,0x29be4000,0xc269a000,0xf3ccd000,0x2dba0800,0x2c73ec00,0xccd1aa00,0x463c3d00,0x7aa82380,0xb3f192c0,0xdc102b20,0xd2017c90,0x5d0203f8,0xfe83009c,0x8c4381de,0x8d7e4293 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0xa8000000,0xb4000000,0x66000000,0x93000000,0x57800000,0x4f400000,0x2d200000,0x99700000,0x77d80000,0xd7e40000,0xc6120000,0xc3130000,0xef8f8000,0x23544000,0x572ba000,0xd87e1000,0xd557d800,0x5c3a2c00,0xf3ee7a00,0x38173d00,0x2c162380,0x1a0950c0,0x310bfb20,0x0a847f10,0x3fd80138,0x53e4019c,0x68120146,0x941302b1 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0x38000000,0x34000000,0x1e000000,0xf3000000,0x86800000,0xc6c00000,0xf5a00000,0x68700000,0x07580000,0xebec0000,0x881a0000,0x6c010000,0x7a058000,0xa50b4000,0x799aa000,0x6a483000,0xde6bc800,0xe8480c00,0x2f6b6a00,0xdfc13d00,0xfe252280,0x8b3270c0,0xfaace860,0xbce77d10,0x38800298,0x05c0021c,0x6b2002e2,0xeab00117 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x98000000,0x84000000,0x72000000,0x73000000,0xdd800000,0x86400000,0x4e600000,0xff300000,0x3ed80000,0x04a40000,0x61960000,0x00510000,0xe76f8000,0x1da4c000,0x0b0b2000,0x49815000,0x0c433800,0xe96e6400,0xc8be1a00,0x4f8e3500,0xe54aa380,0x6be09040,0xad699be0,0x9abef750,0x0c8f81a8,0xf0d4c2dc,0xf1b3233e,0x15155295 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x18000000,0x9c000000,0x32000000,0x3d000000,0x5c800000,0xb3400000,0x83200000,0x59700000,0x90c80000,0x19f40000,0xd18e0000,0xc7c90000,0x447c8000,0xfc57c000,0x42bae000,0x46a3b000,0x28a1b800,0x47a6ac00,0xb6355a00,0x41fc1f00,0xed806380,0x05c97140,0xf169d9e0,0x24dbdc30,0x5ff282a8,0xca9ec184,0x1046603a,0x38b47079 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x38000000,0x94000000,0xd6000000,0x99000000,0x03800000,0x43400000,0xc5a00000,0x59f00000,0x2ec80000,0x4be40000,0xa9ca0000,0x9d790000,0x9b198000,0x6c964000,0x09d2e000,0x8d67d000,0x7305d800,0xf0897c00,0x73d53a00,0x5673af00,0x3f836180,0x295593c0,0xf6bd3b60,0x8967ae90,0x8d0161b8,0x15889334,0x3a4eb8d6,0xf638efa9 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x38000000,0xa4000000,0xb6000000,0x29000000,0x48800000,0x7a400000,0x9ba00000,0x16f00000,0x00d80000,0xeef40000,0x04ca0000,0x88e90000,0x25df8000,0x5c6c4000,0x4d98e000,0x58d6b000,0x3aeb9800,0x6adb9c00,0x35e17a00,0xe3502d00,0xab3f6180,0x28bef1c0,0x1d617b60,0xe9102e50,0xe89f6038,0xaa4ef334,0x93b9787a,0x8ae42d8d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x38000000,0x1c000000,0xd2000000,0x51000000,0xc9800000,0x65c00000,0x23600000,0x21b00000,0xb4580000,0x8abc0000,0x48d60000,0x48fd0000,0x1d608000,0xeab3c000,0x38db6000,0x40fe9000,0xa97ec800,0x1cac7400,0xa7cbaa00,0x0a63e500,0x543be080,0x938d5340,0xc0c5aa60,0xbce2e630,0x4b6d61a8,0xe5b39034,0x4a464aee,0xa1a3b693 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x90000000,0xd8000000,0xdc000000,0x3a000000,0x4d000000,0x60800000,0xf0c00000,0x76a00000,0xe5700000,0xc0580000,0xfe740000,0x3fde0000,0x57210000,0x772c8000,0x4736c000,0xef31e000,0x7b283000,0x45384800,0xee2fec00,0xf9afaa00,0x24e2dd00,0xc21d6180,0xa11ef340,0xf289a8e0,0x29c7dd30,0x2837e188,0xbebd3344,0xa16acaea,0xc6482cb7 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x30000000,0xc8000000,0xcc000000,0xd6000000,0x3f000000,0xc9800000,0xe5400000,0x65e00000,0xb9300000,0x11980000,0x915c0000,0x17f20000,0xac2f0000,0xf9188000,0x4e9f4000,0x88cf2000,0xaaa1d000,0xfdd51800,0x923b5400,0x7a02ba00,0x3905c500,0xae988080,0x18df41c0,0x52af21a0,0xf9d1d3f0,0x882d1878,0x931757cc,0xcf88ba7e,0x8246c669 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x38000000,0xf4000000,0x26000000,0x33000000,0xe4800000,0x95c00000,0x42e00000,0xbbb00000,0xe0980000,0x2bd40000,0x55fa0000,0x71310000,0x8a418000,0x5fae4000,0x6e88a000,0x04d3f000,0x6b6ba800,0x3df6a400,0xcd228a00,0x804b1500,0x8ea18180,0xa71e41c0,0xb290a360,0x7ec7f310,0x6271a878,0x3077a71c,0x657b090a,0x52f1579b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0xb8000000,0xcc000000,0xd2000000,0x99000000,0x77800000,0x35c00000,0xe6e00000,0x50b00000,0x5d880000,0x40c40000,0xb37e0000,0x54650000,0xb8e68000,0x3bb7c000,0x431f6000,0xaa8cd000,0x1458c800,0xfc2ca400,0xfec12a00,0xc867b700,0xf2ee8180,0x9eb3c340,0x4e816160,0x7259d370,0x9b3649a8,0xd25f6554,0xab204896,0x9a4e65b3 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0xd8000000,0x5c000000,0x9e000000,0x31000000,0xf7800000,0x0b400000,0xf1e00000,0x29300000,0x61980000,0xfe440000,0xa4660000,0xdd610000,0x8ee88000,0x77ac4000,0xa14be000,0xcaedd000,0x95b91800,0x3e4e1400,0x847a7a00,0xed7f8500,0x06f08380,0xf3a84040,0x634de2e0,0x65fcd030,0x53299918,0xc29655b4,0x7ecf9ba6,0x35b755e9 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x58000000,0xbc000000,0x6e000000,0x85000000,0xf7800000,0xf9c00000,0xb6a00000,0x9ef00000,0x40980000,0x354c0000,0xf5f20000,0x720d0000,0x1b148000,0x0a9e4000,0x024b6000,0x79655000,0x11464800,0x47ec2c00,0x0901aa00,0x819b3d00,0xe0de8280,0x9f2f43c0,0xba35e1e0,0xbdba1030,0x3c6ba8d8,0x86da3ce4,0x2e380066,0x57bc00f3 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0xd8000000,0xcc000000,0xba000000,0x11000000,0xb1800000,0xbec00000,0xd1600000,0x98300000,0xa4980000,0x11440000,0xb0b20000,0x6fd50000,0x40ea8000,0xb6f2c000,0x5df36000,0x9d7b1000,0x62326800,0xd58bb400,0x50d38a00,0xd6766500,0x72b88380,0x62d7c2c0,0x0361e2e0,0xfd3dd0f0,0x930b0988,0xdc91a774,0x0d41622e,0x42ae13bf },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0x08000000,0x0c000000,0x9e000000,0x77000000,0xf9800000,0x04400000,0x7c600000,0x83b00000,0xea880000,0xbfdc0000,0x89220000,0x45570000,0x0ef88000,0xc8664000,0xd9b32000,0x2f9cd000,0x9f443800,0x0bffc400,0xc8e79a00,0x6b695700,0xaa3a8280,0xf6c143c0,0xf7a3a0a0,0x909690f0,0x4add1a58,0xa1a815ec,0xcb99239e,0x1d57d2cd },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0x78000000,0xac000000,0x5a000000,0x11000000,0x53800000,0xf3400000,0x63e00000,0xed300000,0xca980000,0x04cc0000,0x2ea60000,0x01dd0000,0xeb328000,0x898ac000,0xa2436000,0x10635000,0x0e739800,0xd16e5400,0x45fa7a00,0xbe3bc500,0x14148280,0x9617c140,0x7b11e160,0x2a9992f0,0x74c8f888,0x66b106f4,0xc5d7e226,0x65349289 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xd8000000,0xc4000000,0xb2000000,0x1d000000,0xf1800000,0xe4400000,0xfce00000,0x34300000,0xbd180000,0x818c0000,0x1c420000,0x08fd0000,0x5e338000,0x6416c000,0xc219e000,0xe51f9000,0x059fb800,0x8e409400,0x25f7da00,0x77b4c500,0x44420280,0x8cfd01c0,0xcc3383e0,0x4916c3d0,0xeb99e1a8,0xc55f9364,0x4b7fb90e,0xa77097e5 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0x28000000,0x2c000000,0x96000000,0x07000000,0x14800000,0xd4c00000,0x4c600000,0x23300000,0xc3180000,0x8e840000,0x15ca0000,0x47e30000,0xe7708000,0xe1af4000,0x70c62000,0xe6607000,0xca270800,0xe48d9400,0xdcdbaa00,0x3061a500,0xad2a0380,0xc01301c0,0x20088120,0x501b4070,0x181422f8,0x040770ac,0xba1d8a0a,0x9101d74f },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0x38000000,0xe4000000,0x4e000000,0x7b000000,0x80800000,0x46c00000,0x3f600000,0xda300000,0x17080000,0xd29c0000,0xb7c20000,0xbae10000,0x5f6b8000,0x0a3d4000,0x3f0aa000,0x3e857000,0x25ddc800,0x6bf2b400,0xeafeea00,0xb76b8700,0xc6220280,0x9d1103c0,0xd7838060,0x74514350,0x98a0a1d8,0x68c8727c,0x947c4b3a,0x72b2f4f7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0xd8000000,0x5c000000,0xe2000000,0xe5000000,0x5d800000,0x4ac00000,0x10a00000,0xcaf00000,0xe9080000,0x17940000,0x4bda0000,0x432d0000,0x5f208000,0x1d3fc000,0x2824e000,0x1da51000,0xd36be800,0x7dc9cc00,0xb0358a00,0xe1be1f00,0xe17a0380,0xf0dd01c0,0x69a882e0,0x156bc3b0,0xf6dee0e8,0x82b812e4,0x97e36afe,0x58920ebf },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0x48000000,0xfc000000,0xca000000,0x4d000000,0xe1800000,0x2a400000,0x2a200000,0xf0f00000,0x2b180000,0x6e840000,0x1ad60000,0xfbf30000,0xf5868000,0xec4ec000,0x553ce000,0x387f9000,0x9ec87800,0x15fb8c00,0xa6841a00,0xa6c9dd00,0x51ee0380,0x68870240,0x45c880a0,0x8379c0b0,0xd84c6208,0x233252c4,0xdf6a18ae,0xe24edd9d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x18000000,0xec000000,0x5a000000,0xc3000000,0x72800000,0x67c00000,0x33200000,0x59700000,0xcd080000,0x17840000,0x445a0000,0x21650000,0xd10e8000,0xb58ec000,0x5b4f2000,0x11f03000,0x99d1a800,0xae2f1c00,0xa6ea0a00,0x9d44ef00,0xb0f20180,0x145103c0,0xc97c83e0,0xc51fc370,0x3393a108,0xda5ff0bc,0x4c6a08a2,0xd684ee93 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0x58000000,0x4c000000,0x8e000000,0x5d000000,0x15800000,0xd6400000,0x2e200000,0x84f00000,0x5b080000,0x0c8c0000,0xc9d20000,0x0f6d0000,0x78528000,0x83204000,0x697e6000,0xf1471000,0xf4bf7800,0x5c348c00,0xcfe19a00,0xff8edf00,0x715a0080,0x34a103c0,0xfc2083e0,0xfffd41f0,0xa784e358,0x3d5b5044,0xbabb1a6e,0xa1229e2d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x90000000,0x98000000,0x84000000,0xe6000000,0x13000000,0x78800000,0xafc00000,0x1ee00000,0xccb00000,0xde080000,0x27040000,0x768e0000,0x30c10000,0x9c638000,0x127c4000,0x4d76a000,0x2ff97000,0x613ce800,0x6a432400,0xe6afca00,0x17031700,0x5e880180,0x5cc40140,0xf66e01e0,0xfb710050,0x44eb81f8,0x0db8425c,0xbb98a27a,0x6f4872f3 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0x28000000,0x8c000000,0x2a000000,0x9b000000,0xe7800000,0xfb400000,0x86200000,0x43f00000,0xae080000,0x4d0c0000,0xde820000,0xbbd30000,0x98f48000,0x2984c000,0xa64e2000,0xc0bb9000,0x5c259800,0x90e2ac00,0xd5953a00,0x0442ff00,0x67a80080,0xb9bc01c0,0x7caa0220,0x9e2f00f0,0x27fe8008,0xa81bc05c,0x4c18a336,0x8a1c5181 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0xc8000000,0x3c000000,0xda000000,0x53000000,0x2e800000,0x11400000,0x94a00000,0x7e700000,0xac080000,0x02040000,0x771a0000,0x309f0000,0x6c5e8000,0x0f3cc000,0xc8a12000,0x5467b000,0xd713f800,0x2092bc00,0x745e5a00,0xcb22cf00,0xe6a00180,0xe17003c0,0x708800a0,0x4c440030,0xdf3a0048,0x30af01bc,0xa07683d2,0x3108c109 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0x28000000,0x54000000,0xba000000,0x85000000,0x43800000,0x29c00000,0x70e00000,0x81b00000,0x4c080000,0xa60c0000,0xbb1a0000,0x248b0000,0x934f8000,0xf4bdc000,0xe797e000,0x7bc0d000,0x01f94800,0x08352400,0xc8d32a00,0xc17f3700,0xa9600080,0x9d7002c0,0xf7680220,0x2a7c0090,0x15f20248,0xd2370344,0x9ddd83e6,0xdafac2b3 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x18000000,0xec000000,0xf2000000,0xa1000000,0x8e800000,0xcbc00000,0xdd200000,0xe7900000,0x2a080000,0xed040000,0xec8e0000,0x02c70000,0xa7a18000,0x325ec000,0xa4272000,0x251e1000,0x83cee800,0xf92fbc00,0x71925200,0xfd0fb900,0xc4880080,0x16c40040,0xc9ae00e0,0x79570070,0x67a98018,0x925ac0ec,0x342920f2,0x4d1910a1 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0x18000000,0xbc000000,0xce000000,0xab000000,0xbe800000,0x98400000,0x17200000,0x17500000,0xe2080000,0xbd0c0000,0x89820000,0xf8c10000,0x3c618000,0x02fbc000,0xa314e000,0xe32eb000,0x9d55e800,0x0b028400,0x6e8df200,0xa0493500,0xbb280080,0xc15c00c0,0xf50a0020,0xcd8d0010,0xbac38018,0x516ac0bc,0xb37d60ce,0xf7d970ab },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xb8000000,0x84000000,0xd6000000,0x83000000,0xdc800000,0x6f400000,0x56200000,0x80b00000,0x5a080000,0xc90c0000,0x9d860000,0xaecf0000,0x5aeb8000,0x37584000,0xb6d56000,0x1a1c3000,0x3dffc800,0x992bf400,0x763be200,0x844acb00,0xe6a80080,0x95fc00c0,0x952e0060,0xfc3300f0,0xa54580b8,0xd72b4084,0x2130e0d6,0xa6c77083 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0x38000000,0xd4000000,0xca000000,0xa7000000,0xd9800000,0xc8c00000,0x9ce00000,0xec500000,0x76080000,0xf10c0000,0x38860000,0x184b0000,0xd8a38000,0x12fd4000,0xddf4a000,0x987e7000,0x16bf9800,0x83558c00,0xe3834e00,0xf7c10500,0x41680080,0x669c00c0,0xa1ee0060,0xdad700b0,0xeb4d8038,0x0b2a40d4,0x1d3920ca,0x289430a7 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x78000000,0xec000000,0x52000000,0x13000000,0x43800000,0xd0c00000,0x9de00000,0x1f900000,0x5b080000,0x97840000,0xceca0000,0x6ceb0000,0x37178000,0x2446c000,0x88a12000,0x5fbb3000,0x6bf73800,0x2b568c00,0xe0e11e00,0x3511d900,0x5f4a0080,0xef2b0040,0x497780a0,0x5b16c0b0,0x36492078,0x3baf30ec,0xac353852,0xc3398c13 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0xa8000000,0xc4000000,0x2e000000,0xdb000000,0x3f800000,0xf0400000,0x85200000,0x18100000,0xdd080000,0x60840000,0x01ce0000,0x1e6b0000,0x0aba8000,0xf1544000,0x16aee000,0xa257b000,0xfd2ef800,0x841a8400,0x7f089200,0xe1802100,0x63460080,0xceaf0040,0x6e5480e0,0x472f40b0,0x691c60a8,0xf787f0c4,0xc44e182e,0xe32634db },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0x38000000,0xbc000000,0xea000000,0xd9000000,0x16800000,0xb6c00000,0xcce00000,0x2dd00000,0x3f080000,0x7d8c0000,0x954a0000,0x4eaf0000,0x0af38000,0x9eb3c000,0xea9aa000,0xd4a39000,0x2bf86800,0x9435ec00,0x465f8e00,0xf94a3d00,0xaca20080,0xf7f300c0,0x2e3180a0,0x5750c0f0,0x6bc32038,0x4c6f50bc,0x081948ea,0xcc69bcd9 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0xd8000000,0xe4000000,0xb6000000,0x57000000,0x28800000,0x08c00000,0x9ea00000,0x3ef00000,0x08880000,0x18c40000,0x16ae0000,0xb2fb0000,0x82858000,0x1dca4000,0xdf256000,0xc5be7000,0x3c670800,0xb55acc00,0x77f48a00,0xeb019f00,0x3a858080,0x09ca4040,0x512560e0,0xc6be70b0,0x7ae708d8,0x0e9acce4,0x77d48ab6,0x8a319f57 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x78000000,0x94000000,0x6a000000,0xdb000000,0x60800000,0xea400000,0xed600000,0xe9500000,0x08880000,0x96440000,0xbb660000,0x045b0000,0x350f8000,0x398d4000,0x6dc0a000,0x51a6b000,0xb3718800,0x493fe400,0x4c547600,0x99092500,0xa78f8080,0x6ccd4040,0x9220a060,0xadb6b0b0,0x24198878,0x936be494,0x185a766a,0xd30625db },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0x68000000,0x2c000000,0x36000000,0x13000000,0x63800000,0x62400000,0x78a00000,0x89300000,0x0f880000,0x344c0000,0xfbaa0000,0xb2b30000,0x29ce8000,0x56eec000,0x57996000,0xcdba3000,0x1c44b800,0xb7a2e400,0x14bdea00,0x62c42300,0x716e8080,0x2fdec0c0,0x901160a0,0xe5f63030,0xb9eeb868,0x3a11e42c,0x68f36a36,0x456ae313 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0x28000000,0x04000000,0x4a000000,0xad000000,0xce800000,0xffc00000,0x45200000,0x19900000,0x92880000,0x79cc0000,0xb6220000,0x28130000,0x22ca8000,0x43ac4000,0xf256a000,0x85a1d000,0xe1526800,0xa425bc00,0x491ff200,0xb243c900,0x436a8080,0xf8fc40c0,0xe37ea020,0x2e3dd030,0xe2d86828,0x456abc04,0xcbff724a,0xf2f089ad },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0x78000000,0x74000000,0xf6000000,0x5f000000,0x7f800000,0x5d400000,0xe0e00000,0xf0100000,0x99880000,0xea4c0000,0xc3620000,0x27570000,0xdc6f8000,0xb8db4000,0xd1256000,0x503ef000,0x2d3a7800,0x4bb19400,0x6e70ee00,0xa85cb100,0x6be78080,0xc99740c0,0xc3c76020,0x7129f070,0xe035f878,0x753ad474,0x4fbd8ef6,0xe07e415f },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0xa8000000,0xe4000000,0x66000000,0x11000000,0xff800000,0x30c00000,0x90a00000,0x72700000,0xd1880000,0x75cc0000,0xd12a0000,0xcfbd0000,0x94a28000,0xa4724000,0x18846000,0x16401000,0xcbef7800,0xcc104c00,0x6e5dea00,0xabbc7700,0x32aa8080,0x157e40c0,0x370e60a0,0x8e8d10d0,0xbf45f8a8,0xd86e0ce4,0xaed38a66,0x21f16711 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xe8000000,0x4c000000,0x0e000000,0x49000000,0x93800000,0x81c00000,0x49600000,0xdc300000,0x51880000,0x86c40000,0xb3e20000,0x3e7f0000,0x71268000,0x5f90c000,0x305ae000,0xa0379000,0xd789b800,0x53c5dc00,0x3667f600,0x52bc1300,0xe9ce8080,0x4564c040,0xf230e020,0xe88c90f0,0xfd4d38e8,0x7e2a1c4c,0x791b960e,0xe41b4349 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0x68000000,0x8c000000,0xe6000000,0xbf000000,0x3d800000,0x85c00000,0x59a00000,0x67d00000,0x47880000,0x54c40000,0x272a0000,0x819d0000,0xc0ee8000,0x3d3cc000,0xdbbc6000,0x49faf000,0x6c935800,0x006b9c00,0xf07e7a00,0xb35ccd00,0x18c68080,0x2128c040,0x4e9e60a0,0x4563f0d0,0x5cf7d868,0xe81a5c8c,0x77249ae6,0xa99efdbf },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xb8000000,0x54000000,0x5e000000,0xfb000000,0xbd800000,0xe6400000,0x8be00000,0x12900000,0xa6880000,0xcbcc0000,0xb5a60000,0x9d750000,0x52138000,0xc2414000,0x9defe000,0x359cb000,0xf90d5800,0x648ca400,0x72ce1e00,0x712e7900,0xdfb58080,0xcb3440c0,0xf1fc6060,0x5cddf050,0x6162b8b8,0xe3501454,0x5e23465e,0xfc32ddfb },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0xe8000000,0xd4000000,0xf2000000,0xc9000000,0x43800000,0x30400000,0x41600000,0xb7f00000,0xf6880000,0xf5cc0000,0xba260000,0x04190000,0x0eb68000,0x54694000,0x82752000,0x75cb9000,0x7a2fb800,0x6416c400,0x9eb77600,0xbc624f00,0x56708080,0x87c040c0,0xb32ba060,0x279ed090,0xaef498e8,0xfd0854d4,0xe1884ef2,0x7144cbc9 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0xe8000000,0xb4000000,0xfa000000,0x09000000,0x31800000,0xd8c00000,0x35200000,0x25900000,0xda880000,0xfc440000,0xb2620000,0x4b770000,0x1ab68000,0x5e174000,0x8341a000,0x1ce19000,0x2d389800,0xf1d74c00,0xbce53200,0x1d302900,0x39dc8080,0x78e44040,0x0f352020,0x84d1d070,0xb367b8e8,0xdef59cb4,0x80760afa,0x4e35f509 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x68000000,0x3c000000,0x86000000,0xb5000000,0x36800000,0x49400000,0xa3200000,0xc0700000,0x9d880000,0xeecc0000,0xbee20000,0xdd190000,0xaf5e8000,0xc3f7c000,0x224e6000,0x24ac5000,0x4dbee800,0xe8e0d400,0xe01b1200,0x15d6f700,0xf4b48080,0x6062c0c0,0x6852e020,0xaa729090,0x26860868,0xe147443c,0xbf219a86,0xd67f73b5 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x28000000,0x8c000000,0x1e000000,0xd1000000,0x98800000,0x15c00000,0x5fe00000,0xaeb00000,0x65c80000,0x27ec0000,0x6ab60000,0x67c10000,0xc0ee8000,0xaf3ec000,0xf480e000,0x5bc39000,0xc6e74800,0x2a39bc00,0x46026e00,0x2507a300,0x4280e080,0xc6c390c0,0x20674860,0x7ef9bc90,0xa9626e28,0x1277a38c,0x66a8e09e,0x9e9f9011 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0xd8000000,0xe4000000,0xe2000000,0x7b000000,0x59800000,0xa0c00000,0x12a00000,0x20b00000,0xbcc80000,0x04ac0000,0xb1b60000,0x12430000,0x23e18000,0x7ed84000,0xe0dd2000,0x3dde3000,0x2d59d800,0xc71d2c00,0x10f21a00,0x842d5300,0x93fd2080,0x29ae30c0,0xd931d860,0xcc012cb0,0x7e0c1ad8,0xad0253e4,0xa88aa062,0xbe4570bb },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0x58000000,0x44000000,0x86000000,0xdf000000,0x1f800000,0xa4400000,0x29e00000,0xced00000,0xa8480000,0x03e40000,0xebd60000,0x5ac70000,0xb9218000,0xe2f24000,0x803f6000,0x8d147000,0xb1efb800,0xaadf2400,0xbe4bee00,0x74e7d500,0xe85f6080,0x3c847040,0xc9c7b860,0xecab24f0,0x93b5ee58,0x0354d544,0xbd00e006,0x9685309f },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x90000000,0xc8000000,0x74000000,0xda000000,0x9f000000,0x13800000,0x80400000,0x47600000,0x6e100000,0xce480000,0xf2640000,0x9a920000,0x71810000,0x53488000,0x82e54000,0x8754a000,0x63ad7000,0x3eb27800,0xc57fa400,0xa6588600,0xbd255900,0x667ca080,0x5bd97040,0x58687820,0x3d9aa490,0x6e0206c8,0x25011974,0x3c80805a,0xcbc140df },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x28000000,0xfc000000,0x96000000,0x13000000,0xe3800000,0x96400000,0x0f600000,0x2b300000,0x14480000,0x56640000,0x3db60000,0x4a890000,0xf8c68000,0xe5a9c000,0xff986000,0x615bb000,0xeffdf800,0x47ea0400,0xcaf2c600,0x87610b00,0xe7306080,0xda4fb040,0x8163f860,0x9c370410,0xa5ca4628,0x9125cbfc,0xa8588016,0x9174c053 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xa8000000,0x14000000,0x5a000000,0xa9000000,0xbc800000,0x80400000,0xf3e00000,0xa0500000,0xb6480000,0xece40000,0x43d20000,0xf58b0000,0x6cce8000,0xcba34000,0xdfb6a000,0xf0181000,0xbda68800,0xe0bba400,0x239cae00,0x56644d00,0x749ea080,0xf1ec1040,0xd55c8820,0x54c4a430,0x07a82ea8,0x19b80d14,0x271c80da,0x5a2840e9 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x18000000,0x84000000,0xee000000,0x45000000,0x7e800000,0xe2c00000,0x64a00000,0x5a900000,0x0bc80000,0x28240000,0xf7560000,0x0ae30000,0xb3f58000,0x80764000,0x1039e000,0x345fd000,0x8d6ea800,0x95b84c00,0x051eda00,0x89826100,0x934fe080,0x83ecd040,0x4f732860,0x35ba0cb0,0x95193a18,0x418ab184,0xbf4ac86e,0xf1e5dc05 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xd0000000,0xf8000000,0x3c000000,0x22000000,0x07000000,0xf9800000,0x0f400000,0x55e00000,0x74b00000,0xaa480000,0xeb640000,0x227a0000,0x20e50000,0x323b8000,0xc081c000,0x43cb2000,0xfc25f000,0x3b915800,0x5e555400,0x5b7aee00,0xcc6cf300,0x4bf92080,0x77a4f040,0x8bd0d8a0,0x6e3194d0,0xd28a4ef8,0xccc8c33c,0x11a358a2,0xd2d45447 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x88000000,0x84000000,0x92000000,0x4d000000,0x95800000,0x3cc00000,0x50200000,0x92900000,0x13c80000,0x20ac0000,0xefde0000,0xd5230000,0xa3148000,0xed0e4000,0x058e2000,0xe4c25000,0xec2a1800,0x0c926c00,0x48c19200,0x6a255100,0x0b982080,0x2c4d50c0,0x5d6098e0,0x3c7f2cb0,0xa47b3288,0x38794184,0xf6741812,0x95716c8d },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xb0000000,0x48000000,0x8c000000,0x3e000000,0xeb000000,0xb3800000,0xa1c00000,0x2f600000,0x48900000,0x82480000,0xd6a40000,0xf3fe0000,0x80d30000,0x45e88000,0xcfd2c000,0xb46ee000,0x13153000,0xff817800,0x3fce3c00,0x94652600,0x0312c100,0xe7866080,0x4bc7f040,0x6e6f98e0,0x5a1b0cb0,0x81045e48,0xb28cfd8c,0x534b46be,0x9c2131ab },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xf8000000,0x64000000,0x0a000000,0x43000000,0x10800000,0x0b400000,0x36a00000,0xfe300000,0xf3c80000,0x91ec0000,0x3e960000,0xd0f70000,0xc3ab8000,0x93bc4000,0xc901a000,0x9388b000,0x7bcec800,0xcde95400,0x30987a00,0x69f49b00,0x682a2080,0xec74f0c0,0xfeef6860,0x1811e4f0,0x66beb2f8,0xa481cf64,0xa94c5a8a,0x79ab6b83 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x38000000,0x44000000,0x4a000000,0x57000000,0xa6800000,0x3f400000,0xbda00000,0xb6900000,0x5dc80000,0x88e40000,0x3c360000,0xfdd30000,0xd26f8000,0x4d764000,0x3d71a000,0x2571f000,0xb177a800,0x73721400,0x58788a00,0xf0f2b100,0xd2be2080,0x9e97b040,0xb1ce0860,0x6ee7e4b0,0xed392238,0x3a53a544,0x12a92aca,0x74134117 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x38000000,0x3c000000,0xd6000000,0xbd000000,0x4c800000,0xc0400000,0xbe200000,0xd6300000,0xf8c80000,0xec640000,0xdf1e0000,0xf9770000,0x1d6f8000,0x3d99c000,0x58346000,0xc9cb5000,0xaeee8800,0x6e53a400,0xe5d9d200,0x8a1e3b00,0xe1fbe080,0x1f229040,0x1cb2e8e0,0xad8cf4f0,0xeac15a38,0x1b6e9f3c,0xe89bb256,0x00b66bfd },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x28000000,0xf4000000,0xe2000000,0x25000000,0x92800000,0x62400000,0x0e200000,0x02b00000,0x1cc80000,0xe26c0000,0x679a0000,0x47f50000,0x15668000,0x48194000,0x1b312000,0x9709d000,0x5f82e800,0xa4c04400,0x5e631200,0x01969300,0x78f7a080,0x7ee090c0,0xaedbc8a0,0xb05594d0,0x2c13fa28,0xb13fd7f4,0x36003262,0xd70643e5 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xf0000000,0xe8000000,0xac000000,0xd6000000,0x1f000000,0x53800000,0x24c00000,0x25a00000,0x3fd00000,0xf1480000,0x46640000,0x2df20000,0x60570000,0xb3828000,0xb4ccc000,0x1da06000,0x8bd07000,0x63497800,0x2361ec00,0xb77cca00,0x08103500,0xe16ae080,0x8a78b040,0xf69b1820,0x03269cf0,0xf99732e8,0x28ad19ac,0x495e4a56,0x6f0cf55f },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xd0000000,0x18000000,0x04000000,0x46000000,0x5d000000,0x61800000,0x2d400000,0xfd600000,0x5d300000,0x96c80000,0x8f240000,0xfad20000,0x0a350000,0xb04d8000,0xfce64000,0x807b6000,0xa3a15000,0xce13d800,0x2e1cf400,0x9e1f6600,0x76199b00,0xba1ee080,0xe0131040,0xff12b820,0x859ca4d0,0x945b3e18,0x25f22f04,0xa8e566c6,0x9e789b1d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x68000000,0x84000000,0x9a000000,0xc7000000,0x4c800000,0x37400000,0xd4600000,0xe5700000,0x64c80000,0x83ac0000,0x78560000,0x38db0000,0xe1928000,0x60fa4000,0xba08a000,0x5703f000,0x748f0800,0xeb471400,0xa2665600,0x3c770f00,0x754c2080,0x3f62b0c0,0xd7f52860,0x3e8ea430,0xb449fe68,0x62efeb84,0x253b7e1a,0x9425ab07 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x38000000,0xc4000000,0xf6000000,0x9b000000,0xf7800000,0xaa400000,0x66600000,0x32900000,0x42c80000,0xadac0000,0x15ba0000,0x09b50000,0x8bb78000,0xaeb24000,0xee3c6000,0xb9f93000,0xdcd3b800,0x12a90400,0xa4347600,0x70fa4100,0x3651e080,0x3c6e70c0,0x639058a0,0xbc4e74d0,0x4d61ae38,0x8d1f75c4,0xc481ae76,0xc1cf755b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0xd8000000,0xf4000000,0xea000000,0xbd000000,0x5b800000,0xddc00000,0x4d200000,0xfd500000,0xbf480000,0x396c0000,0x84ba0000,0x4eb70000,0xc3b98000,0xe0314000,0x39ffa000,0x46d75000,0xf2867800,0xfc48bc00,0xa5e66200,0x37f2dd00,0x59dc2080,0x680110c0,0x4c0858a0,0x4e02acf0,0x7f05bad8,0xca8a31f4,0x984dba6a,0xc7e6317d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x70000000,0xf8000000,0xec000000,0xfa000000,0xeb000000,0xc2800000,0x5c400000,0x37e00000,0x40f00000,0xd7e80000,0x50f40000,0x7fea0000,0x34f30000,0x91e58000,0xc9fdc000,0x426a2000,0xbc337000,0xeb460800,0x9766b400,0x4bbd7600,0x508ebb00,0xb3460880,0x4b66b440,0x69bd7620,0x278ebb70,0x73c60878,0x1026b4ac,0x66dd76da,0xd03ebb9b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0x28000000,0x9c000000,0xe6000000,0x59000000,0x7c800000,0x5e400000,0x35e00000,0xea300000,0x01e80000,0x503c0000,0x1ee20000,0x65bd0000,0x14208000,0x9214c000,0x2dfee000,0x20c95000,0x00ad2800,0x3052b400,0x4e117600,0xabf19700,0xc9cd2880,0x4422b4c0,0xda1976a0,0x01fd9710,0xfec728a8,0xeda3b45c,0x36dbf646,0xaf545749 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x38000000,0xbc000000,0x76000000,0x9d000000,0x26800000,0x6f400000,0x57600000,0xd6f00000,0x33680000,0x2cf40000,0x906a0000,0x43710000,0x2ba98000,0x2c5ac000,0x67bee000,0x1d0b1000,0x66808800,0x4f43e400,0x0766fe00,0xeefa0b00,0x8f608880,0x5af3e440,0x0d6efe20,0x65fe0b50,0x44e288b8,0x7b36e4fc,0xb14d7e56,0x2e65cbcd },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0x58000000,0x54000000,0x26000000,0x4b000000,0x05800000,0x95c00000,0xc4e00000,0x2df00000,0x12e80000,0x4ef40000,0x2b6e0000,0xa1310000,0x8e8b8000,0xb0444000,0x6121e000,0xe114f000,0x331fb800,0x2e14ac00,0x08947600,0xc4d03300,0xbff7b880,0x6fe0ac40,0x387a7660,0xbf213350,0x8e1c38d8,0x7894ec14,0xacd39646,0xe3f1c31b },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0x98000000,0x34000000,0x52000000,0x45000000,0x63800000,0x23c00000,0xdc200000,0xc8f00000,0x06280000,0xd1fc0000,0x3ba20000,0xe13f0000,0x0b0b8000,0x188c4000,0xc346a000,0xbb641000,0x899a9800,0x66bd2c00,0xb2cada00,0xbdace300,0xa6329880,0x25812cc0,0xc4c8daa0,0xc2a3e330,0x8cb11818,0x33c16cf4,0xb4247af2,0xc4f4f375 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0x98000000,0xac000000,0x32000000,0x29000000,0x14800000,0x02c00000,0xcde00000,0xadf00000,0xb3e80000,0xa6fc0000,0xc6620000,0xf4bb0000,0x0f4b8000,0x23a1c000,0x1ed0a000,0x09f75000,0xa5efe800,0x59fe7c00,0x8debb600,0xcdfae300,0x63e7e880,0x4ef27cc0,0xf261b6a0,0x6abde370,0x144e6818,0x1e28bc6c,0x089a9692,0xc6db7359 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x98000000,0xb4000000,0xde000000,0x61000000,0xca800000,0x63c00000,0x39200000,0xc9300000,0x6b280000,0x923c0000,0xa6aa0000,0x7e750000,0x70c38000,0x38ae4000,0xff766000,0x0a4c5000,0x5364c800,0xea596c00,0xa973da00,0x87413f00,0xd3ecc880,0xa6956cc0,0xa3d1da20,0x53383f90,0x3c2d4818,0xa5b22c74,0x6dee3afe,0xb79f2ff1 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0xb8000000,0x3c000000,0x82000000,0x79000000,0x1d800000,0xf6400000,0x67a00000,0x8d300000,0x82a80000,0x22b40000,0xc5ee0000,0xcc950000,0xb8958000,0xee9ec000,0xf199a000,0x3b1f5000,0x93d97800,0x5abbb400,0xd9ecc200,0x3e934700,0x69977880,0x771eb440,0xb9d14260,0xa7b98710,0x7a60d838,0x33d4e47c,0x6abdbae2,0x11ecf369 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0x88000000,0x34000000,0xd6000000,0xe5000000,0x25800000,0x89c00000,0xa2600000,0x93b00000,0xe3680000,0xd8340000,0x53ae0000,0xcdd30000,0xf2d68000,0x78584000,0xc31fe000,0x06301000,0xc2aab800,0x5e580c00,0xee17de00,0x77b25700,0xed64b880,0x913b0c40,0x6c295e60,0xcb1e1770,0x72355808,0x74a81c74,0xcb5d66b6,0x439a5b95 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0xa8000000,0xe4000000,0x2e000000,0xc7000000,0xfe800000,0x22c00000,0xfae00000,0xf2300000,0x7be80000,0xcfb40000,0x79a20000,0x28910000,0xc3f88000,0x49874000,0x64466000,0x342d3000,0x92d28800,0xc8d29c00,0x69d0e600,0x44559f00,0x4e188880,0x1d379c40,0x216a66a0,0x6373df50,0x144e6828,0x8c29eca4,0x7edc8e8e,0x52dd7397 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0x98000000,0xd4000000,0x1e000000,0xe5000000,0x6b800000,0xb9400000,0x56e00000,0x33700000,0xed680000,0x423c0000,0x678a0000,0x93470000,0x3deb8000,0x95f64000,0x73a06000,0x679f1000,0xf91d5800,0xc3dac400,0x407c5600,0x5fe8e300,0xe2f6d880,0x172c84c0,0xfe5c3620,0x0037f3b0,0xa08b8018,0x6fc64014,0x7028603e,0x72d31055 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0xe8000000,0x0c000000,0x22000000,0xa3000000,0xd0800000,0x8bc00000,0x44a00000,0x13f00000,0x0c280000,0xac3c0000,0x6e860000,0x22cd0000,0xdb208000,0x7ab1c000,0x8844a000,0x27e6f000,0xd8912800,0x657b8c00,0xdae3c200,0xb11b4300,0x9931a880,0xfb0a4cc0,0x048762e0,0xbdcdb310,0x31a88068,0xa67dc0cc,0xda6aa0c2,0x32d7f0b3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x88000000,0x24000000,0x5e000000,0x85000000,0xb6800000,0x01c00000,0xf2200000,0x42f00000,0x6aa80000,0x5e3c0000,0xa20a0000,0xb7010000,0x698a8000,0xbc4f4000,0x486d6000,0x239a1000,0x85b68800,0x014c4c00,0x62ea4a00,0x205b3300,0xd0940880,0x823f0cc0,0x400d2a20,0xe00023d0,0xf0080008,0x580c00e4,0xac02007e,0x7a0d0055 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x70000000,0x98000000,0x94000000,0x6e000000,0xa3000000,0x96800000,0x3e400000,0x56200000,0x91700000,0xbba80000,0xcdbc0000,0x6dc20000,0x41eb0000,0xdd938000,0xf3b64000,0xe6cb6000,0x7b657000,0x69d28800,0xf09f5400,0xd638ca00,0x060b5300,0x6f030880,0xcc8214c0,0x83402aa0,0xfba86370,0xadb2e018,0xbdc43054,0xa9e868ce,0xd19764d3 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x58000000,0x5c000000,0x7a000000,0xcd000000,0x80800000,0x5e400000,0x4ce00000,0x5b100000,0x5b680000,0x58dc0000,0x31420000,0x9d610000,0x5fdf8000,0x54c0c000,0x97ae2000,0x33731000,0xa83aa800,0xa058b400,0x23070600,0x538cf500,0x45cf2880,0xad2574c0,0x0034a6a0,0xb45e25d0,0xfd0420d8,0x688e109c,0x2a4728da,0xe2e9741d },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0xb8000000,0x94000000,0x1a000000,0x4b000000,0xa5800000,0x7bc00000,0x48600000,0xd2700000,0xe4e80000,0xa33c0000,0x60c20000,0x35ed0000,0x8db18000,0x1e804000,0x16462000,0xafa7f000,0xbc1af800,0x4b908c00,0x27539e00,0x4cb53b00,0x88017880,0xfc01ccc0,0x96063ea0,0xd50f8b10,0x4c842038,0x014af054,0x8c2b78ba,0xaad0cc5b },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x90000000,0x08000000,0x5c000000,0x62000000,0x81000000,0xed800000,0x87c00000,0x6e600000,0x9e300000,0x58e80000,0xf1740000,0x4aca0000,0xa9ed0000,0xe4f28000,0x2904c000,0x6182a000,0xcdcfd000,0x2361f800,0x19b0ec00,0x0225fe00,0x1093bf00,0xd2317880,0x72ed2c40,0x0c7fde20,0x5545af90,0xa728a088,0x3b12d01c,0x52fb7842,0xd6002c11 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xb8000000,0xec000000,0x66000000,0x23000000,0xab800000,0xadc00000,0x1b600000,0x17100000,0x09e80000,0x0c5c0000,0xabca0000,0x88690000,0x74998000,0xa023c000,0x2531e000,0x15d6f000,0x6f0dd800,0x5d8d6c00,0x16c2ce00,0x0ce34d00,0x64d65880,0xdd8bacc0,0xd6c8ae20,0x2ce37d50,0x34d9e038,0x658af02c,0x3ac7d846,0x4ae46c73 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x10000000,0xd8000000,0x44000000,0x7e000000,0x61000000,0x23800000,0x7ec00000,0xf1200000,0x26500000,0x1fe80000,0xcf7c0000,0x1dbe0000,0xbe950000,0x6bcf8000,0xc4af4000,0xd59d6000,0x3f46d000,0x14e01800,0x8bf45c00,0x15f5da00,0xa4f82100,0x3f7d7880,0x15b28cc0,0x4295c260,0x41cc7d10,0x03a8a258,0xd31aad84,0x1c00ba9e,0xfa02f1b1 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0xa8000000,0x7c000000,0x16000000,0x6d000000,0x7b800000,0x66400000,0xe3200000,0x87d00000,0xf3680000,0xf9f40000,0x17320000,0xa8dd0000,0xcfec8000,0x3f38c000,0x94d8e000,0x79e69000,0x42359800,0x47551400,0x63a9ba00,0xb71c3100,0xad857880,0xeb478440,0x28ae22a0,0x59942510,0xc4404228,0x1423753c,0x9f53ba36,0x47a5313d },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xf0000000,0xb8000000,0x24000000,0x0e000000,0xd1000000,0x96800000,0x05c00000,0x12600000,0x69b00000,0x41a80000,0x3ed40000,0x689e0000,0x7fb30000,0x64a18000,0x8e5f4000,0xd05a6000,0x6957d000,0xf3da4800,0x941aec00,0xc57b3e00,0xc14e7f00,0xcca82880,0xa2593c40,0x225f7660,0x625793f0,0x025a9638,0xf25c0364,0x4a533eee,0x6e5a7f61 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x50000000,0x28000000,0x4c000000,0x4a000000,0xe5000000,0x7c800000,0x45400000,0x8b600000,0x90500000,0x7c280000,0xda340000,0x76f60000,0x1c590000,0x96208000,0x8f3bc000,0x72752000,0x3d111000,0x1b472800,0xb0656400,0x97dc0e00,0xdeef8900,0xa39a0880,0xb7007440,0xed8d26e0,0xf7c3ed50,0x7d2e86a8,0xe0b03d0c,0x7cbc0e2a,0x5ebf89f5 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x28000000,0xfc000000,0x0a000000,0xf9000000,0x8e800000,0x6bc00000,0x2ae00000,0x9a300000,0xe4280000,0x24540000,0xe4da0000,0xc8190000,0x137c8000,0xe704c000,0xe1812000,0x6645d000,0x4ea00800,0x8194cc00,0xc932b600,0x83a4c700,0xc91b2880,0x09f81c40,0x5ac63e20,0x6860cb50,0xa3f2bea8,0xb3c00bbc,0xeee19eaa,0x6438dbe9 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x38000000,0xb4000000,0x46000000,0x4b000000,0xfc800000,0x86400000,0x03a00000,0xb6700000,0x52e80000,0x73540000,0xc3da0000,0xd7970000,0x493d8000,0xc0ce4000,0x64eae000,0x60557000,0x1b506800,0x9fdc7400,0x8d9a6200,0x78391b00,0xbd408880,0xa72e0440,0x143f8a20,0x9f4f2fb0,0x02220ab8,0x9fb16ff4,0x2f80eae6,0x3ec01fbb },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xf0000000,0x58000000,0x9c000000,0x1e000000,0x3f000000,0x83800000,0x02400000,0x18e00000,0x1bd00000,0xe1280000,0xad7c0000,0x04120000,0x048b0000,0x8dc38000,0x0cacc000,0x083b6000,0xa377b000,0xf3141800,0x130c3400,0xa5834600,0xf1492100,0x2d6cf880,0xe29744c0,0xf84c3ea0,0x95e2a5f0,0x4153a6d8,0x33ee515c,0x7251803e,0xa667c00f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0xd8000000,0xfc000000,0x6a000000,0xab000000,0x71800000,0x0fc00000,0x83200000,0x33b00000,0x95680000,0x5b5c0000,0xd3fe0000,0x0c870000,0x1f478000,0x066ac000,0x26d82000,0x0e30f000,0xe8aa7800,0xef76ec00,0xcbc89a00,0xe5265f00,0x4ab5d880,0x83ecdcc0,0x971ac260,0x08104330,0xa79f3a58,0x1d506f3c,0x3af1808a,0x9201c05b },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0x38000000,0x2c000000,0xe6000000,0xb7000000,0x59800000,0xea400000,0xdf200000,0x17d00000,0x4ae80000,0xb5b40000,0x6b9e0000,0xeac10000,0x5fe18000,0xe939c000,0xc558e000,0x07263000,0xabdb3800,0xf4e8b400,0xfeb99a00,0xec150100,0x9b8a5880,0x3f434440,0xa3a44260,0x091a85d0,0x4f097ab8,0x5587316c,0xbc4f6006,0x802af027 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0x68000000,0x3c000000,0xd6000000,0x51000000,0x1a800000,0x49c00000,0xdf200000,0xead00000,0xfa680000,0x5d3c0000,0x9d1a0000,0x884f0000,0x5b688000,0xcfbac000,0x78d8e000,0x59645000,0xb4b10800,0xc55dec00,0xeb20ca00,0x50d0d900,0x85696880,0xf2bf7cc0,0x4c532220,0xa5a665b0,0xf3102ae8,0xdd4889fc,0x53e26076,0xe57d9021 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0x58000000,0x14000000,0xda000000,0xf3000000,0x01800000,0x7e400000,0x28600000,0x55d00000,0x21a80000,0x2efc0000,0x4c9e0000,0x12490000,0x966f8000,0x94da4000,0x4f2d2000,0xc737f000,0x27b2f800,0x477c7400,0x6eda2e00,0xcc2ce100,0x2eb85880,0xc5fdc4c0,0xf913f660,0x060265d0,0xc5090ed8,0x8c8211d4,0xdecd203a,0xe8a7f0e3 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xb0000000,0xa8000000,0xcc000000,0x22000000,0xb1000000,0xbe800000,0xea400000,0x9de00000,0xf3100000,0x48280000,0x523c0000,0x609e0000,0xe6ef0000,0x90908000,0xeee9c000,0x8c9fa000,0xd4e35000,0x59920800,0x84631400,0x20d2e600,0x160cdd00,0x87032880,0x298684c0,0xbbcfce60,0xf22559b0,0x473c6628,0x501a1d0c,0x2fa408c2,0xaaf014c1 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x90000000,0xd8000000,0x64000000,0xaa000000,0xc1000000,0x47800000,0x8f400000,0x94a00000,0xbb300000,0x49680000,0xc55c0000,0x34b20000,0xba2d0000,0x3ffb8000,0x748d4000,0xadc22000,0x566dd000,0xf1d19800,0xf97bc400,0xdc436200,0x862b9f00,0x31fa3880,0xbf8654c0,0xbb435aa0,0x46accb90,0x8e38e258,0x7ce6dfa4,0xef18188a,0x4d9b8491 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0x68000000,0x24000000,0xa2000000,0x15000000,0x4f800000,0xee400000,0x0b600000,0x6d700000,0xb3a80000,0x21dc0000,0x9cf20000,0x76ef0000,0x8e308000,0x1b4b4000,0x94eba000,0xfb3f9000,0x44cf9800,0xa2af1400,0xbc5d5e00,0xafb5eb00,0xa606b880,0xc704c4c0,0x9281e6a0,0x35c22fb0,0x2f25dee8,0x5712abe4,0x33571882,0x69385465 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x30000000,0xd8000000,0xf4000000,0x16000000,0xfd000000,0xc3800000,0x53400000,0x8a200000,0x27b00000,0x5be80000,0x17540000,0x323e0000,0xd5af0000,0x0eff8000,0xaec24000,0x286be000,0xdc1b1000,0x2c191800,0xd41a0400,0x701e0a00,0x8e131700,0x5f137880,0x7e9c5440,0xc6db7260,0x72744330,0xc5098a58,0x478557b4,0xfd4698f6,0xb328448d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0x48000000,0xe4000000,0xbe000000,0x51000000,0xd1800000,0xb7c00000,0x1f600000,0x47500000,0x16280000,0xaf7c0000,0x485e0000,0xa6ab0000,0xe13e8000,0xf4ff4000,0x08946000,0x054dd000,0x222db800,0x09780c00,0x25543e00,0x95273100,0x15f15880,0x311d9cc0,0xc68d6660,0x3b46adf0,0xb3223ec8,0xb8f03124,0x6291d85e,0xc249dc61 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0xf8000000,0x9c000000,0x76000000,0x0d000000,0x9f800000,0xc9c00000,0x9b200000,0x98100000,0x76180000,0x971c0000,0xb6960000,0x865f0000,0x90f08000,0x26294000,0x2f962000,0x7bdaf000,0x763d0800,0xad829400,0xfec5a600,0x27ae6700,0xcf5da680,0x35726740,0xcceba620,0x2a3d67d0,0x3b8326d8,0xc3c8274c,0xd02306ae,0x629dd741 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xd8000000,0x34000000,0xd6000000,0x8d000000,0xd3800000,0xea400000,0xfd600000,0xca100000,0x74180000,0x85140000,0x0c920000,0xd9d70000,0x743a8000,0x3ee9c000,0x585ca000,0x8d707000,0x11074800,0x1982ec00,0x6d49ba00,0xc9eddb00,0x44d1ba80,0xdfb9dbc0,0xd0a3bae0,0xfb3edb90,0x26613a38,0x54931ba4,0x2dd79aee,0xc2306b29 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x48000000,0x64000000,0xfa000000,0x17000000,0xdd800000,0xd0c00000,0x9ba00000,0x34f00000,0xebf80000,0x92740000,0xd8b20000,0xc41b0000,0x656f8000,0x3a51c000,0xc98a6000,0x32c91000,0xc0a7c800,0xe7714400,0x9e3b3e00,0xa7591100,0x1b093e80,0x738211c0,0x85c6bee0,0xed23d150,0xefb4dea8,0x299ec134,0x0da11652,0x1df48523 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x88000000,0x44000000,0xa6000000,0x6b000000,0xcd800000,0x47400000,0x69e00000,0x62300000,0xa1380000,0x78bc0000,0x01f20000,0x3f1d0000,0xfaa58000,0x95d9c000,0x840fa000,0x060b1000,0x7b02c800,0xb58f3c00,0x8b4a6200,0x8beae100,0xaf386280,0x07b7e140,0xf27de260,0x2f5e21b0,0x34ca42e8,0x39a931f4,0x4c5a8a4e,0xfd4b0d9f },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xd0000000,0xe8000000,0xf4000000,0x4a000000,0x51000000,0xae800000,0xb5c00000,0xb5a00000,0x7a500000,0x67580000,0xdfdc0000,0xe51a0000,0x35370000,0xed298000,0xd09ec000,0x3f766000,0x23c17000,0x7aa89800,0x7fd44400,0x1510de00,0x6d359b00,0x212ade80,0x86929b40,0xd07b5ee0,0x96405b90,0x30ef3e08,0xd13a2b64,0x6f2c2642,0xc59baf35 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0xf8000000,0x34000000,0x76000000,0x4d000000,0x88800000,0x93c00000,0x9e200000,0x5fd00000,0x40d80000,0x9b540000,0x511a0000,0xde710000,0x7b4e8000,0x7de5c000,0xd9fea000,0x9b0c7000,0x558bf800,0xb34f4400,0x71e0e600,0x7bf6fb00,0x1002e680,0x6803fbc0,0x9c0e6660,0x0a033b70,0xf7044698,0x878b8b44,0x20479eee,0xc8697f09 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0x68000000,0x44000000,0x32000000,0x19000000,0x5d800000,0x52400000,0x2b600000,0x5c100000,0xd9980000,0x07dc0000,0xcab20000,0xa5a50000,0x14bb8000,0x6aa3c000,0xf232e000,0x64667000,0xfa902800,0x3752cc00,0x7f7c9a00,0xf1802b00,0x64471a80,0xe063eb40,0x6895fa60,0xbe559b30,0x3afdd208,0x8fcb5774,0x392b483a,0x97727c6d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x70000000,0x28000000,0xcc000000,0x4a000000,0x63000000,0x6e800000,0x26400000,0x3ee00000,0xa1700000,0x4bf80000,0x5bb40000,0x845a0000,0x94ad0000,0xf5978000,0x198f4000,0x26c1e000,0x1da2d000,0xa81fb800,0xe94c9c00,0xaa619200,0x2c37d500,0xa7961280,0xbe8895c0,0x5e4ff260,0x4aee45b0,0x7f724a48,0x86fbd97c,0xd03e5802,0xe59e4c1f },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x98000000,0x6c000000,0x16000000,0x45000000,0x5a800000,0x77c00000,0x93e00000,0xc9d00000,0x05580000,0xf7940000,0x1ef60000,0x70eb0000,0x7e5a8000,0x2c184000,0x21b72000,0xe3cc7000,0xd9e55800,0xf2d16400,0x3ed5fa00,0x38dd5700,0xc5d77a80,0x235117c0,0xda965aa0,0x60766710,0xe5298238,0xd2bf437c,0xec4b582e,0x4cae6439 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0xb8000000,0x54000000,0xce000000,0x93000000,0xa1800000,0xe3400000,0x76600000,0x13b00000,0xc8380000,0x66740000,0xfa920000,0x2fef0000,0x04fc8000,0xc05dc000,0x8ecb2000,0x7f211000,0x30d18800,0xd50f7c00,0xce88ba00,0x00cdd100,0x4c2c3a80,0x215411c0,0x5e4d1ae0,0x54ee0110,0x89721258,0xd913bd44,0x75ad0896,0xe612bcd7 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x30000000,0xb8000000,0x04000000,0x3e000000,0x3b000000,0x2e800000,0x80400000,0x05a00000,0x8df00000,0x51780000,0x88340000,0xb2160000,0x1c250000,0x61368000,0xf592c000,0x1bef2000,0x43559000,0x6a0bf800,0x6d0e3c00,0xb980c600,0x1cc2c900,0x3cee4680,0xa7d409c0,0x774f66a0,0x492099f0,0x1cbc1e18,0xf75d65f4,0x2c0b7826,0x7209fccf },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0x38000000,0xac000000,0xda000000,0x3b000000,0x73800000,0x0a400000,0xbd600000,0x95100000,0x8d980000,0xac540000,0x077e0000,0xdd0f0000,0x6a848000,0x4ec24000,0x0ea5e000,0x21375000,0x7a6be800,0x64958c00,0xa0ddfa00,0x90b01b00,0x37277a80,0xe87d5bc0,0xb8861a20,0x31c84bd0,0x93281218,0x767a977c,0x6d8600c2,0x1f4b0047 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xf8000000,0xe4000000,0x62000000,0xdf000000,0x8d800000,0xfd400000,0x01600000,0x2bd00000,0xe5580000,0xd3940000,0xb2b60000,0x9a830000,0xdcc48000,0xf226c000,0xdbb2e000,0xe2021000,0x1f014800,0xad8edc00,0xad4fea00,0xf96a2700,0xcfdd6a80,0x875fe7c0,0x0c930aa0,0x3f3f3790,0x67cea258,0xdda4fb74,0xd9f2803a,0x3ee5c0ab },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0x98000000,0xd4000000,0x6e000000,0x1f000000,0x0f800000,0x4ac00000,0x3de00000,0x2b500000,0x47d80000,0x709c0000,0x9ab60000,0x36870000,0xf6468000,0x72afc000,0xa5732000,0x0debd000,0xe35ea800,0xabd14400,0xda9b7a00,0x73babf00,0xf20bfa80,0xdd027f40,0x1a865a20,0xbc4a6f50,0x2ba5d2b8,0xe9fbfb84,0x6aa880d6,0x3174c09b },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0x28000000,0x84000000,0x9a000000,0xfd000000,0xd5800000,0xc5c00000,0x5b600000,0x3fb00000,0x9d380000,0x98740000,0x37520000,0x9c4b0000,0xb0a18000,0xdbd5c000,0xb6026000,0x2300b000,0xd2856800,0x7d4e7400,0x6329e200,0x251f0900,0x63e26280,0xc7f5c9c0,0xe79382e0,0xf6abb950,0x40d50ac8,0xc880bdd4,0x4043e052,0xd6a57029 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x08000000,0x24000000,0xee000000,0xcb000000,0x1a800000,0xdb400000,0xd5600000,0xdab00000,0xf5380000,0x67f40000,0x0f5a0000,0xa9c10000,0x5a298000,0x09d7c000,0x708f2000,0x6e4c9000,0x5cefb800,0x87754c00,0x39157a00,0x692aa100,0x1f5efa80,0x31c861c0,0x26225a60,0x7bd23170,0x798b4268,0x75cc2d54,0xb826a086,0x58db509f },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0x68000000,0x9c000000,0x6e000000,0x9f000000,0xd3800000,0x1c400000,0xcea00000,0xd7f00000,0xc9780000,0xa7bc0000,0x41da0000,0x134d0000,0x45238000,0x5fbe4000,0x85d6a000,0xe94c5000,0x5829e800,0x1532ec00,0x49106600,0x862e2900,0xc231e680,0x16916940,0xec66c6e0,0x67927930,0xe0e00e88,0xc85f85ac,0x420ca0e6,0xb9015033 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0xa8000000,0xbc000000,0x66000000,0x3b000000,0x1b800000,0x66c00000,0x74600000,0x0fb00000,0x51780000,0x111c0000,0xf4aa0000,0x00d70000,0x25418000,0x76a04000,0x39d12000,0x47c31000,0x12eae800,0x79f9a400,0xa05bf200,0x1804e100,0x040ad280,0x1207f140,0xb1003ae0,0xee8e5510,0xfa43c848,0x6f26b4ac,0x261b1aae,0x312a45d7 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0xf8000000,0x64000000,0xa2000000,0x73000000,0xca800000,0x3bc00000,0x5ca00000,0x1c700000,0x33b80000,0x15140000,0xce6a0000,0x5d510000,0x9c8a8000,0x02c6c000,0xa92de000,0xe3385000,0x19d63800,0x2a4a6400,0xc1e2fe00,0xa51d8100,0xf66f1e80,0xd955d1c0,0x0e812660,0x89cbb5f0,0x07a9d898,0x7af73494,0x367446ba,0xfcb02527 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0xf8000000,0x0c000000,0xca000000,0x53000000,0xef800000,0x7ac00000,0xde600000,0x8b100000,0xc5d80000,0x3dbc0000,0x9fa60000,0x0eff0000,0x520c8000,0xaf0a4000,0x6d89e000,0xcdc85000,0x0fe8e800,0x64dca400,0x6d301200,0x70ebcb00,0x1159f280,0x1cf39b40,0x5d091a20,0xd2833f50,0x584708d8,0xce2bf45c,0xa1347a92,0x5aed2f4f },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x48000000,0x94000000,0xd6000000,0xa1000000,0x65800000,0x7dc00000,0x5fe00000,0xd6b00000,0x59780000,0xf9940000,0x1fa20000,0xb8990000,0x8a298000,0xed52c000,0x71cea000,0xa5e13000,0x1db3a800,0xeff9d400,0xded99a00,0x6d0e1900,0xff8f3a80,0x86cb29c0,0xa16692e0,0x65fffdf0,0xfdd488a8,0x1f8a2464,0x76c492fe,0x8966fd05 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x90000000,0x08000000,0x6c000000,0x7a000000,0x77000000,0x74800000,0x09c00000,0xabe00000,0xff900000,0x51580000,0xa6340000,0x4c6a0000,0x54db0000,0x1e7f8000,0x61cb4000,0x97e3e000,0x6d911000,0xda561800,0xa0b2e400,0x5ea60a00,0xf1be0b00,0x9f2fea80,0xeff41bc0,0xc7867260,0xdb4dbf50,0xd7239868,0xa3f2a43c,0xcd826a92,0x34405b8b },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x08000000,0x7c000000,0x5a000000,0x33000000,0xb8800000,0x92c00000,0x2fe00000,0xafd00000,0xdc180000,0x447c0000,0x3be60000,0xf9d70000,0x8d1b8000,0x2bf24000,0x3fa4e000,0x51f65000,0xdca69800,0x417bd400,0xa260ba00,0x3c9d7f00,0x42ba5a80,0x02002f40,0xa7014220,0xae8ebbd0,0x63c69828,0xd06bd4ac,0xa398baf2,0x08317fdf },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x50000000,0xf8000000,0x1c000000,0x62000000,0x77000000,0xf3800000,0x93c00000,0xcb600000,0x03500000,0x19980000,0xf4740000,0x006a0000,0xe2d70000,0xb55c8000,0x789f4000,0x16f26000,0x392f9000,0xa4f6e800,0x762c3400,0xab7bd200,0xd7ecaf00,0xef1bb280,0x3b303fc0,0x0743da60,0x73204b90,0xf7fce898,0x1bab348c,0x7dbf527a,0x6007ef3b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0x48000000,0xbc000000,0x02000000,0xdf000000,0xb8800000,0xb1c00000,0xc8600000,0x77d00000,0x8f180000,0xcefc0000,0xc5620000,0xf85b0000,0xca538000,0xed524000,0x51dd6000,0x06151000,0xe771d800,0x49212400,0x12787200,0xc2a57700,0xb13f1280,0xc8076740,0xfc074a60,0xe2030350,0xcf0bd828,0xf08624ec,0x0dc9f2aa,0xca6c3773 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xa8000000,0x94000000,0xde000000,0x11000000,0xf1800000,0xb8c00000,0x95200000,0xad700000,0x94380000,0x71d40000,0x4d8e0000,0x32c50000,0xfa238000,0x7df0c000,0x75762000,0xc831b000,0xabdde800,0x1a888400,0xee424600,0xf962c900,0x9f17e680,0xada3b9c0,0xb83c2e20,0x63da8df0,0x1e838088,0xa840c064,0xd46e20d6,0x2495b0b5 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x88000000,0x2c000000,0x66000000,0x75000000,0xe3800000,0x2fc00000,0xbaa00000,0xeed00000,0xea980000,0xf3f40000,0xd1820000,0x58cd0000,0x06298000,0x419d4000,0x61742000,0x47c7f000,0x26a50800,0x60da9400,0xc390ee00,0xfe79fb00,0xa74d4e80,0x67e34bc0,0xb23c66e0,0xf22e2fb0,0x53918068,0xc679409c,0x634e208e,0x5deef029 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0xb8000000,0x9c000000,0xc6000000,0xb5000000,0xab800000,0x79400000,0x0c600000,0x78b00000,0xe2780000,0xc35c0000,0x65860000,0x38470000,0xe5e88000,0x7efb4000,0x8e962000,0x4022f000,0x9f538800,0x438d7c00,0xbd4b6a00,0x66689900,0x23b5ca80,0xd8f12940,0x4b906220,0x63aea5d0,0x52108098,0xade7404c,0x2af020de,0x5c95f0b9 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x70000000,0xe8000000,0xc4000000,0x3e000000,0x47000000,0xf4800000,0x83c00000,0xdc600000,0xb5d00000,0x74980000,0x38340000,0x23060000,0x7a890000,0x0ccb8000,0x9ce5c000,0xe0112000,0x2bf3d000,0x476cd800,0x935d0400,0x6a57b200,0x19d32700,0x4e951280,0x613137c0,0xe08eeaa0,0xe5c6e3b0,0x97660048,0xcb590074,0x665380f6,0x93d1c0f3 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0x28000000,0x14000000,0x92000000,0xbd000000,0xa0800000,0x0e400000,0x94e00000,0xe6500000,0x5d980000,0x33bc0000,0x7d460000,0x5f650000,0x5f938000,0x56b0c000,0x41c6e000,0x672db000,0xcc79f800,0xb960bc00,0x20946200,0x733daf00,0x63070280,0x5385df40,0x85cb9a20,0x8d2813f0,0x5d78e008,0x07e4b0e4,0x3dd4781a,0x7c597c19 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0x68000000,0xb4000000,0xfa000000,0xcf000000,0xb9800000,0x67c00000,0x27600000,0x3d700000,0xf8380000,0xeb1c0000,0x61c60000,0x16610000,0x79f38000,0xad7ac000,0x803e6000,0x671e1000,0xb7c1c800,0xff669400,0x41775200,0x4632bd00,0xb61cb280,0xa3476d40,0x32289a20,0xf65929b0,0x0ee66048,0x22b21004,0x535fc832,0x006b948b },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xc8000000,0xec000000,0x42000000,0x1f000000,0x77800000,0xe5c00000,0xe8600000,0xa9500000,0x70180000,0x9c340000,0x71c20000,0x1e6f0000,0xb05f8000,0xe69f4000,0x9b726000,0xf8e91000,0x8f1da800,0x7bbf5400,0x3c04e200,0x4a062f00,0x930b0280,0x658f7fc0,0x32c34ae0,0x73e27b90,0x0e926028,0x8779107c,0x42e5a8ea,0xe41b54a3 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0xd8000000,0xf4000000,0x2e000000,0x73000000,0x1e800000,0x67400000,0x9f600000,0xde700000,0x7ab80000,0x2f140000,0xb7ce0000,0x3b2b0000,0xf79a8000,0x3f87c000,0xc8cc2000,0xefa09000,0xb5d93800,0xe9652c00,0x997d2a00,0xea328500,0xeb5d8a80,0xee2ad5c0,0x761c1220,0x3c43a910,0xbdeea0f8,0x1b3350e4,0x9cdb1856,0x6aeebc57 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0x28000000,0xec000000,0xca000000,0x51000000,0x17800000,0xf1c00000,0x65200000,0xc7500000,0xd2180000,0xcc740000,0x524a0000,0x5aed0000,0x35738000,0x69cb4000,0x812ce000,0xf1597000,0x911fc800,0x4efdf400,0x920cf600,0x55049b00,0xd1819680,0x9acfabc0,0x0bab3e60,0xcd1d6f30,0x8cff6048,0x3f0230dc,0x508b2802,0xb540844d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xb0000000,0xf8000000,0x3c000000,0x4e000000,0x19000000,0x56800000,0x7e400000,0x65200000,0xa7500000,0xe2780000,0xb52c0000,0x0f5e0000,0x36790000,0x8f288000,0x9c524000,0x0bfe2000,0xf0edf000,0xc8b6b800,0xe14cac00,0xaea44600,0x5d9e9f00,0x1e12fe80,0xc0d23340,0x5eb6b820,0x344cacf0,0xee244658,0xb6de9f8c,0x9bb2fe36,0x3cc23365 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x98000000,0x34000000,0xbe000000,0x59000000,0xff800000,0x1fc00000,0xae600000,0xb7700000,0x01180000,0xc26c0000,0xdd7e0000,0xd61b0000,0x6cec8000,0x9134c000,0xedb3a000,0x92f2f000,0x81d6a800,0xce89a400,0x3c4bea00,0x93a23900,0xc21d4280,0x02eb9d40,0xf036a820,0xb639a4d0,0xab33ea38,0x42be39a4,0x387b42a6,0x7b9c9d2d },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0xf8000000,0xb4000000,0x12000000,0x39000000,0x2d800000,0x4bc00000,0xa1e00000,0xc8f00000,0xf1180000,0x3dec0000,0xd6fe0000,0xce170000,0x6b668000,0x71bac000,0xbdbd6000,0x5bb43000,0xd0b38800,0x943f0400,0x0a709200,0x54501900,0x2f431a80,0x2faf1d40,0xced38820,0x6e0f0410,0xd7089258,0xba8c19e4,0x51451a6a,0xa0a41dcd },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x98000000,0x3c000000,0xe2000000,0xbb000000,0x6c800000,0x7a400000,0xa0a00000,0x70b00000,0xcc180000,0xcea40000,0x71ba0000,0x479d0000,0x0a6e8000,0x88504000,0xc700e000,0x2e831000,0x91413800,0x642f8c00,0xaef1be00,0xb2bbb900,0xe7108680,0x6a2435c0,0x9ff938e0,0xa13b8cf0,0x1fd3bef8,0x71c2b90c,0xa46406fa,0xe9597547 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x68000000,0x74000000,0x72000000,0x8b000000,0x7f800000,0x31400000,0x43200000,0x88700000,0x49580000,0x722c0000,0x38f20000,0x6d9f0000,0x874b8000,0xe223c000,0x10f76000,0x79901000,0xe5428800,0x01268c00,0x1b7fb600,0x3adc7d00,0x2d653e80,0xf6d6f140,0x636888e0,0x0bd58c50,0x9de63608,0xd210bd64,0x9601de9a,0xd10921bf },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xf0000000,0x58000000,0x1c000000,0x6a000000,0xff000000,0xe9800000,0x02400000,0x5ea00000,0xc5f00000,0x04580000,0x38240000,0xb63e0000,0x64b50000,0x397e8000,0xd0924000,0xad4e6000,0xdf2dd000,0xa3b82800,0xdcfb5c00,0x30dcde00,0xb8e9bd00,0xdd5af680,0x2ca7e1c0,0xc6f8a8a0,0x57dc1c30,0x6d6c3e78,0x45162dec,0xd50cbeb2,0xf6816d23 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xa8000000,0x34000000,0x12000000,0xbd000000,0xb3800000,0x50c00000,0x06200000,0x14d00000,0xd7f80000,0xbca40000,0x259a0000,0x5c110000,0xedd18000,0x1e7bc000,0x056f6000,0x72357000,0x0d082800,0xbb85d400,0xf4c05e00,0x4c2ca700,0x35d27680,0x427873c0,0x4363a8e0,0x2d3f1430,0xab86bec8,0x6cc617c4,0xb02f3e3a,0xe3d9d749 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xb0000000,0x38000000,0x94000000,0x2a000000,0x77000000,0xc8800000,0x27400000,0xcf600000,0x42d00000,0x0eb80000,0xdee40000,0x58120000,0xa51d0000,0x8a9c8000,0x0d50c000,0xf97ae000,0xf2c75000,0x77a83800,0x32739c00,0x2c429200,0xf1e74300,0x7498aa80,0x7059dfc0,0x16feb860,0x950a5c70,0x338ef2d8,0x01c9d324,0x3d24f292,0x9e30d323 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x70000000,0x88000000,0x84000000,0xe6000000,0xe5000000,0x4a800000,0x25c00000,0xfd600000,0x11700000,0xb5180000,0xe4ec0000,0x233e0000,0x8b350000,0x3f338000,0xf136c000,0xe0372000,0xc4b9b000,0x807b3800,0xd1995400,0x002c7a00,0x02d39900,0xd2894280,0xb9cfcd40,0xc76eb820,0x6e769430,0xf096da28,0x0ca9e9f4,0xb216daee,0xed69e921 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0xf0000000,0x28000000,0xc4000000,0x9a000000,0x9b000000,0xbf800000,0x60400000,0xf8200000,0x3b100000,0xe2380000,0x4dac0000,0xf85e0000,0x199d0000,0x90f18000,0x0f48c000,0x15a4e000,0x54579000,0xe79b8800,0x61f69c00,0x03c3d600,0x0e66db00,0x563e5e80,0xbfa14740,0x07520820,0xcc125cb0,0x43b93688,0x8cec4b34,0xd4f45632,0xd54f1b1f },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x38000000,0xdc000000,0xaa000000,0x29000000,0xb2800000,0x83c00000,0xd6600000,0x65300000,0x80580000,0x86e40000,0x0bf20000,0x42b50000,0xeb148000,0x22444000,0xe6266000,0xb616b000,0xceccf800,0xd2ebf400,0x85feaa00,0xfdb32d00,0xea985280,0x0209d9c0,0xdd007860,0x2c8bb4f0,0xd4cacad8,0x03e09dec,0x0b782a12,0xe4726d35 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0xa8000000,0xb4000000,0xe6000000,0x15000000,0x63800000,0xf1c00000,0xc5a00000,0xedf00000,0x6b580000,0x682c0000,0xfd320000,0x4b7f0000,0x71178000,0x984bc000,0x8b662000,0xc4d2b000,0x43efa800,0x0f928400,0x8e093600,0x810e8d00,0xf58c9e80,0x5ccf0940,0xba2028e0,0x4e354450,0x5dfd16c8,0xf3533da4,0x042cb6ce,0x173a4de1 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0xa8000000,0x9c000000,0xea000000,0xbf000000,0x54800000,0x12400000,0x33a00000,0xd5900000,0x47380000,0x2f2c0000,0x6bd20000,0x56990000,0xa9b18000,0x3a694000,0x48f26000,0x4f46d000,0x142ef800,0xc15f8c00,0x9dd18e00,0x4398fb00,0x22357680,0x0ca27740,0xc11f78e0,0x3576cc30,0x6c83eec8,0x164e2bec,0x8da38ec2,0x6c91fb63 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xd0000000,0x08000000,0x7c000000,0x72000000,0xc3000000,0x73800000,0x50400000,0x2de00000,0x40300000,0xfe580000,0x5e2c0000,0x75960000,0xcf870000,0x42498000,0x1ee54000,0xebbde000,0xda139000,0x7dc0c800,0x84a31c00,0x8154ea00,0x3fa46500,0x16dda280,0x49e23940,0x2634a8a0,0xc355cc90,0x44a9c228,0xe154e9ac,0xcfa980fa,0xced540ff },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x30000000,0x58000000,0x74000000,0x5e000000,0xa1000000,0x23800000,0x68c00000,0xd7200000,0x1b500000,0xdbf80000,0xd6640000,0xabb20000,0x2d050000,0x198a8000,0x1fccc000,0x49a1a000,0x221a7000,0xef176800,0xc6955400,0x815bee00,0xbcf7ff00,0xc0e60680,0x8efe6bc0,0x6be44860,0x8277e4f0,0xe9a726b8,0x3219db44,0x67120086,0xda950015 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x58000000,0x24000000,0x56000000,0x41000000,0x4e800000,0x00400000,0xe7600000,0x33700000,0x0c980000,0xdeac0000,0xabda0000,0x2e450000,0x12628000,0xa3f9c000,0x01dc2000,0x5d48f000,0xabe8b800,0x9c3c8c00,0xf074e200,0xad126900,0x2566da80,0x3c7b2540,0xc7141860,0xf664bc70,0x55f8fab8,0x90dad514,0x7bc4208e,0xd7a4f025 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0xa8000000,0x3c000000,0x3e000000,0x65000000,0x92800000,0x4ac00000,0x0fe00000,0x52900000,0xd9f80000,0xd8ac0000,0x82360000,0x77cf0000,0x196b8000,0x925b4000,0xe11d2000,0xebb33000,0xda82b800,0x46cd6400,0xe9ef8200,0xf390bf00,0xe17eba80,0xf56a9b40,0x445a18a0,0x98161410,0x17359a88,0x5d46ab6c,0xe7ab2016,0xcfbc3019 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0xd8000000,0x04000000,0x16000000,0xe5000000,0x78800000,0xb0400000,0x05600000,0x5c300000,0x3fd80000,0x4aac0000,0xea9a0000,0x77470000,0xe6e88000,0x5df3c000,0x28782000,0x8cbeb000,0x039b9800,0x65ceec00,0x51a38200,0x1b10dd00,0x85889a80,0x6cc1f140,0x53293860,0x74589c50,0xc76aba38,0xd7384114,0x565a204e,0x5c65b0a1 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x28000000,0x3c000000,0x92000000,0xb7000000,0x60800000,0x0dc00000,0xa8200000,0x03100000,0x2db80000,0xea640000,0xe2720000,0xfd470000,0x4def8000,0x773f4000,0xaca3e000,0x58dcd000,0x5498b800,0x80faf400,0xaf89ae00,0x594c7b00,0xfbe69680,0xb63dcfc0,0xed26d860,0x049e64d0,0x88fd76c8,0x63851f2c,0xf34c603a,0x58e3904b },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x30000000,0x98000000,0x0c000000,0x6e000000,0x15000000,0x54800000,0xa5c00000,0xd1600000,0x08900000,0x78780000,0x71a40000,0x857a0000,0x112d0000,0x12b68000,0x13474000,0xcfa92000,0xf8783000,0xb1afd800,0xe57c7400,0x2128da00,0x8ab13700,0x1f4b8280,0xa1a703c0,0xed7cf8e0,0xe52944f0,0x40b182f8,0xf04a033c,0x822a7876,0x673e04d9 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xd0000000,0x38000000,0x54000000,0x8a000000,0x43000000,0xba800000,0xf1400000,0x9f200000,0x8e700000,0xb8d80000,0x056c0000,0xa7d60000,0xe9e70000,0x039a8000,0xb94cc000,0x6324e000,0x487d1000,0xf5dfd800,0x4ee39c00,0xfb119600,0xb7051d00,0xa082ce80,0xaa4d4140,0xa1ad38a0,0xcd398c90,0x30f4ce18,0xbb9a4184,0xad4fb832,0xc9294c57 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x70000000,0xa8000000,0x5c000000,0x22000000,0x2b000000,0xaa800000,0xd3400000,0x3a200000,0xd1b00000,0xf0d80000,0x774c0000,0x3c2a0000,0xbcb90000,0xd7558000,0xf3834000,0x2acde000,0x27e99000,0x9ed59800,0xe640dc00,0xa9ad7600,0xcb702900,0x9f350e80,0xc5996540,0x506de060,0x62199030,0x94ad9848,0x94fcdc2c,0x7fff768a,0x75752977 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0xc8000000,0x14000000,0xa2000000,0x65000000,0x74800000,0x22c00000,0x2ce00000,0x80900000,0x96b80000,0x26c40000,0x26e60000,0x019f0000,0xd8318000,0xbd09c000,0xc88d6000,0x64c37000,0x73e89800,0x4d18a400,0x76f38200,0xefe2b700,0x9b167a80,0x41f963c0,0x666d6020,0x11537090,0xf9d09868,0x0d1ca444,0x16f5826a,0x1fedb771 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0xb0000000,0x78000000,0x9c000000,0x6e000000,0x03000000,0xeb800000,0xbf400000,0x8ee00000,0xf6500000,0x4bf80000,0xb54c0000,0x3fe20000,0x10dd0000,0xac348000,0x17624000,0x641d2000,0x4d93d000,0xa7de0800,0x3db10c00,0x412d3a00,0x407fdb00,0xfa0e1280,0xa90d0740,0xca8520e0,0xf1cfd0f0,0x3d240818,0xde700c2c,0xe103ba16,0x6e8c9b9f },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0xf0000000,0x48000000,0xe4000000,0xa2000000,0x4f000000,0x6b800000,0x6c400000,0x29a00000,0xf0f00000,0x77180000,0x514c0000,0x152a0000,0x4b310000,0xccf38000,0xc916c000,0xf0466000,0x87abd000,0xe9f7c800,0x499dbc00,0xb588be00,0x7d470500,0x13211680,0x463d6940,0x18746060,0x86d6d0b0,0x51ae48a8,0xfcfa7c14,0x211d5eea,0x044a15ab },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x50000000,0x98000000,0xb4000000,0xa6000000,0x1f000000,0x68800000,0x5ac00000,0x57a00000,0x51700000,0xe2180000,0x0fcc0000,0xd22e0000,0x2a3f0000,0x50f48000,0x175ec000,0x7e272000,0x78309000,0x49f9f800,0x30d8e400,0xd46e7600,0xc15bbd00,0xe928ae80,0x9cbfc940,0x51312020,0x46739010,0x469b7838,0xb70524e4,0xf48bd63e,0x20c6edab },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x50000000,0x08000000,0x34000000,0x6e000000,0xa3000000,0xd9800000,0xc9c00000,0x23e00000,0x7ef00000,0x6ed80000,0x8ec40000,0x5c620000,0xc03b0000,0xaabd8000,0x92f7c000,0xfcdfa000,0x97c3d000,0x18e02800,0x7b79c400,0xad168200,0x682ec100,0x6c110a80,0xd0a0d5c0,0x6d5da060,0x4a08d090,0xe505a8e8,0xfe8a0464,0x264b2266,0x75261197 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x70000000,0x18000000,0x0c000000,0x22000000,0xc5000000,0x13800000,0x2a400000,0x3d200000,0x6e900000,0x0ff80000,0x17440000,0x92aa0000,0x1ed10000,0x8bde8000,0x50554000,0x7e10e000,0x053b7000,0x98a9e800,0x6fdfdc00,0xa65b1600,0xf5190b00,0x81ba1e80,0x7c69a7c0,0x673ae0e0,0xfdaa70b0,0x6c576878,0xe41a9c7c,0xdc33f63a,0xc1267bc9 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x50000000,0xe8000000,0xac000000,0xae000000,0xa1000000,0x90800000,0x54c00000,0x9a200000,0x93100000,0x0cf80000,0x0d4c0000,0xb2620000,0x93f30000,0xf4c38000,0xea204000,0x4b162000,0x18fdf000,0xe7419800,0x11648400,0x0c750e00,0x91890300,0xb440b680,0x16e37740,0x1d37a0e0,0x75eeb010,0xa2b43888,0x20a934fc,0x44dab646,0x395c770d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x90000000,0xa8000000,0x24000000,0x9a000000,0x01000000,0xe2800000,0x29c00000,0xcd600000,0x8b300000,0x90980000,0x0f440000,0x2eaa0000,0x8f5f0000,0x4d2b8000,0x8414c000,0xc985e000,0x524cb000,0x7a22b800,0xe997f400,0xc1c56a00,0x496a3500,0xe1303280,0xa99a71c0,0x61ce60e0,0xb9687050,0xd93f58c8,0x259f44b4,0xdfcdd232,0x2262c125 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x10000000,0x78000000,0x1c000000,0x86000000,0x21000000,0x60800000,0x3c400000,0x80e00000,0x92300000,0xb6180000,0xc48c0000,0x064a0000,0xd7ef0000,0xbbb68000,0x8ede4000,0xe225a000,0xb3907000,0xb2431800,0x95e74c00,0xf0b38a00,0x21518d00,0xfbe3b280,0xf5b8f140,0x3bd68060,0x70ae4050,0x4cdda098,0xe92c700c,0xfc1118fe,0xbb844c3d },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xb0000000,0x08000000,0xfc000000,0x5a000000,0x41000000,0x84800000,0xa5400000,0x6a200000,0x7bb00000,0xc8580000,0x68840000,0x874e0000,0xff290000,0xe93b8000,0x7e174000,0x3b2e6000,0x873fb000,0xb91d5800,0x14ad9c00,0xeffdb600,0x0efa7900,0xfa750e80,0x773f15c0,0x511b80a0,0x78a74070,0x0df66028,0xbbfbb04c,0xd8f35852,0xc9749cbd },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0xd0000000,0x98000000,0xc4000000,0x06000000,0x0b000000,0x4f800000,0x35400000,0x52600000,0xb1700000,0x3dd80000,0xdd840000,0x604e0000,0xf2ef0000,0x1db48000,0xc9fdc000,0xb5182000,0xdfa6d000,0x4bd74800,0x5e892c00,0x53c2b200,0xd5a99100,0xdad95a80,0xf80badc0,0xf40c80a0,0x6e09c010,0x870e20b8,0x158dd014,0xfc4dc89e,0x10ebeccf },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0x48000000,0x74000000,0x36000000,0xe3000000,0x7e800000,0x70400000,0xaf600000,0xd6300000,0xfd980000,0x95840000,0x1ac60000,0xf9210000,0x625f8000,0x692bc000,0x5a582000,0xf52f5000,0xa85ed800,0x68266c00,0x41ddb200,0x50e27500,0x7dfcca80,0x573489c0,0x26198020,0x904ac070,0x7f67a0e8,0x8e3490c4,0x719ef87e,0x9f8d3c97 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x10000000,0x38000000,0x0c000000,0x9a000000,0x8f000000,0x8a800000,0xc2c00000,0xbb600000,0x1db00000,0xc9980000,0x530c0000,0x08820000,0x31c70000,0x83e28000,0x64734000,0x6e716000,0x997d5000,0x7ffa5800,0x373f8400,0x3b5f1a00,0xa0622d00,0x3134a280,0x5654b940,0xc9e200e0,0xf3770050,0x98fa8058,0xe9bf401c,0x7f9360a2,0x360a5083 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x50000000,0x58000000,0x5c000000,0xae000000,0x83000000,0xc4800000,0xd4400000,0x18200000,0xc7500000,0xd8b80000,0xdd0c0000,0x0f860000,0x34c70000,0x6e608000,0xaa704000,0x04672000,0xbb76d000,0x9dee7800,0x20b00c00,0x91034600,0xd9893700,0xbbcc9e80,0x5ce8ab40,0xa13e00a0,0x76cb0010,0x2b668078,0x99f7400c,0xeea7a0f6,0x5e1690df },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0x18000000,0x0c000000,0xb2000000,0x09000000,0xe0800000,0x3cc00000,0xbba00000,0x6cb00000,0x86580000,0x5b040000,0x39860000,0xd4410000,0x236a8000,0x71114000,0x5de3e000,0x86d7b000,0xb7cc9800,0x8a2ac400,0x1cf3f600,0x033eb100,0x9d100e80,0x3fe385c0,0x87de0020,0xf3450070,0x10ec80b8,0x105040bc,0x340960aa,0xce06f005 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0xe8000000,0x74000000,0xe2000000,0x0f000000,0x20800000,0x98c00000,0x10e00000,0xe6700000,0xb3d80000,0xda040000,0x730e0000,0x068b0000,0x0dc78000,0xa369c000,0xc8396000,0xd6f6d000,0x0316f800,0x9eed8400,0xe77f8200,0x5252e900,0x83419a80,0xaaaf7dc0,0xd15800a0,0x1dc40050,0x8b6e00c8,0x9c3b00e4,0xa4ff800a,0xe41dc07b },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x90000000,0xa8000000,0x4c000000,0x4e000000,0x97000000,0xc5800000,0x7d400000,0xa7600000,0x3bf00000,0x55280000,0xf8040000,0x84020000,0xb2010000,0xe1048000,0xb6854000,0xbac26000,0x03227000,0xce14b800,0xd61e2c00,0x770fea00,0xe0933b00,0x58dadf80,0xfe2b2940,0x2b800020,0x3a400010,0xeae00008,0x9ab00024,0x1448002a,0x18f40013 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x10000000,0x38000000,0x8c000000,0x5a000000,0x21000000,0x3b800000,0x38400000,0xcbe00000,0x69f00000,0x2d980000,0x2c040000,0x6a060000,0xe9070000,0x9f808000,0xd641c000,0x3ce46000,0x2972d000,0x0f590800,0xe425dc00,0xf057c200,0x66895f00,0xf7efcf80,0xbddaacc0,0x93e00020,0x35f00030,0xaf980038,0x91040004,0x3386000e,0x7c470023 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xc8000000,0xdc000000,0x4a000000,0x4f000000,0x53800000,0xe2c00000,0x86600000,0x10f00000,0x7ed80000,0xb4040000,0xe6020000,0xed010000,0xf0818000,0x33464000,0xf7a6e000,0x8f125000,0xc3ea7800,0x1f3e9c00,0xa0311600,0xf3bf3300,0xb9740780,0x5b1e36c0,0x9de00020,0x6e300010,0x92b80008,0xdbf4000c,0x035a0032,0x67c50037 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xd0000000,0x28000000,0x34000000,0x6a000000,0xa5000000,0xda800000,0x10c00000,0xd5200000,0xc6900000,0xfcf80000,0x02040000,0xf1060000,0xc0850000,0x4dc68000,0x13a14000,0x8851a000,0xe6db5000,0xbb112800,0xc7b8d400,0x07618600,0xaf762900,0xe94a7480,0x3b6cc7c0,0x06780020,0x02c40030,0xac260028,0xe2150034,0xf33e800a,0x80a5400d },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xd0000000,0xd8000000,0xe4000000,0xbe000000,0x37000000,0xdd800000,0x3d400000,0xf3200000,0x6bd00000,0x3c480000,0xba040000,0x99060000,0x52830000,0xd4c68000,0xa866c000,0x4bf72000,0x341df000,0x8c0db800,0x0da4ec00,0x9d14ea00,0x492a1900,0xad771e80,0x46de0240,0x97680020,0xf5d40030,0x7b4e0018,0x0f870034,0x48408036,0x23a5c039 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x90000000,0x28000000,0x84000000,0xda000000,0x23000000,0x31800000,0xcec00000,0x2aa00000,0x96100000,0x4b580000,0xae040000,0xa1060000,0x0e810000,0x19448000,0xb1614000,0xf0342000,0xdb0ed000,0x13bd1800,0x4cf38c00,0x96a97600,0x4e28d500,0x7a6b7080,0x0b8c3ac0,0x33f80020,0xcf140030,0x09de0008,0x59450024,0x5162800a,0x40304021 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x38000000,0x84000000,0x56000000,0x27000000,0x2b800000,0xc7c00000,0x4f600000,0xd9900000,0xdfb80000,0x77040000,0xf3820000,0x73c50000,0xb1648000,0x4291c000,0x263c2000,0xc1c6b000,0xb0633800,0x46145c00,0xe67abe00,0xa367bb00,0xd390ec80,0x1ab94dc0,0x85820020,0x84c50010,0x02e48028,0x9151c024,0x075c200e,0xbb56b021 },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x10000000,0xf8000000,0x3c000000,0x5a000000,0x1b000000,0xa8800000,0x1c400000,0x7b600000,0x81100000,0x4f080000,0xab040000,0x80860000,0xf8410000,0x0d608000,0x3817c000,0xc089e000,0x45c6d000,0xfca6d800,0xaab44400,0xdf386200,0xa7781b00,0x6a1fe880,0x720ba840,0xa2860020,0x1f410030,0xdfe08008,0x2f57c004,0xeb69e03e,0xe496d00f },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0x28000000,0x3c000000,0xd2000000,0x7b000000,0xef800000,0x48400000,0xc9200000,0x88100000,0x90a80000,0xa3040000,0x8b820000,0xbe450000,0xe4248000,0xda914000,0xa269e000,0x64e29000,0x1671d800,0xc81a7c00,0xdefac200,0x23890900,0x2c16a080,0x86a99540,0xbe020020,0x61050010,0x98848028,0xcdc14024,0xee61e00a,0x40b6900f },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0xb0000000,0xf8000000,0xbc000000,0xc2000000,0x57000000,0xc0800000,0x30c00000,0x82200000,0x28b00000,0x66380000,0xcb040000,0x72860000,0x3fc50000,0x4ea58000,0x2277c000,0x0f1de000,0xe1321000,0x737cb800,0xb6670400,0x24520600,0xf9aed100,0xa20d2580,0xd7f8e1c0,0x88a60020,0x6b750030,0x4a9d8028,0x0e73c02c,0x451be03e,0x5237102f },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x70000000,0x88000000,0x0c000000,0xca000000,0x37000000,0x2b800000,0x9d400000,0xd2e00000,0x56b00000,0x55c80000,0xeb040000,0x39820000,0x3e430000,0xc7638000,0xb2f44000,0x5da86000,0xf6725000,0x3f6bb800,0xe7d65c00,0xb23d6a00,0xb62dd700,0x4b375580,0xfd89be40,0x49620020,0x63f30010,0x9b2b8018,0x8fb0401c,0xdf4a6022,0x38c15003 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x50000000,0x38000000,0x54000000,0x12000000,0xed000000,0x9c800000,0x89400000,0x8a600000,0x07500000,0xc1380000,0x91040000,0x82860000,0xd2450000,0x81e28000,0x9391c000,0x189aa000,0x6a749000,0xbf096800,0x90ede400,0x507cca00,0xdf629300,0x0fd31a80,0xfa78d9c0,0xa6660020,0x21550030,0xce3a8028,0x8885c014,0xfb44a00e,0x97659015 },
+	{ 0x00000000,0x80000000,0x40000000,0x60000000,0x90000000,0x48000000,0x14000000,0x6e000000,0xc9000000,0xf3800000,0xd4c00000,0x89e00000,0xbb100000,0x7eb80000,0xe5040000,0x11820000,0x4fc30000,0x59648000,0x73524000,0x0d18a000,0x9eb77000,0x400c4800,0x15089c00,0xbc8c2600,0x3f4b0f00,0x542cf880,0x947b45c0,0xcde20020,0xbd130010,0x53bc8018,0xa0864024,0x5042a012,0x4fa07005 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x90000000,0xf8000000,0x4c000000,0x76000000,0x07000000,0xb5800000,0x5f400000,0x91e00000,0x80900000,0xb2980000,0xb1040000,0x52820000,0xdac50000,0xa6a48000,0xa577c000,0x080a6000,0x729fb000,0x51063800,0x6282ac00,0xb2c37a00,0x12a7cf00,0x9f71a480,0x790c44c0,0xc01a0020,0xbbc10010,0xac268028,0xa3b2c024,0x20aee03e,0x9ce87013 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0xf0000000,0xb8000000,0xfc000000,0x26000000,0xe3000000,0xc1800000,0xcec00000,0x3ce00000,0x41900000,0xe9780000,0xb5040000,0x5a860000,0x93430000,0x24278000,0x2675c000,0x956fe000,0xb4bd3000,0x30651800,0x49d30c00,0x90daf600,0x8bb7a700,0xa80e2c80,0x5bee9bc0,0x15fe0020,0x05470030,0xdf218018,0x8bf6c03c,0x35a8602e,0x2f58f03f },
+	{ 0x00000000,0x80000000,0xc0000000,0x20000000,0x50000000,0xb8000000,0x64000000,0x7a000000,0xf5000000,0xb5800000,0xd7c00000,0x78600000,0xdff00000,0xca580000,0x6b040000,0xfa860000,0xb7410000,0x4a228000,0xc855c000,0x09cb2000,0x04afd000,0xaedda800,0x9346ac00,0xd0233e00,0x4d558300,0x544a9f80,0x0f6f62c0,0xc8be0020,0xc3b50030,0x5afc8008,0x4410c014,0x016fa02e,0x1fbb1019 },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x10000000,0x28000000,0x6c000000,0xa2000000,0x55000000,0x89800000,0x0c400000,0x1d600000,0xcdb00000,0x25580000,0x73040000,0xf2820000,0xc2c50000,0xf5a08000,0x11114000,0x37cb6000,0x71891000,0xb5eca800,0xe3df4c00,0xa7c3e200,0x04262b00,0xf951cd80,0xf4ae9ac0,0x633a0020,0x20310010,0xb71a8028,0x11604004,0x9fb1e00a,0xe859501b },
+	{ 0x00000000,0x80000000,0x40000000,0xa0000000,0x70000000,0xb8000000,0xd4000000,0xaa000000,0x6b000000,0xff800000,0xc2c00000,0x9e200000,0x44500000,0xf5980000,0xaf840000,0x4ac20000,0x52250000,0x4a538000,0x8c9dc000,0xef02a000,0xdd875000,0x65c65800,0x6fa47c00,0xff93d600,0x2b3a5100,0x7c937280,0x88bef4c0,0xd8538020,0x739dc010,0x1a82a028,0x0447501c,0xbc66582e,0x3d347c35 },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x10000000,0x48000000,0x54000000,0x96000000,0xdb000000,0x1d800000,0x79400000,0xd9600000,0xf0500000,0x22a80000,0xb5840000,0xfd460000,0x67630000,0x6f508000,0xe12a4000,0x43c6a000,0xafa2b000,0x3575d800,0x89186c00,0xddbd8a00,0x454e6b00,0x8d123280,0x85ca4d40,0xbad08020,0x0c6a4030,0x6ca6a018,0x94f2b004,0x425dd812,0x11dc6c15 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0x68000000,0xa4000000,0x26000000,0x8f000000,0x92800000,0x61c00000,0xfce00000,0x6ff00000,0x89780000,0xa6840000,0xefc60000,0x77e50000,0xcb708000,0x0fbb4000,0x6ce12000,0xc7f73000,0x8d797800,0x90801400,0x08c64e00,0x4167c700,0x8cb2cf80,0x7c5b73c0,0x91908020,0x2f4b4030,0xd7192028,0x10b33004,0xf65f781a,0x2c951429 },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xf0000000,0xa8000000,0x34000000,0x2a000000,0xc3000000,0x6b800000,0x67400000,0x41600000,0x83300000,0x49280000,0x0f840000,0x35460000,0x0e670000,0xaeb78000,0x5b6d4000,0xf865a000,0x53b75000,0xc9e91800,0x6fa0dc00,0x82107a00,0x72fcab00,0x0ddec980,0xef0b1140,0x0dd78020,0x1f5d4030,0xb8cda038,0x3c73503c,0x544f182a,0x72b7dc0d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x30000000,0xe8000000,0xcc000000,0x5e000000,0x39000000,0x43800000,0x8fc00000,0x75e00000,0x68900000,0x10e80000,0x97840000,0x95c20000,0xcee10000,0x94118000,0xc1af4000,0xbc226000,0x6070f000,0xb9f8c800,0xb7af9c00,0x29253e00,0x6df6cf00,0xd7393480,0xa5cb8f40,0x5c718020,0x6fff4010,0x52aa6008,0xeca4f00c,0xff32c83a,0x735a9c33 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x10000000,0x48000000,0x34000000,0xe2000000,0xaf000000,0xdf800000,0x1cc00000,0x52200000,0xfed00000,0xbaa80000,0x7d840000,0xd3c60000,0x3da50000,0xba108000,0x948a4000,0x5555a000,0x24691000,0x30a47800,0xaa907c00,0xe7cfa600,0x43b7b100,0xf49ca680,0xa2d80d40,0x20b88020,0x390e4030,0x6e93a028,0x3dcc1004,0x20b4f812,0xa51a3c0d },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0xb0000000,0x88000000,0xa4000000,0x4a000000,0x5f000000,0x94800000,0x90c00000,0x71e00000,0x89f00000,0x4a980000,0x9a840000,0x55c20000,0xa2610000,0x11b58000,0xcdbc4000,0xd3912000,0x17285000,0x293ff800,0xab572400,0x52cbc600,0xd2ce2f00,0x92c9df80,0xb2ceccc0,0x02cd8020,0x8ac84010,0x2ecb2008,0x64cd502c,0x3bc87822,0xaf4a6429 },
+	{ 0x00000000,0x80000000,0xc0000000,0xa0000000,0x30000000,0xb8000000,0x2c000000,0x2e000000,0xe7000000,0x2e800000,0xa6c00000,0x58e00000,0x61b00000,0xf8c80000,0x5c840000,0xb7c60000,0x2d650000,0x4ff18000,0x75edc000,0x49556000,0x417f7000,0x184e3800,0x4d42f400,0xe9a3f600,0x4e172700,0x55de3d80,0xadd85e40,0xe1d98020,0x5fd9c030,0x30db6028,0x8a5e700c,0x2e99b82e,0xbf7a340b },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0x88000000,0xec000000,0x1a000000,0xb5000000,0x46800000,0xf7c00000,0xe3200000,0x1c900000,0x35780000,0x88840000,0x7cc20000,0x06a70000,0x32d18000,0x5a1c4000,0x2a736000,0x5bcad000,0xf1eea800,0xa9fdb400,0x6a42fe00,0x0964f900,0x55f2f480,0x808ea3c0,0x38098020,0xccc84010,0x26696038,0x0eb9d00c,0xe1a52822,0x8d52f43b },
+	{ 0x00000000,0x80000000,0xc0000000,0x60000000,0x50000000,0xf8000000,0xec000000,0xa2000000,0xcd000000,0x7a800000,0x86400000,0x83200000,0x3e500000,0x38b80000,0x67840000,0xc4c60000,0x89630000,0x4f728000,0x33efc000,0xc9bb6000,0x87071000,0x03836800,0x82c25400,0xc2617200,0x1ef4b900,0xb42b8280,0x355ebdc0,0xa9b48020,0xb78cc030,0x9c49e018,0x62a8d014,0xb118083e,0xd795443b },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0x50000000,0x88000000,0x34000000,0x12000000,0x4f000000,0x08800000,0x2e400000,0x00a00000,0x8a300000,0xc3b80000,0x6f840000,0x62c60000,0x04e70000,0x29928000,0xef0c4000,0xeb7da000,0x58629000,0x85d37800,0xc8adc400,0x0dcbb200,0x2f9fe500,0x91f06180,0x3adf75c0,0xabd48020,0x61ab4030,0xb84f2038,0x165ed014,0x3f96d822,0xaa0b540d },
+	{ 0x00000000,0x80000000,0xc0000000,0xe0000000,0xd0000000,0x38000000,0xd4000000,0x7a000000,0x91000000,0x06800000,0x47400000,0x96600000,0x3b300000,0x5ba80000,0x1f840000,0xbdc60000,0xa7270000,0x42568000,0xb519c000,0x40eaa000,0x0fe1d000,0x61f58800,0x1509b400,0xcf117a00,0x9a7dd300,0x715fa980,0x6d090540,0x3b108020,0xd07ec030,0x085c2038,0x87881034,0xd257280e,0xad1c6435 },
+	{ 0x00000000,0x80000000,0x40000000,0xe0000000,0x30000000,0xf8000000,0x4c000000,0x8a000000,0xd9000000,0x17800000,0x6e400000,0xeca00000,0x2a100000,0x8b180000,0x6a840000,0xd7c20000,0xb5e70000,0x06318000,0x3fcfc000,0x6bfe6000,0x51325000,0x8f4bc800,0xed3a3c00,0xa7533200,0x113fc500,0x9555e080,0x643a80c0,0x38d38020,0x2b78c010,0x8ff7e038,0xe529900c,0x314fa83e,0xb23b6c13 },
+	{ 0x00000000,0x80000000,0x40000000,0x20000000,0x10000000,0xc8000000,0x24000000,0x2e000000,0xe1000000,0xc0800000,0x9d400000,0x4b600000,0xea300000,0x84880000,0x8f840000,0xfcc20000,0x36a10000,0x2c108000,0xedde4000,0xc53d2000,0xd9cf7000,0xa4e00800,0x26f58400,0x6a2b2a00,0x4f91bb00,0x1b1b4180,0x3c9e7c40,0xd45a8020,0x14fb4010,0x35efa008,0x12b03004,0x85cda832,0x36e4b409 }
+};
+
+}
@@ -0,0 +1,34 @@
+/********************************************************/
+// FILE: SobolDirections.h
+// DESCRIPTION: Sobol direction numbers, generated by projects/scripts/GenerateSobolDirections.py
+// AUTHOR: Jan Schmid (jaschmid@eml.cc)    
+/********************************************************/
+// This work is licensed under the Creative Commons 
+// Attribution-NonCommercial 3.0 Unported License. 
+// To view a copy of this license, visit 
+// http://creativecommons.org/licenses/by-nc/3.0/ or send 
+// a letter to Creative Commons, 444 Castro Street, 
+// Suite 900, Mountain View, California, 94041, USA.
+/********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_SOBOL_DIRECTIONS_GUARD
+#define RAYTRACE_SOBOL_DIRECTIONS_GUARD
+
+#include <RaytraceCommon.h>
+
+namespace Raytrace {
+
+static const size_t SobolDirectionDimensions = 512;
+static const size_t SobolDirectionBits = 32;
+
+// row d holds the direction numbers v_1 .. v_bits of dimension d at index 1 .. bits, index 0 is unused
+extern const u32 __data_sobolDirections[SobolDirectionDimensions][SobolDirectionBits+1];
+
+}
+
+#endif
@@ -25,9 +25,7 @@
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_01.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
-#include <strstream>
-
-extern const char* __data_sobolBasis[];
+#include "SobolDirections.h"
 
 namespace Raytrace {
 
@@ -37,12 +35,12 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 	typedef _SceneReader SceneReader;
 
 	// dimensions after this will return random monte carlo numbers
-	const static size_t NumDimensions = 512;
-	const static size_t MaxBits	= 16;
+	const static size_t NumDimensions = SobolDirectionDimensions;
+	// passes per pixel before the sequence repeats
+	const static size_t MaxBits	= SobolDirectionBits;
 	
 	const static size_t NumJitterValues = 1024;
 
-	struct SobolSequence;
 	typedef SamplerBase<_SampleData,_SceneReader> Base;
 
 
@@ -58,25 +56,9 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 	{
 		InitializeSampler(numThreads,scene,sampleData,scene->getMultisampleCount());
 
-		LoadSobolMatrices();
-
 		_sampleData->setSampleGenerator(this);
 				
 		_threadData.resize(numThreads);
-
-		_lastSequenceIdx = 0;
-		_currentSequenceIdx = 1;
-		_sampleIdx = 1;
-		GenerateInitialSobolSequence(_sequences[_lastSequenceIdx]);
-		NextSobolSequence(_sequences[_lastSequenceIdx],_sequences[_currentSequenceIdx]);
-		/*
-		while(true)
-		{
-			NextSobolSequence(_sequences[_lastSequenceIdx],_sequences[_currentSequenceIdx]);
-			size_t temp = _lastSequenceIdx;
-			_lastSequenceIdx = _currentSequenceIdx;
-			_currentSequenceIdx = temp;
-		}*/
 		
 		boost::random::mt11213b							randomGenerator; 
 		boost::random::uniform_int_distribution<u32>	randomUniformDistribution;
@@ -85,24 +67,6 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 			_jitters[i] = randomUniformDistribution(randomGenerator);
 	}
 	
-	f32 GenerateCompleteST() 
-	{
-		f32 stat = Base::GenerateCompleteST();
-
-		if(_numGeneratedSamples/_finalImage.size() > _sampleIdx)
-		{
-			//generate next idx
-			_sampleIdx++;
-			size_t temp = _lastSequenceIdx;
-			_lastSequenceIdx = _currentSequenceIdx;
-			_currentSequenceIdx = temp;
-			NextSobolSequence(_sequences[_lastSequenceIdx],_sequences[_currentSequenceIdx]);
-		}
-		assert(_numGeneratedSamples/_finalImage.size() <= _sampleIdx);
-
-		return stat;
-	}
-
 	static inline Real frac(Real in)
 	{
 		Real dummy;
@@ -136,7 +100,7 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 		return result;
 	}
 
-	inline Vector2 getRandomValue2D(size_t sampleIndex,size_t randomIndex)
+	inline Vector2 getRandomValue2D(up sampleIndex,size_t randomIndex)
 	{
 		return Vector2(getRandomValue(sampleIndex,NumDimensions/2 + (randomIndex*2)+0),getRandomValue(sampleIndex,NumDimensions/2 + (randomIndex*2)+1));
 	}
@@ -151,16 +115,24 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 		return a;
 	}
 
-	inline Real getRandomValue(size_t sampleIndex,size_t randomIndex)
+	// gray code order, point i is the xor of the direction numbers of the bits set in i ^ (i >> 1)
+	inline u32 getSobolValue(u32 sequenceIndex,size_t dimension) const
 	{
-		size_t sequenceIndex = (u32)(sampleIndex / _finalImage.size());
-		if(sequenceIndex == _sampleIdx)
-			sequenceIndex = _currentSequenceIdx;
-		else
-		{
-			assert(sequenceIndex == _sampleIdx -1);
-			sequenceIndex = _lastSequenceIdx;
-		}
+		const u32* directions = __data_sobolDirections[dimension];
+		u32 gray = sequenceIndex ^ (sequenceIndex >> 1);
+		u32 result = 0;
+
+		for(size_t iB = 1; gray; gray >>= 1, ++iB)
+			if(gray & 1)
+				result ^= directions[iB];
+
+		return result;
+	}
+
+	inline Real getRandomValue(up sampleIndex,size_t randomIndex)
+	{
+		assert(sampleIndex / _finalImage.size() <= 0xffffffff);
+		const u32 sequenceIndex = (u32)(sampleIndex / _finalImage.size());
 		sampleIndex %= _finalImage.size();
 		u32 jitter1=_jitters[hash((u32)sampleIndex)%NumJitterValues];
 		
@@ -172,7 +144,7 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 
 		u32 jitter2=_jitters[hash( (u32)(sampleIndex+randomIndex))%NumJitterValues];
 
-		return mixup(_sequences[sequenceIndex]._X[ dimension_index %NumDimensions], jitter2 );
+		return mixup(getSobolValue(sequenceIndex,dimension_index %NumDimensions), jitter2 );
 	}
 
 	typename SampleData::SampleValue2DType getSampleLocation2D(const typename SampleData::SampleInput& sample,typename SampleData::SampleIndexType random_index,size_t threadId)
@@ -208,83 +180,6 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 		return getRandomValue(sample._index,random_index);
 	}
 
-	inline void GenerateInitialSobolSequence(SobolSequence& sequence)
-	{
-		boost::random::uniform_int_distribution<u32>	randomUniformDistribution;
-		boost::random::mt11213b					randomGenerator; 
-
-		sequence._i = 0;
-		sequence._C = 1;
-
-		for(size_t iD = 0; iD < NumDimensions; iD++)
-		{
-			sequence._X[iD] = 0;//randomUniformDistribution(randomGenerator);
-		}
-	}
-
-	inline void NextSobolSequence(const SobolSequence& sequenceIn,SobolSequence& sequence)
-	{
-		sequence._i = sequenceIn._i +1;
-
-		// generate C
-
-		sequence._C = 1;
-		u32 val = sequence._i;
-		while(val & 1)
-		{
-			val >>= 1;
-			sequence._C++;
-		}
-
-		// generate X's and values
-
-		for(size_t iD = 0; iD < NumDimensions; iD++)
-		{
-			/*
-			u32 i = sequence._i;
-			sequence._X[iD] = 0;
-
-			for(u32 j = 0; i; i >>= 1, j++)
-				if(i & 1)
-					sequence._X[iD] ^= _sobolMatrices[iD]._V[j];
-					*/
-			sequence._X[iD] = sequenceIn._X[iD] ^ _sobolMatrices[iD]._V[sequenceIn._C];
-		}
-	}
-
-	inline void LoadSobolMatrices()
-	{
-
-		_sobolMatrices[0]._d = 0; //?
-		_sobolMatrices[0]._s = 0; //?
-		_sobolMatrices[0]._a = 0; //?
-		for(int iB = 0; iB < MaxBits; iB++)
-			_sobolMatrices[0]._V[iB] = 1 << (32 - iB);
-
-		for(int iD = 1; iD < NumDimensions; iD++)
-		{
-			std::istrstream infile(__data_sobolBasis[iD-1]);
-			infile >> _sobolMatrices[iD]._d >> _sobolMatrices[iD]._s >> _sobolMatrices[iD]._a;
-			size_t iB = 1;
-			//load basic dimensions
-			for(; iB <= _sobolMatrices[iD]._s; iB++)
-			{
-				u32 m;
-				infile >> m;
-				_sobolMatrices[iD]._V[iB] = m << (32 - iB);
-			}
-			//generate additional dimensions that might be lacking
-			for(; iB < MaxBits+1; iB++)
-			{
-				size_t i_Vin_s = iB - _sobolMatrices[iD]._s;
-				_sobolMatrices[iD]._V[iB] = _sobolMatrices[iD]._V[i_Vin_s] ^ (_sobolMatrices[iD]._V[i_Vin_s] >> _sobolMatrices[iD]._s);
-				
-				for(size_t k = 1; k < _sobolMatrices[iD]._s; ++k)
-					_sobolMatrices[iD]._V[iB] ^= ((( _sobolMatrices[iD]._a >> (_sobolMatrices[iD]._s-1-k)) & 1) * _sobolMatrices[iD]._V[iB-k]); 
-			}
-		}
-	}
-
 	struct ThreadData
 	{
 		boost::random::uniform_01<Real,Real>	_randomUniformDistribution;
@@ -292,31 +187,8 @@ template<class _SampleData,class _SceneReader> struct SobolSampler : public Samp
 	};
 
 	
-	struct SobolMatrix
-	{
-		u32 _d;
-		u32 _s;
-		u32 _a;
-		std::array<u32,MaxBits+1>	_V;
-	};
-
-	struct SobolSequence
-	{
-		u32								_i;
-		u32								_C;
-		std::array<u32,NumDimensions>	_X;
-		std::array<Real,NumDimensions>	_value;
-	};
-
-	std::array<SobolMatrix,NumDimensions>	_sobolMatrices;
-	std::array<SobolSequence,2>				_sequences;
 	std::array<u32,NumJitterValues>			_jitters;
 
-	size_t									_sampleIdx;
-
-	size_t									_lastSequenceIdx;
-	size_t									_currentSequenceIdx;
-
 	std::vector<ThreadData>			_threadData;
 };
 
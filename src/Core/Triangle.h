@@ -24,6 +24,9 @@ namespace Raytrace {
 	
 	struct TriangleBaseModePoints;
 	struct TriangleBaseModeBarycentricPlane;
+	struct TriangleBaseModeEdges;
+	struct TriangleBaseModeAffineTransform;
+	struct TriangleBaseModeAnalytic;
 	template<class _Type> struct TriangleScalarType;
 	template<int _Dimension> struct TriangleDimensions;
 	template<class _Type> struct TriangleUserDataType;
@@ -46,6 +49,39 @@ namespace Raytrace {
 		typedef Tag_TriangleBaseMode Tag;
 		static const bool optionsDefined = true;
 	};
+
+	// first point and the two edges leaving it
+	struct TriangleBaseModeEdges
+	{
+		typedef Tag_TriangleBaseMode Tag;
+		static const bool optionsDefined = true;
+	};
+
+	// world to barycentric space transform, the column of the dominant normal axis is implicit
+	struct TriangleBaseModeAffineTransform
+	{
+		typedef Tag_TriangleBaseMode Tag;
+		static const bool optionsDefined = true;
+	};
+
+	// first point, the two edges leaving it and the shape the three points describe
+	struct TriangleBaseModeAnalytic
+	{
+		typedef Tag_TriangleBaseMode Tag;
+		static const bool optionsDefined = true;
+	};
+
+	// analytic shapes are stored in the three points of a triangle
+	// quad: a corner and its two neighbours, the fourth corner is implied
+	// disk: center and two rim points at right angles to each other
+	// sphere: center and two surface points at right angles to each other
+	enum PrimitiveShape
+	{
+		PrimitiveShapeTriangle = 0,
+		PrimitiveShapeQuad = 1,
+		PrimitiveShapeDisk = 2,
+		PrimitiveShapeSphere = 3
+	};
 	
 	// Triangle Base Mode
 
@@ -130,10 +166,81 @@ namespace Raytrace {
 			};
 		};
 
+		// lanes where x or y is the component of largest magnitude, lanes with neither pick z
+		template<class _Vector> inline void findDominantAxis(const _Vector& v,typename _Vector::Scalar::Boolean& isX,typename _Vector::Scalar::Boolean& isY)
+		{
+			const typename _Vector::Scalar x = v.x().Absolute();
+			const typename _Vector::Scalar y = v.y().Absolute();
+			const typename _Vector::Scalar z = v.z().Absolute();
+
+			isX = (x >= y) & (x >= z);
+			isY = (y > x) & (y >= z);
+		}
+
+		// cyclic rotation of the components that moves the chosen axis to z
+		template<class _Vector> inline _Vector rotateToAxis(const _Vector& v,const typename _Vector::Scalar::Boolean& isX,const typename _Vector::Scalar::Boolean& isY)
+		{
+			typedef typename _Vector::Scalar Scalar;
+
+			return _Vector(
+				Scalar::Condition(isX,v.y(),Scalar::Condition(isY,v.z(),v.x())),
+				Scalar::Condition(isX,v.z(),Scalar::Condition(isY,v.x(),v.y())),
+				Scalar::Condition(isX,v.x(),Scalar::Condition(isY,v.y(),v.z()))
+				);
+		}
+
+		// only single triangles carry a shape, wide storage modes read it from the triangles they are built from
+		template<class _Scalar> struct TriangleShape
+		{
+			inline TriangleShape() : _shape(PrimitiveShapeTriangle)
+			{
+			}
+
+			template<class _BaseTriangle> inline TriangleShape(const _BaseTriangle& tri) : _shape(tri.shape())
+			{
+			}
+
+			template<class _Array,class _Element,int _Size,class _Reader,class _Modifier,class _Adapter> 
+			inline TriangleShape(const ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>& arrayBase) : _shape(arrayBase[0].shape())
+			{
+			}
+
+			inline PrimitiveShape shape() const
+			{
+				return _shape;
+			}
+
+			inline void setShape(PrimitiveShape shape)
+			{
+				_shape = shape;
+			}
+
+		private:
+
+			PrimitiveShape _shape;
+		};
+
+		template<class _Base,int _Width> struct TriangleShape<SimdType<_Base,_Width>>
+		{
+			inline TriangleShape()
+			{
+			}
+
+			template<class _BaseTriangle> inline TriangleShape(const _BaseTriangle& tri)
+			{
+			}
+
+			inline PrimitiveShape shape() const
+			{
+				return PrimitiveShapeTriangle;
+			}
+		};
+
 		// Signature
 		template<class _Scalar,class _Dimension,class _BaseMode> struct TriangleBase;
 
 		template<class _Scalar,int _Dimension> struct TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModePoints>
+			: public TriangleShape<_Scalar>
 		{
 			typedef Triangle<>	Minimum;
 			typedef PrimitiveClassTriangle PrimitiveClass;
@@ -155,7 +262,7 @@ namespace Raytrace {
 			{
 			}
 
-			template<class _BaseTriangle> inline TriangleBase(const _BaseTriangle& tri)
+			template<class _BaseTriangle> inline TriangleBase(const _BaseTriangle& tri) : TriangleShape<_Scalar>(tri)
 			{
 				_points[0] = ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<_BaseTriangle,void,0,FTrianglePointReader<0>>(tri));
 				_points[1] = ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<_BaseTriangle,void,0,FTrianglePointReader<1>>(tri));
@@ -269,6 +376,196 @@ namespace Raytrace {
 			Scalar_T _v_d;
 		} ;
 
+		template<class _Scalar,int _Dimension> struct TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeEdges>
+		{
+			typedef Triangle<>	Minimum;
+			typedef PrimitiveClassTriangle PrimitiveClass;
+			typedef Eigen::Matrix<_Scalar,_Dimension,1> Vector_T;
+			typedef Eigen::Matrix<_Scalar,2,1> Vector2_T;
+			typedef Vector2_T RelativeLocation;
+			typedef _Scalar Element;
+			typedef Element Scalar_T;
+			typedef TriangleBaseModeEdges TriangleBaseMode;
+			static const int Dimensions = _Dimension;
+			typedef TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeEdges> ThisType;
+
+			template<class _Options> struct adapt
+			{
+				typedef Triangle<_Options> type;
+			};
+		
+			inline TriangleBase()
+			{
+			}
+
+			template<class _Scalar2,int _Dimension2> inline TriangleBase(const  TriangleBase<TriangleScalarType<_Scalar2>,TriangleDimensions<_Dimension2>,TriangleBaseModePoints>& triBase)
+			{
+				static_assert(_Dimension2 == Dimensions, "Triangle Dimensions don't match!");
+				initialize(triBase.point(0),triBase.point(1),triBase.point(2));
+			}
+			
+			template<class _Array,class _Element,int _Size,class _Reader,class _Modifier,class _Adapter> 
+			inline TriangleBase(const ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>& arrayBase)
+			{
+				initialize(
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<0>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<1>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<2>>(arrayBase))
+					);
+			}
+
+			ALIGN_SIMD Vector_T _p0;
+			Vector_T _e1;
+			Vector_T _e2;
+
+		private:
+
+			inline void initialize(const Vector_T& p0,const Vector_T& p1,const Vector_T& p2)
+			{
+				_p0 = p0;
+				_e1 = p1 - p0;
+				_e2 = p2 - p0;
+			}
+		} ;
+		
+		template<class _Scalar,int _Dimension> struct TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeAffineTransform>
+		{
+			typedef Triangle<>	Minimum;
+			typedef PrimitiveClassTriangle PrimitiveClass;
+			typedef Eigen::Matrix<_Scalar,_Dimension,1> Vector_T;
+			typedef Eigen::Matrix<_Scalar,2,1> Vector2_T;
+			typedef Vector2_T RelativeLocation;
+			typedef _Scalar Element;
+			typedef Element Scalar_T;
+			typedef TriangleBaseModeAffineTransform TriangleBaseMode;
+			static const int Dimensions = _Dimension;
+			typedef TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeAffineTransform> ThisType;
+
+			static_assert(_Dimension == 3, "Affine transform triangles are three dimensional");
+
+			template<class _Options> struct adapt
+			{
+				typedef Triangle<_Options> type;
+			};
+		
+			inline TriangleBase()
+			{
+			}
+
+			template<class _Scalar2,int _Dimension2> inline TriangleBase(const  TriangleBase<TriangleScalarType<_Scalar2>,TriangleDimensions<_Dimension2>,TriangleBaseModePoints>& triBase)
+			{
+				static_assert(_Dimension2 == Dimensions, "Triangle Dimensions don't match!");
+				initialize(triBase.point(0),triBase.point(1),triBase.point(2));
+			}
+			
+			template<class _Array,class _Element,int _Size,class _Reader,class _Modifier,class _Adapter> 
+			inline TriangleBase(const ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>& arrayBase)
+			{
+				initialize(
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<0>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<1>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<2>>(arrayBase))
+					);
+			}
+
+			// rows of the transform in the rotated frame of _axis: x, y and translation,
+			// the z column is (0,0,1) and not stored
+			ALIGN_SIMD Vector_T _u;
+			Vector_T _v;
+			Vector_T _n;
+			Scalar_T _axis;
+
+		private:
+
+			inline void initialize(const Vector_T& p0,const Vector_T& p1,const Vector_T& p2)
+			{
+				const Vector_T e1(p1 - p0);
+				const Vector_T e2(p2 - p0);
+				
+				typename Scalar_T::Boolean isX,isY;
+				findDominantAxis(Vector_T(e1.cross(e2)),isX,isY);
+
+				const Vector_T re1 = rotateToAxis(e1,isX,isY);
+				const Vector_T re2 = rotateToAxis(e2,isX,isY);
+				const Vector_T rn = rotateToAxis(Vector_T(e1.cross(e2)),isX,isY);
+				const Vector_T rp0 = rotateToAxis(p0,isX,isY);
+				
+				const Scalar_T inv_n_z = rn.z().ReciprocalHighPrecision();
+
+				_u.x() = re2.y() * inv_n_z;
+				_u.y() = -re2.x() * inv_n_z;
+				_u.z() = -( _u.x() * rp0.x() + _u.y() * rp0.y() );
+				
+				_v.x() = -re1.y() * inv_n_z;
+				_v.y() = re1.x() * inv_n_z;
+				_v.z() = -( _v.x() * rp0.x() + _v.y() * rp0.y() );
+				
+				_n.x() = rn.x() * inv_n_z;
+				_n.y() = rn.y() * inv_n_z;
+				_n.z() = -( _n.x() * rp0.x() + _n.y() * rp0.y() + rp0.z() );
+
+				_axis = Scalar_T::Condition(isX,Scalar_T::Zero(),Scalar_T::Condition(isY,Scalar_T::One(),Scalar_T(2.0f)));
+			}
+		} ;
+
+		template<class _Scalar,int _Dimension> struct TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeAnalytic>
+		{
+			typedef Triangle<>	Minimum;
+			typedef PrimitiveClassTriangle PrimitiveClass;
+			typedef Eigen::Matrix<_Scalar,_Dimension,1> Vector_T;
+			typedef Eigen::Matrix<_Scalar,2,1> Vector2_T;
+			typedef Vector2_T RelativeLocation;
+			typedef _Scalar Element;
+			typedef Element Scalar_T;
+			typedef TriangleBaseModeAnalytic TriangleBaseMode;
+			static const int Dimensions = _Dimension;
+			typedef TriangleBase<TriangleScalarType<_Scalar>,TriangleDimensions<_Dimension>,TriangleBaseModeAnalytic> ThisType;
+
+			template<class _Options> struct adapt
+			{
+				typedef Triangle<_Options> type;
+			};
+		
+			inline TriangleBase()
+			{
+			}
+
+			template<class _Scalar2,int _Dimension2> inline TriangleBase(const  TriangleBase<TriangleScalarType<_Scalar2>,TriangleDimensions<_Dimension2>,TriangleBaseModePoints>& triBase)
+			{
+				static_assert(_Dimension2 == Dimensions, "Triangle Dimensions don't match!");
+				initialize(triBase.point(0),triBase.point(1),triBase.point(2));
+				_shape = Scalar_T((f32)triBase.shape());
+			}
+			
+			template<class _Array,class _Element,int _Size,class _Reader,class _Modifier,class _Adapter> 
+			inline TriangleBase(const ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>& arrayBase)
+			{
+				initialize(
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<0>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<1>>(arrayBase)),
+					ConvertAoSToSoA<Vector_T>()(ConstArrayWrapper<ConstArrayWrapper<_Array,_Element,_Size,_Reader,_Modifier,_Adapter>,void,0,FTrianglePointReader<2>>(arrayBase))
+					);
+
+				ArrayWrapper<Scalar_T> shapes(_shape);
+				for(auto i = 0; i < ArrayWrapper<Scalar_T>::Size; ++i)
+					shapes[i] = (f32)arrayBase[i].shape();
+			}
+
+			ALIGN_SIMD Vector_T _p0;
+			Vector_T _e1;
+			Vector_T _e2;
+			Scalar_T _shape;
+
+		private:
+
+			inline void initialize(const Vector_T& p0,const Vector_T& p1,const Vector_T& p2)
+			{
+				_p0 = p0;
+				_e1 = p1 - p0;
+				_e2 = p2 - p0;
+			}
+		} ;
+
 		// Signature
 		template<class _Options,class _UserDataType> struct TriangleUserData ;
 		
@@ -389,6 +686,69 @@ namespace Raytrace {
 		public:
 			EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 	};
+
+	// box around whatever shape a single triangle describes
+	template<class _Triangle> inline void getShapeBounds(const _Triangle& tri,typename _Triangle::Vector_T& lower,typename _Triangle::Vector_T& upper)
+	{
+		typedef typename _Triangle::Vector_T Vector_T;
+		typedef typename _Triangle::Scalar_T Scalar_T;
+
+		const Vector_T& p0 = tri.point(0);
+		const Vector_T e1 = tri.point(1) - p0;
+		const Vector_T e2 = tri.point(2) - p0;
+
+		switch(tri.shape())
+		{
+		case PrimitiveShapeSphere:
+			{
+				const Vector_T radius = Vector_T::Constant(e1.norm());
+				lower = p0 - radius;
+				upper = p0 + radius;
+			}
+			break;
+		case PrimitiveShapeDisk:
+			{
+				// the disk reaches r * sin(angle between normal and axis) along each axis
+				const Vector_T normal = e1.cross(e2).normalized();
+				const Scalar_T r = e1.norm();
+				Vector_T radius;
+				for(int d = 0; d < _Triangle::Dimensions; ++d)
+					radius[d] = r * std::sqrt(std::max<Scalar_T>(1.0f - normal[d] * normal[d],0.0f));
+				lower = p0 - radius;
+				upper = p0 + radius;
+			}
+			break;
+		default:
+			{
+				lower = p0.cwiseMin(tri.point(1)).cwiseMin(tri.point(2));
+				upper = p0.cwiseMax(tri.point(1)).cwiseMax(tri.point(2));
+
+				if(tri.shape() == PrimitiveShapeQuad)
+				{
+					lower = lower.cwiseMin(Vector_T(p0 + e1 + e2));
+					upper = upper.cwiseMax(Vector_T(p0 + e1 + e2));
+				}
+			}
+			break;
+		}
+	}
+
+	template<class _Triangle> inline typename _Triangle::Vector_T getShapeCentroid(const _Triangle& tri)
+	{
+		typedef typename _Triangle::Vector_T Vector_T;
+
+		switch(tri.shape())
+		{
+		case PrimitiveShapeSphere:
+		case PrimitiveShapeDisk:
+			return tri.point(0);
+		case PrimitiveShapeQuad:
+			return (tri.point(1) + tri.point(2)) * 0.5f;
+		default:
+			return Vector_T((tri.point(0) + tri.point(1) + tri.point(2)) / 3.0f);
+		}
+	}
+
 	/*
 	struct Triangle
 	{
@@ -51,6 +51,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 		PrimitiveIdentifier		_id;
 		IntersectionAbsolute	_intersectionAbsolute;
 		Vector3					_filter;
+		Real					_time;
 	};
 
 	struct DirectNode
@@ -91,7 +92,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 	
 	void InitializePrepareST(size_t numThreads,const SceneReader& scene,SampleData& sampleData,RayData& rayData) 
 	{
-		InitializeSceneData(scene);
+		InitializeSceneData(numThreads,scene);
 
 		_threads.resize(numThreads);
 		_pathArrays[_readPathArray].prepare(numThreads);
@@ -138,13 +139,16 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 			PathsArrayType& pathWrite = _pathArrays[_writePathArray];
 
 			// create a new indirect node
-			RayType cameraRay = _camera( _sampleData->getSampleValueImageXY(newSample,threadId));
+			newSample._imageXY = _sampleData->getSampleValueImageXY(newSample,threadId);
+			RayType cameraRay = _camera( newSample._imageXY );
+			cameraRay.setTime( _sampleData->getSampleValueTimeT(newSample,threadId));
 
 			size_t nodeId = indirectNodeWrite.size();
 			indirectNodeWrite.push_back(IndirectNode());
 			IndirectNode& node = indirectNodeWrite.back();
 			node._filter = Vector3( 1.0f, 1.0f, 1.0f);
 			node._parentDir = - cameraRay.direction();
+			node._time = cameraRay.time();
 
 			_rayData->pushRay(
 				threadId,
@@ -257,7 +261,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 	{
 		if(node._id != -1)
 		{
-			const PrimitiveData& primitive = _primitives[node._id];
+			const PrimitiveData& primitive = getPrimitiveAt(node._id,node._intersectionAbsolute,node._time);
 			const MaterialSettings& material = _materials[primitive._material];
 
 			// direct lighting (added next step)
@@ -277,6 +281,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 					ray.setOrigin( node._intersectionAbsolute);
 					ray.setDirection( (il->_location-node._intersectionAbsolute).normalized() );
 					ray.setLength( (il->_location-node._intersectionAbsolute).norm() );
+					ray.setTime( node._time );
 
 					_rayData->pushRay(threadId, ray, &direct._shadow);
 				}
@@ -292,6 +297,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 				reflectedRay.setOrigin( node._intersectionAbsolute );
 				reflectedRay.setDirection( reflected );
 				reflectedRay.setLength( -1 );
+				reflectedRay.setTime( node._time );
 				
 				Vector3 reflectFactor = GetReflectedFactor(material,primitive,reflected,node._parentDir) * node._filter.array();
 				
@@ -301,6 +307,7 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 					IndirectNode& newNode = indirectNodeWrite.back();
 					newNode._filter = reflectFactor;
 					newNode._parentDir = - reflected;
+					newNode._time = node._time;
 
 					_rayData->pushRay(
 						threadId,
@@ -347,11 +354,13 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 						refractedRay.setOrigin( node._intersectionAbsolute );
 						refractedRay.setDirection( refracted );
 						refractedRay.setLength( -1 );
+						refractedRay.setTime( node._time );
 
 						indirectNodeWrite.push_back(IndirectNode());
 						IndirectNode& newNode = indirectNodeWrite.back();
 						newNode._filter = refractFactor;
 						newNode._parentDir = - refracted;
+						newNode._time = node._time;
 
 						_rayData->pushRay(
 							threadId,
@@ -374,14 +383,13 @@ template<class _SampleData,class _RayData,class _SceneReader,int _NumPathsPerBlo
 			return getBackgroundColor(-node._parentDir);
 	}
 	
-	inline void CalculateLighting( const typename Base::Light& light, const IndirectNode& node, Vector3& color)
+	inline void CalculateLighting( const typename Base::LightSettings& light, const IndirectNode& node, Vector3& color)
 	{
-		const PrimitiveData& primitive = _primitives[node._id];
+		const PrimitiveData& primitive = getPrimitiveAt(node._id,node._intersectionAbsolute,node._time);
 		const MaterialSettings& material = _materials[primitive._material];
 		
-		Real remainder = 1.0f-node._intersectionRelative.x()-node._intersectionRelative.y();
-
-		Vector3 location = primitive._primitive.point(0) * remainder + primitive._primitive.point(1) * node._intersectionRelative.x() + primitive._primitive.point(2) * node._intersectionRelative.y();
+		// barycentrics only locate points on triangles, the absolute location works for every shape
+		const Vector3& location = node._intersectionAbsolute;
 
 		Vector3 lightDir(light._location-location);
 
@@ -42,6 +42,7 @@ namespace Raytrace {
 		bool readSceneNode(const TiXmlElement& e,Scene& scene);
 		bool readTriMeshNode(const TiXmlElement& e,TriMesh& trimesh);
 		bool readMaterialNode(const TiXmlElement& e,Material& material);
+		bool readLightNode(const TiXmlElement& e,Light& light);
 
 		XmlParserImp();
 
@@ -6,6 +6,8 @@
 
 #include <RaytraceCommon.h>
 #include <array>
+#include <limits>
+#include <cmath>
 #include "SIMDType.h"
 #include "IntersectorBase.h"
 
@@ -145,6 +147,172 @@ namespace Raytrace {
 		ALIGN_SIMD Vector_T _data[2];
 	};
 
+	namespace detail
+	{
+		template<class _Quantized,int _Width> struct QuantizedLanes
+		{
+			static inline SimdType<float,_Width> toFloat(const _Quantized* codes)
+			{
+				SimdType<float,_Width> result;
+				for(int i = 0; i < _Width; ++i)
+					result[i] = (float)codes[i];
+				return result;
+			}
+		};
+
+		template<> struct QuantizedLanes<u8,4>
+		{
+			static inline SimdType<float,4> toFloat(const u8* codes)
+			{
+				return SimdType<float,4>(SimdType<int,4>::LoadUnsigned(codes));
+			}
+		};
+
+		template<> struct QuantizedLanes<u16,4>
+		{
+			static inline SimdType<float,4> toFloat(const u16* codes)
+			{
+				return SimdType<float,4>(SimdType<int,4>::LoadUnsigned(codes));
+			}
+		};
+
+#ifdef SIMD_AVX2
+		template<> struct QuantizedLanes<u8,8>
+		{
+			static inline SimdType<float,8> toFloat(const u8* codes)
+			{
+				return SimdType<float,8>(SimdType<int,8>::LoadUnsigned(codes));
+			}
+		};
+
+		template<> struct QuantizedLanes<u16,8>
+		{
+			static inline SimdType<float,8> toFloat(const u16* codes)
+			{
+				return SimdType<float,8>(SimdType<int,8>::LoadUnsigned(codes));
+			}
+		};
+#endif
+	}
+
+	// child bounds as fixed point offsets inside the union of all children
+	// decoding is conservative, a decoded box always contains the original one
+	// the float origin and scale cost 24 bytes per node, so with 64 bit child links a node shrinks from
+	// 128 to 104 (u16) or 80 (u8) bytes at width 4 and from 256 to 184 or 136 bytes at width 8,
+	// before padding to the SIMD alignment of the leafs (112/80 and 192/160 bytes)
+	template<int _Width,class _Quantized> struct AABBQuantized
+	{
+		typedef AABB Minimum;
+		typedef PrimitiveClassQuantizedAxisAlignedBox PrimitiveClass;
+		typedef AABBAccel<_Width> Decoded;
+
+		typedef typename Decoded::Vector_T Vector_T;
+		typedef typename Decoded::Scalar_T Scalar_T;
+		typedef _Quantized Quantized;
+		static const int Width = _Width;
+
+		inline AABBQuantized()
+		{
+		}
+
+		template<class _Base> inline AABBQuantized(const ConstArrayWrapper<_Base>& right)
+		{
+			AABB parent = AABB::Empty();
+
+			for(int i = 0; i < Width; ++i)
+				if(!right[i].isEmpty())
+					parent = AABB(parent,right[i]);
+
+			if(parent.isEmpty())
+				parent = AABB(Vector3(0.0f,0.0f,0.0f),Vector3(0.0f,0.0f,0.0f));
+
+			for(int d = 0; d < 3; ++d)
+			{
+				_origin[d] = parent.min()[d];
+				_scale[d] = (parent.max()[d] - parent.min()[d]) / (Real)maxCode();
+
+				// the largest code has to reach the far side of the parent
+				while(decode(maxCode(),d) < parent.max()[d])
+					_scale[d] = _scale[d] > 0.0f ? _scale[d] * (1.0f + std::numeric_limits<Real>::epsilon()) : std::numeric_limits<Real>::min();
+			}
+
+			for(int i = 0; i < Width; ++i)
+				for(int d = 0; d < 3; ++d)
+				{
+					if(right[i].isEmpty())
+					{
+						// min > max marks an empty slot
+						_min[d][i] = (Quantized)maxCode();
+						_max[d][i] = 0;
+					}
+					else
+					{
+						_min[d][i] = encodeFloor(right[i].min()[d],d);
+						_max[d][i] = encodeCeil(right[i].max()[d],d);
+					}
+				}
+		}
+
+		inline void decode(Decoded& out) const
+		{
+			const typename Scalar_T::Boolean empty = 
+				detail::QuantizedLanes<Quantized,Width>::toFloat(_min[0]) > detail::QuantizedLanes<Quantized,Width>::toFloat(_max[0]);
+			const Scalar_T infinity(std::numeric_limits<float>::infinity());
+
+			for(int d = 0; d < 3; ++d)
+			{
+				const Scalar_T scale(_scale[d]);
+				const Scalar_T origin(_origin[d]);
+
+				out._data[0][d] = Scalar_T::Condition(empty, infinity, detail::QuantizedLanes<Quantized,Width>::toFloat(_min[d]) * scale + origin);
+				out._data[1][d] = Scalar_T::Condition(empty, -infinity, detail::QuantizedLanes<Quantized,Width>::toFloat(_max[d]) * scale + origin);
+			}
+		}
+
+	private:
+
+		static inline u32 maxCode()
+		{
+			return (u32)std::numeric_limits<Quantized>::max();
+		}
+
+		// same float operations as the SIMD decoder so the rounding matches
+		inline Real decode(u32 code,int d) const
+		{
+			return (Real)code * _scale[d] + _origin[d];
+		}
+
+		inline Quantized encodeFloor(Real value,int d) const
+		{
+			if(_scale[d] <= 0.0f)
+				return 0;
+
+			Real code = std::floor((value - _origin[d]) / _scale[d]);
+			u32 result = code <= 0.0f ? 0 : (code >= (Real)maxCode() ? maxCode() : (u32)code);
+
+			while(result > 0 && decode(result,d) > value)
+				--result;
+			return (Quantized)result;
+		}
+
+		inline Quantized encodeCeil(Real value,int d) const
+		{
+			if(_scale[d] <= 0.0f)
+				return 0;
+
+			Real code = std::ceil((value - _origin[d]) / _scale[d]);
+			u32 result = code <= 0.0f ? 0 : (code >= (Real)maxCode() ? maxCode() : (u32)code);
+
+			while(result < maxCode() && decode(result,d) < value)
+				++result;
+			return (Quantized)result;
+		}
+
+		Real			_origin[3];
+		Real			_scale[3];
+		Quantized		_min[3][Width];
+		Quantized		_max[3][Width];
+	};
 	
 }
 
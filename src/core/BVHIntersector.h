@@ -21,6 +21,10 @@
 
 #include <RaytraceCommon.h>
 #include <queue>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_01.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 #include "Ray.h"
 #include "MathHelper.h"
 #include "RayData.h"
@@ -32,8 +36,30 @@
 #include "static_vector.h"
 
 namespace Raytrace {
+
+// node volume formats
+
+struct BVHVolumeFormatFull
+{
+	static const u32 Id = 0;
+
+	template<int _Width> struct get
+	{
+		typedef AABBAccel<_Width> type;
+	};
+};
+
+template<class _Quantized> struct BVHVolumeFormatQuantized
+{
+	static const u32 Id = sizeof(_Quantized);
+
+	template<int _Width> struct get
+	{
+		typedef AABBQuantized<_Width,_Quantized> type;
+	};
+};
 	
-template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int _LeafArraySize> struct BVHIntersector : public IIntersector<_RayData,_SceneReader>
+template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int _LeafArraySize,class _VolumeFormat = BVHVolumeFormatFull,class _TriangleMethod = RayTriangleIntersectionMethodHavel> struct BVHIntersector : public IIntersector<_RayData,_SceneReader>
 {
 	typedef _RayData RayData;
 	typedef _SceneReader SceneReader;
@@ -59,8 +85,13 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 				RayInvDirModePrecompute,
 				RayScalarType<Scalar_T>,
 				RayDimensions<BaseRayType::Dimensions> > RayOptions;
+	typedef _TriangleMethod TriangleMethod;
+
+	// only the analytic method tells the shapes apart, everything else sees them as triangles
+	static const bool AnalyticPrimitives = TriangleMethod::Id == RayTriangleIntersectionMethodAnalytic::Id;
+
 	typedef mpl::vector<
-				TriangleBaseModeBarycentricPlane,
+				typename TriangleMethod::StorageMode,
 				TriangleScalarType<Scalar_T>,
 				TriangleDimensions<BasePrimitiveType::Dimensions>,
 				TriangleUserDataType<Scalari_T>	> PrimitiveOptions;
@@ -72,7 +103,8 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 	typedef typename BasePrimitiveType::template adapt<PrimitiveUserOptions>::type UserPrimitiveType;
 
 	typedef typename BasePrimitiveType::template adapt<PrimitiveOptions>::type	PrimitiveType;
-	typedef AABBAccel<SimdWidth>	VolumeType;
+	typedef _VolumeFormat VolumeFormat;
+	typedef typename VolumeFormat::template get<SimdWidth>::type	VolumeType;
 	
 	template<class _RayType> struct RayTypeInfo
 	{
@@ -94,6 +126,7 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 				Raytrace::PrimitiveType<PrimitiveType>, 
 				Raytrace::RayCount<1>, 
 				Raytrace::PrimitiveCount<LeafArraySize>,
+				TriangleMethod,
 				Raytrace::RayModeConstant
 			>>::type intersector_primitive;
 	};
@@ -113,6 +146,7 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 				Raytrace::PrimitiveType<PrimitiveType>, 
 				Raytrace::RayCount<1>, 
 				Raytrace::PrimitiveCount<LeafArraySize>,
+				TriangleMethod,
 				Raytrace::RayModeUpdateMinimum
 			>>::type intersector_primitive;
 	};
@@ -123,136 +157,317 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 
 	typedef BVH<UserPrimitiveType,typename VolumeType::Minimum,LeafWidth,NodeWidth,PrimitiveContainer,VolumeContainer> BVHType;
 	
-	template<int _MaxStackSize> struct ActiveStack
+	// deepest hierarchy the traversal stack has room for, the constructor never builds deeper
+	static const size_t MaxTraversalDepth = BVHType::Constructor::MaxDepth + 1;
+
+	// children waiting for traversal, no ordering is kept here, entries that are
+	// farther than the closest hit are skipped when popped instead of being compacted away
+	struct TraversalStack
 	{
 		typedef typename BVHType::nodeIterator Node;
-		static const size_t MaxStackSize = _MaxStackSize;
 
-		ActiveStack()
-		{
-		}
+		// worst case is every level leaving all but one child behind
+		static const size_t MaxStackSize = MaxTraversalDepth * (NodeWidth - 1);
 
-		inline Node getLowest()
+		inline TraversalStack() : _size(0)
 		{
-			Node result = _stack.back().node();
-			_stack.pop_back();
-	//		_stack.back().node().prefetch();
-			return result;
 		}
 
-		inline void compact(f32 v)
+		inline void push(const Node& node,f32 t)
 		{
-			u32 pos = 0;
-			for(; pos < _stack.size();++pos)
-				if(_stack[pos].t() < v)
-					break;
-
-			if(pos != 0)
-			{
-				for(u32 i = 0; i < _stack.size() - pos; ++i)
-					_stack[i] = _stack[i+pos];
-				_stack.resize(_stack.size()-pos);
-			}
+			RAY_ASSERT( _size < MaxStackSize );
+			_nodes[_size] = node;
+			_t[_size] = t;
+			++_size;
 		}
 
-		inline void push(Node node,f32 t)
+		inline bool pop(f32 closest,Node& node)
 		{
-			//bubble sort push
-			element curr(node,t);
-			u32 pos = (u32)_stack.size();
-			_stack.push_back(curr);
-
-			for(; pos > 0;--pos)
+			while(_size > 0)
 			{
-				if(_stack[pos-1] < _stack[pos])
+				--_size;
+				if(_t[_size] < closest)
 				{
-					element t = _stack[pos];
-					_stack[pos] = _stack[pos-1];
-					_stack[pos-1] = t;
+					node = _nodes[_size];
+					return true;
 				}
-					//std::swap<element>(_stack[pos],_stack[pos-1]);
-				else
-					break;
 			}
+			return false;
+		}
+
+		size_t							_size;
+		std::array<Node,MaxStackSize>	_nodes;
+		std::array<f32,MaxStackSize>	_t;
+	};
+	
+	static const size_t ConstructorBinCount = 64;
+
+	// the layout probe replays this many rays against a cache of this many lines (32kb, a typical L1)
+	static const size_t ProbeRayCount = 4096;
+	static const size_t ProbeCacheLines = 512;
+
+	// traversal timing repeats the probe rays until this much time has passed
+	static const u64 MeasureMicroseconds = 50000;
+
+	struct ProbeRay
+	{
+		Vector3 _origin;
+		Vector3 _direction;
+	};
+
+	BVHIntersector(BVHLayout layout = BVHLayoutBreadthFirst,const BVHSplitSettings& split = BVHSplitSettings()) : _layout(layout),_split(split)
+	{
+	}
+
+	void InitializePrepareST(size_t numThreads,const SceneReader& scene,RayData& rayData) 
+	{
+		buildScene(numThreads,scene,_sceneVolume);
+
+		_probeRays.clear();
+
+		// a few thousand traversals through a simulated cache, only when the per ray numbers are wanted
+		if(scene->getNumPrimitives() > 0 && scene->collectIntersectorStatistics())
+		{
+			generateProbeRays(scene,_sceneVolume);
+			probeLayout(_statistics);
 		}
 
-		inline void conditional_push(bool condition,Node node,f32 t)
+		_rayData = &rayData;
+	}
+
+	// loads the hierarchy from the cache or builds it, returns the key it is cached under
+	// the scene is only read into the constructor when the cache does not have it
+	u64 buildScene(size_t numThreads,const SceneReader& scene,BaseVolumeType& sceneVolume)
+	{
+		BVHCacheHasher hasher;
+		sceneVolume = BaseVolumeType::Empty();
+
+		// everything that changes the built tree or its memory layout goes into the cache key
+		hasher.add((u32)BVHCacheHeader::Version);
+		hasher.add((u32)ConstructorBinCount);
+		hasher.add((u32)NodeWidth);
+		hasher.add((u32)LeafWidth);
+		hasher.add((u32)VolumeFormat::Id);
+		hasher.add((u32)TriangleMethod::Id);
+		hasher.add((u32)_layout);
+		hasher.add(_split._areaRatio);
+		hasher.add(_split._referenceBudget);
+		hasher.add((u32)sizeof(PrimitiveContainer));
+		hasher.add((u32)sizeof(VolumeContainer));
+
+		int num = scene->getNumPrimitives();
+		hasher.add(num);
+
+		for(int i = 0; i< num; ++i)
 		{
-			if(condition)
-				_stack.push_back(element(node,t));
+			BasePrimitiveType tri;
+			int material;
+			scene->getPrimitive(i,tri,material);
 
-			//_stack.conditional_push_back(condition,element(node,t));
+			for(int p = 0; p < 3; ++p)
+				hasher.add(tri.point(p).data(),sizeof(Real)*BasePrimitiveType::Dimensions);
+			hasher.add((u32)tri.shape());
+
+			RAY_ASSERT( tri.shape() == PrimitiveShapeTriangle || AnalyticPrimitives );
+			
+			Vector3 lower,upper;
+			getShapeBounds(tri,lower,upper);
+			sceneVolume = BaseVolumeType(sceneVolume,BaseVolumeType(lower,upper));
 		}
 
-		bool empty() const
+		String cacheDirectory = scene->getCacheDirectory();
+		String cachePath;
+
+		if(!cacheDirectory.empty())
 		{
-			return _stack.empty();
+			cachePath = BVHCacheFile::getPath(cacheDirectory,hasher.value());
+			_sceneData.reset( BVHType::loadCache(cachePath,hasher.value()) );
 		}
 
-		
-		struct element
+		if(!_sceneData.get())
 		{
-			inline element(Node n,f32 t)
-			{
-				_t = t;
-				_n = n;
-			}
-			inline element() {}
+			BVHType::Constructor constructor(ConstructorBinCount);
 
-			inline const Node& node()
+			for(int i = 0; i< num; ++i)
 			{
-				return _n;
-			}
+				BasePrimitiveType tri;
+				int material;
+				scene->getPrimitive(i,tri,material);
 
-			inline f32& t()
-			{
-				return _t;
-			}
-			
-			inline const f32& t() const
-			{
-				return _t;
-			}
+				Vector3 lower,upper;
+				getShapeBounds(tri,lower,upper);
 
-			inline bool operator < (const element& other) const
-			{
-				return t() < other.t();
+				Vector3 centroid = getShapeCentroid(tri);
+				UserPrimitiveType triUser(tri);
+				triUser.setUser( i + 1 );
+				constructor.addElement( triUser, centroid, BaseVolumeType(lower,upper) );
 			}
 
-			struct
-			{
-				f32 _t;
-				Node _n;
-			};
-		};
+			constructor.splitLargeElements(_split,numThreads);
+			_sceneData.reset( new BVHType(constructor,_layout) );
 
+			if(!cachePath.empty())
+				_sceneData->saveCache(cachePath,hasher.value());
+		}
 
-		static_vector<element,MaxStackSize>	_stack;
-	};
-	
-	void InitializePrepareST(size_t numThreads,const SceneReader& scene,RayData& rayData) 
+		_statistics = _sceneData->statistics();
+		RAY_ASSERT( _statistics._maxDepth < MaxTraversalDepth );
+
+		return hasher.value();
+	}
+
+	// maps a hierarchy an earlier buildScene cached back in without reading the scene, false if it is gone
+	bool loadScene(const String& cacheDirectory,u64 key)
 	{
-		BVHType::Constructor constructor(64);
+		if(cacheDirectory.empty())
+			return false;
 
-		int num = scene->getNumPrimitives();
-		for(int i = 0; i< num; ++i)
+		_sceneData.reset( BVHType::loadCache(BVHCacheFile::getPath(cacheDirectory,key),key) );
+
+		if(!_sceneData.get())
+			return false;
+
+		_statistics = _sceneData->statistics();
+		return true;
+	}
+
+	bool SupportsAnalyticPrimitives() const
+	{
+		return AnalyticPrimitives;
+	}
+
+	Result GetStatistics(IntersectorStatistics& statisticsOut) const
+	{
+		if(!_sceneData.get())
+			return Result::Failed;
+
+		statisticsOut = _statistics;
+		return Result::Succeeded;
+	}
+
+	// rays from random points in the scene towards random primitives
+	void generateProbeRays(const SceneReader& scene,const BaseVolumeType& sceneVolume)
+	{
+		boost::random::mt19937									random;
+		boost::random::uniform_01<Real,Real>					uniform;
+		boost::random::uniform_int_distribution<int>			primitive(0,scene->getNumPrimitives()-1);
+
+		_probeRays.reserve(ProbeRayCount);
+
+		for(size_t r = 0; r < ProbeRayCount; ++r)
 		{
 			BasePrimitiveType tri;
 			int material;
-			scene->getPrimitive(i,tri,material);
-			
-			BaseVolumeType volume(tri);
+			scene->getPrimitive(primitive(random),tri,material);
+
+			Vector3 origin;
+			for(int d = 0; d < 3; ++d)
+				origin[d] = sceneVolume.min()[d] + (sceneVolume.max()[d] - sceneVolume.min()[d]) * uniform(random);
 
-			Vector3 centroid = (tri.point(0) + tri.point(1) + tri.point(2))/3.0f;
-			UserPrimitiveType triUser(tri);
-			triUser.setUser( i + 1 );
-			constructor.addElement( triUser, centroid, volume );
+			Vector3 target = getShapeCentroid(tri);
+			if((target - origin).squaredNorm() <= 0.0f)
+				continue;
+
+			ProbeRay probe;
+			probe._origin = origin;
+			probe._direction = (target - origin).normalized();
+			_probeRays.push_back(probe);
 		}
+	}
 
-		_sceneData.reset( new BVHType(constructor) );
+	template<class _Visitor> void replayProbeRays(_Visitor& visitor) const
+	{
+		for(size_t r = 0; r < _probeRays.size(); ++r)
+		{
+			BaseRayType rayBase;
+			rayBase.setOrigin(_probeRays[r]._origin);
+			rayBase.setDirection(_probeRays[r]._direction);
+			rayBase.setLength(0.0f);
 
-		_rayData = &rayData;
+			std::array<BaseRayType,SimdWidth> rayArray;
+			for(int i = 0; i < SimdWidth; ++i)
+				rayArray[i] = rayBase;
+
+			typename RayTypeInfo<FirstHitRay>::type ray(rayArray);
+			Scalar_T tTemp(std::numeric_limits<Real>::infinity());
+			Vector2_T baryTemp;
+			Scalari_T triIds(0);
+
+			traverseFirstHit(ray,tTemp,baryTemp,triIds,visitor);
+		}
+	}
+
+	// counts the cache lines the probe rays touch, the miss count is what tells the layouts apart
+	void probeLayout(IntersectorStatistics& statistics) const
+	{
+		CountingVisitor visitor(ProbeCacheLines);
+
+		replayProbeRays(visitor);
+
+		const f32 rayCount = (f32)std::max<size_t>(_probeRays.size(),1);
+		statistics._elementsPerRay = (f32)visitor._elements / rayCount;
+		statistics._cacheLinesPerRay = (f32)visitor._cache.accesses() / rayCount;
+		statistics._cacheMissesPerRay = (f32)visitor._cache.misses() / rayCount;
+	}
+
+	Result MeasureTraversal(const SceneReader& scene,f32& nanosecondsPerRayOut)
+	{
+		if(!_sceneData.get() || scene->getNumPrimitives() == 0)
+			return Result::Failed;
+
+		if(_probeRays.empty())
+			generateProbeRays(scene,_sceneVolume);
+
+		if(_probeRays.empty())
+			return Result::Failed;
+
+		NullVisitor visitor;
+		unsigned int prevCSR = _mm_getcsr();
+		_mm_setcsr(0xffc0);
+
+		// one untimed pass to warm the caches
+		replayProbeRays(visitor);
+
+		const boost::posix_time::ptime begin = boost::posix_time::microsec_clock::local_time();
+		u64 elapsed = 0;
+		size_t passes = 0;
+
+		do
+		{
+			replayProbeRays(visitor);
+			++passes;
+			elapsed = (u64)(boost::posix_time::microsec_clock::local_time() - begin).total_microseconds();
+		}
+		while(elapsed < MeasureMicroseconds);
+
+		_mm_setcsr(prevCSR);
+
+		nanosecondsPerRayOut = (f32)elapsed * 1000.0f / (f32)(passes * _probeRays.size());
+		return Result::Succeeded;
 	}
+
+	struct NullVisitor
+	{
+		inline void operator()(const typename BVHType::nodeIterator& node)
+		{
+		}
+	};
+
+	struct CountingVisitor
+	{
+		inline CountingVisitor(size_t numLines) : _cache(numLines),_elements(0)
+		{
+		}
+
+		inline void operator()(const typename BVHType::nodeIterator& node)
+		{
+			++_elements;
+			_cache.touch(node.address(),node.size());
+		}
+
+		BVHCacheSimulator	_cache;
+		size_t				_elements;
+	};
 	void InitializeMT(size_t threadId) 
 	{
 	}
@@ -289,7 +504,14 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 
 	template<> void processRay<AnyHitRay>(const typename RayData::Element<AnyHitRay>& element)
 	{
-		const BaseRayType&									rayBase = element.ray;
+		if(intersectAnyHit(element.ray))
+			(*element.resultOut) = 1;
+		else
+			(*element.resultOut) = 0;
+	}
+
+	bool intersectAnyHit(const BaseRayType& rayBase) const
+	{
 		static_vector<typename BVHType::nodeIterator,128 >	stack;
 		std::array<BaseRayType,SimdWidth>					rayArray;
 		bool												found = false;
@@ -337,81 +559,130 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 			}
 		}
 
-		if(found)
-			(*element.resultOut) = 1;
-		else
-			(*element.resultOut) = 0;
+		return found;
 	}
 	
-	template<> void processRay<FirstHitRay>(const typename RayData::Element<FirstHitRay>& element)
+	// ordered closest hit traversal, the children a ray enters are sorted front to back (a sorting network for one
+	// SIMD group, insertion across several), the nearest one is visited next without touching the stack and the
+	// others are pushed far to near
+	template<class _Visitor> inline void traverseFirstHit(const typename RayTypeInfo<FirstHitRay>::type& ray,Scalar_T& tTemp,Vector2_T& baryTemp,Scalari_T& triIds,_Visitor& visitor) const
 	{
-		const BaseRayType& rayBase = element.ray;
-		ActiveStack<128> stack;
+		typedef typename BVHType::nodeIterator Node;
 
-		std::array<BaseRayType,SimdWidth> rayArray;
+		TraversalStack stack;
+		Node node = _sceneData->root();
 
-		for(int i = 0; i < SimdWidth; ++i)
-			rayArray[i] = rayBase;
+		if(!node.valid())
+			return;
 
-		RayTypeInfo<FirstHitRay>::type ray(rayArray);
+		// sort keys are the entry distance with the child lane in the lowest mantissa bits
+		const Scalari_T keyMask(~(int)(SimdWidth-1));
+		const Scalari_T lanes = Scalari_T::Sequence();
+		const Scalar_T farthest(std::numeric_limits<Real>::max());
 
-		Scalar_T tTemp(rayBase.length() > .0f ? rayBase.length() : std::numeric_limits<Real>::infinity());
-		Vector2_T baryTemp;
-		Scalari_T triIds(0);
-		
-		if(_sceneData->root().valid())
+		while(true)
 		{
-			stack.push(_sceneData->root(),0.0f);
-			while(!stack.empty())
+			visitor(node);
+
+			bool descend = false;
+
+			if(node.isLeaf())
 			{
-				BVHType::nodeIterator node = stack.getLowest();
-				if(node.isLeaf())
+				RayTypeInfo<FirstHitRay>::intersector_primitive()(ray, node.leaf(), tTemp, baryTemp,triIds);
+			}
+			else
+			{
+				std::array<Scalar_T,NodeArraySize> tTempArr;
+				std::array< RayTypeInfo<FirstHitRay>::intersector_volume::BooleanMask ,NodeArraySize> resultMask;
+				for(int i = 0; i < NodeArraySize; ++i)
+					tTempArr[i] = tTemp;
+
+				RayTypeInfo<FirstHitRay>::intersector_volume()(ray, node.volumes(), tTempArr, resultMask);
+
+				const Node parent = node;
+
+				if(NodeArraySize == 1)
 				{
-					bool found = false;
+					if(resultMask[0])
+					{
+						// missed lanes still hold the closest hit so they sort behind every hit, distances are kept
+						// normal so the keys do not turn into denormals that the intersect threads flush to zero
+						const Scalar_T keys = Scalar_T::FromBits( (tTempArr[0].Max(Scalar_T(std::numeric_limits<Real>::min())).Min(farthest).AsBits() & keyMask) | lanes ).Sort();
+						const Scalari_T sorted = keys.AsBits();
 
-					if(RayTypeInfo<FirstHitRay>::intersector_primitive()(ray, node.leaf(), tTemp, baryTemp,triIds))
-						found = true;
+						bool pending = false;
+						size_t pendingLane = 0;
+
+						for(size_t i = SimdWidth; i > 0; --i)
+						{
+							const size_t lane = (size_t)sorted[(int)i-1] & (SimdWidth-1);
+
+							if((((size_t)resultMask[0] >> lane) & 1) == 0)
+								continue;
+
+							if(pending)
+								stack.push(parent.node(pendingLane),tTempArr[0][(int)pendingLane]);
+
+							pending = true;
+							pendingLane = lane;
+						}
 
-					if(found)
-						stack.compact(tTemp[0]);
+						node = parent.node(pendingLane);
+						descend = true;
+					}
 				}
 				else
 				{
+					// a sorting network only orders one group, the children of all groups are merged by
+					// insertion on their entry distance instead, farthest first
+					std::array<Real,NodeWidth> hitDistance;
+					std::array<size_t,NodeWidth> hitChild;
+					size_t numHits = 0;
 
-					std::array<Scalar_T,NodeArraySize> tTempArr;
-					std::array< RayTypeInfo<FirstHitRay>::intersector_volume::BooleanMask ,NodeArraySize> resultMask;
-					for(int i = 0; i < NodeArraySize; ++i)
-						tTempArr[i] = tTemp;
-
-				
-					RayTypeInfo<FirstHitRay>::intersector_volume()(ray, node.volumes(), tTempArr, resultMask);
-				
 					for(size_t j = 0; j < NodeArraySize; ++j)
-						if(resultMask[j])
+					{
+						for(size_t lane = 0; lane < SimdWidth; ++lane)
 						{
-							for(size_t i = 0; i < SimdWidth; ++i)
+							if((((size_t)resultMask[j] >> lane) & 1) == 0)
+								continue;
+
+							const Real distance = tTempArr[j][(int)lane];
+							size_t k = numHits++;
+
+							for(; k > 0 && hitDistance[k-1] < distance; --k)
 							{
-								//node.prefetchChild(j*SimdWidth+i);
-								stack.conditional_push( ((size_t)resultMask[j] >> i) & 1, node.node(j*SimdWidth+i),tTempArr[j][i]);
+								hitDistance[k] = hitDistance[k-1];
+								hitChild[k] = hitChild[k-1];
 							}
+
+							hitDistance[k] = distance;
+							hitChild[k] = j*SimdWidth+lane;
 						}
+					}
 
+					if(numHits)
+					{
+						for(size_t i = 0; i+1 < numHits; ++i)
+							stack.push(parent.node(hitChild[i]),hitDistance[i]);
+
+						node = parent.node(hitChild[numHits-1]);
+						descend = true;
+					}
 				}
 			}
+
+			if(!descend && !stack.pop(tTemp[0],node))
+				break;
 		}
-		
-		Real t = std::numeric_limits<Real>::infinity();
-		Vector2 bary;
-		int triId = 0;
+	}
 
-		for(int i = 0; i < SimdWidth; ++i)
-			if(triIds[i] != 0)
-			{
-				t = tTemp[i];
-				bary.x() = baryTemp.x()[i];
-				bary.y() = baryTemp.y()[i];
-				triId = triIds[i];
-			}
+	template<> void processRay<FirstHitRay>(const typename RayData::Element<FirstHitRay>& element)
+	{
+		const BaseRayType& rayBase = element.ray;
+
+		Real t = rayBase.length() > .0f ? rayBase.length() : std::numeric_limits<Real>::infinity();
+		Vector2 bary;
+		const int triId = intersectFirstHit(rayBase,t,bary);
 		
 		if(triId != 0)
 		{
@@ -429,11 +700,47 @@ template<class _RayData,class _SceneReader,int _SimdWidth,int _NodeArraySize,int
 		}
 	}
 
+	// closest hit nearer than t, returns the primitive index plus one and updates t and bary, 0 if there is none
+	int intersectFirstHit(const BaseRayType& rayBase,Real& t,Vector2& bary) const
+	{
+		std::array<BaseRayType,SimdWidth> rayArray;
+
+		for(int i = 0; i < SimdWidth; ++i)
+			rayArray[i] = rayBase;
+
+		RayTypeInfo<FirstHitRay>::type ray(rayArray);
+
+		Scalar_T tTemp(t);
+		Vector2_T baryTemp;
+		Scalari_T triIds(0);
+		NullVisitor visitor;
+
+		traverseFirstHit(ray,tTemp,baryTemp,triIds,visitor);
+
+		int triId = 0;
+
+		for(int i = 0; i < SimdWidth; ++i)
+			if(triIds[i] != 0)
+			{
+				t = tTemp[i];
+				bary.x() = baryTemp.x()[i];
+				bary.y() = baryTemp.y()[i];
+				triId = triIds[i];
+			}
+
+		return triId;
+	}
+
 	__declspec(noinline) void processNode(const typename RayTypeInfo<FirstHitRay>::type& ray,int raysigns,const typename BVHType::nodeIterator& it,Scalari_T& triId,Scalar_T& t,Vector2_T& bary)
 	{
 	}
 	
 	std::auto_ptr<BVHType>	_sceneData;
+	BVHLayout				_layout;
+	BVHSplitSettings		_split;
+	IntersectorStatistics	_statistics;
+	std::vector<ProbeRay>	_probeRays;
+	BaseVolumeType			_sceneVolume;
 
 	RayData* _rayData;
 	public:
@@ -180,6 +180,10 @@ Result BasicRaytraceEngine<_RayData,_SampleData,_SceneReader>::GetStatus(const S
 		text << samplesSec << String(" samples/second ");
 		text << raysSec << String(" rays/second ");
 
+		IntersectorStatistics statistics;
+		if(_intersector->GetStatistics(statistics))
+			text << statistics._nodeCount << String(" nodes ") << statistics._leafCount << String(" leaves ") << statistics._memoryBytes/(1024*1024) << String(" MB");
+
 		status_out = text.str();
 
 		if(_progress < 1.0f)
@@ -188,6 +192,41 @@ Result BasicRaytraceEngine<_RayData,_SampleData,_SceneReader>::GetStatus(const S
 			return Result::RenderingComplete;
 	}
 
+	else if(status_type == String("intersector"))
+	{
+		IntersectorStatistics statistics;
+		Result result = _intersector->GetStatistics(statistics);
+
+		if(!result)
+			return result;
+
+		std::ostringstream text;
+
+		text.precision(2);
+		text << std::fixed;
+		text << String("Primitives: ") << statistics._primitiveCount << String(", ") << statistics._referenceCount << String(" references") << std::endl;
+		text << String("Nodes: ") << statistics._nodeCount << String(", ") << statistics._nodeFill << String(" children on average") << std::endl;
+		text << String("Leaves: ") << statistics._leafCount << String(", ") << statistics._leafFill << String(" references on average") << std::endl;
+		text << String("Memory: ") << statistics._memoryBytes << String(" bytes") << std::endl;
+		text << String("SAH cost: ") << statistics._sahCost << std::endl;
+		text << String("EPO: ") << statistics._epo << std::endl;
+		text << String("Per ray: ") << statistics._elementsPerRay << String(" elements, ") << statistics._cacheLinesPerRay << String(" cache lines, ") << statistics._cacheMissesPerRay << String(" misses") << std::endl;
+
+		text << String("Leaves by depth:");
+		for(size_t i = 0; i <= statistics._maxDepth && i < IntersectorStatistics::HistogramSize; ++i)
+			text << String(" ") << statistics._leafDepthHistogram[i];
+		text << std::endl;
+
+		text << String("Leaves by fill:");
+		for(size_t i = 0; i < IntersectorStatistics::HistogramSize; ++i)
+			if(statistics._leafFillHistogram[i])
+				text << String(" ") << i << String(":") << statistics._leafFillHistogram[i];
+		text << std::endl;
+
+		status_out = text.str();
+		return Result::Succeeded;
+	}
+
 	return Result::Failed;
 }
 
@@ -6,5 +6,6 @@ namespace Raytrace {
 	ObjectType const ObjectType::Output(2,String("Output"));
 	ObjectType const ObjectType::TriMesh(3,String("TriMesh"));
 	ObjectType const ObjectType::Material(4,String("Material"));
+	ObjectType const ObjectType::Light(5,String("Light"));
 
 }
\ No newline at end of file
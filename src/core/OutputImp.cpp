@@ -18,7 +18,12 @@ Output CreateCustomOutput(const boost::shared_ptr<ISceneReader>& reader,const St
 }
 
 OutputImp::OutputImp(const String& name,const boost::shared_ptr<ISceneReader>* reader) : Base(name),
-	_enabled(true)
+	_pixelFilter("Box"),
+	_enabled(true),
+	_deterministic(false),
+	_intersectorStatistics(false),
+	_outOfCoreChunkPrimitives(1 << 18),
+	_outOfCoreMemory(512)
 {
 	if(reader)
 		_reader = *reader;
@@ -126,6 +131,15 @@ Result OutputImp::Refresh()
 	else
 	{
 		auto intersector = DefaultEngine::getIntersectors().find(_intersector)->second();
+
+		// spheres, disks and quads would be rendered as triangles by any other intersector
+		if(reader->hasAnalyticPrimitives() && !intersector->SupportsAnalyticPrimitives())
+			intersector = DefaultEngine::getIntersectors().find(String("BVH Intersector (Analytic Shapes)"))->second();
+
+		// chunks paged out without a cache to read them back from would be rebuilt on every page in
+		if(intersector->RequiresCacheDirectory() && reader->getCacheDirectory().empty())
+			return Result::Failed;
+
 		auto integrator = DefaultEngine::getIntegrators().find(_integrator)->second();
 		auto sampler = DefaultEngine::getSamplers().find(_sampler)->second();
 
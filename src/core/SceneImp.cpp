@@ -26,7 +26,8 @@ Result SceneImp::InsertObject(const Object& object)
 	if(
 		object->GetType() != ObjectType::Camera && 
 		object->GetType() != ObjectType::TriMesh &&
-		object->GetType() != ObjectType::Material)
+		object->GetType() != ObjectType::Material &&
+		object->GetType() != ObjectType::Light)
 		return Result::UnsupportedObjectType;
 	
 	return Base::InsertObject(object);
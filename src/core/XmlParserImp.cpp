@@ -121,6 +121,13 @@ bool XmlParserImp::readSceneNode(const TiXmlElement& e,Scene& scene)
 			if(readMaterialNode(*child,material))
 				scene->InsertObject(material);
 		}
+		else if(nodeName == "light")
+		{
+			//light
+			Light light;
+			if(readLightNode(*child,light))
+				scene->InsertObject(light);
+		}
 		else if(nodeName == "camera")
 		{
 			//camera
@@ -217,6 +224,32 @@ bool XmlParserImp::readMaterialNode(const TiXmlElement& e,Material& material)
 	return true;
 }
 
+bool XmlParserImp::readLightNode(const TiXmlElement& e,Light& light)
+{
+	if(e.ValueStr() != String("light"))
+		return false;
+
+	String name;
+	if(e.Attribute("name"))
+		name = String(e.Attribute("name"));
+
+	light = CreateLight(name);
+
+	const TiXmlElement* child = e.FirstChildElement();
+	while(child)
+	{
+		String propertyValue;
+		String propertyName = child->ValueStr();
+		if(readProperty(*child,propertyValue))
+		{
+			light->SetPropertyValue(propertyName,propertyValue);
+		}
+		child = child->NextSiblingElement();
+	}
+
+	return true;
+}
+
 XmlParser CreateXmlParser()
 {
 	return XmlParser(new XmlParserImp());
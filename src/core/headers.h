@@ -27,6 +27,7 @@
 #include <RaytraceScene.h>
 #include <RaytraceCamera.h>
 #include <RaytraceMaterial.h>
+#include <RaytraceLight.h>
 #include <RaytraceTriMesh.h>
 #include <RaytraceObject.h>
 #include <RaytraceXmlParser.h>
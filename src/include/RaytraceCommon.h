@@ -31,6 +31,7 @@ namespace Raytrace {
 	class IScene;
 	class IOutput;
 	class IMaterial;
+	class ILight;
 	class ITriMesh;
 	class IPropertySet;
 	class IXmlParser;
@@ -49,6 +50,7 @@ namespace Raytrace {
 
 	typedef ObjectPointer<ICamera>		Camera;
 	typedef ObjectPointer<IMaterial>	Material;
+	typedef ObjectPointer<ILight>		Light;
 	typedef ObjectPointer<ITriMesh>		TriMesh;
 	typedef ObjectPointer<IObject>		Object;
 	typedef ObjectPointer<IScene>		Scene;
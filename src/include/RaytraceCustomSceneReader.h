@@ -36,6 +36,14 @@ namespace Raytrace {
 	static const String		SceneReaderProperty_MultisampleCount("MultisampleCount");
 	static const String		SceneReaderProperty_PrimitiveType("PrimitiveType");
 	static const String		SceneReaderProperty_PrimitiveType_Triangle("PrimitiveType_Triangle");
+	static const String		SceneReaderProperty_PrimitiveType_Analytic("PrimitiveType_Analytic");
+	static const String		SceneReaderProperty_PrimitiveType_Moving("PrimitiveType_Moving");
+	static const String		SceneReaderProperty_CacheDirectory("CacheDirectory");
+	static const String		SceneReaderProperty_Deterministic("Deterministic");
+	static const String		SceneReaderProperty_PixelFilter("PixelFilter");
+	static const String		SceneReaderProperty_IntersectorStatistics("IntersectorStatistics");
+	static const String		SceneReaderProperty_OutOfCoreChunkPrimitives("OutOfCoreChunkPrimitives");
+	static const String		SceneReaderProperty_OutOfCoreMemory("OutOfCoreMemory");
 
 	class ISceneReader : public IPropertySet
 	{
@@ -47,6 +55,33 @@ namespace Raytrace {
 			int			_material;
 		};
 
+		// GetPrimitive fills this instead if the PrimitiveType property is PrimitiveType_Analytic
+		struct PrimitiveAnalytic
+		{
+			enum Shape
+			{
+				SHAPE_TRIANGLE,
+				SHAPE_QUAD,		// _p1 is a corner, _p2 and _p3 its neighbours
+				SHAPE_DISK,		// centered at _p1, facing _normal
+				SHAPE_SPHERE	// centered at _p1
+			};
+
+			Shape		_shape;
+			Vector3		_p1,_p2,_p3;
+			Vector3		_normal;
+			Real		_radius;
+			int			_material;
+		};
+
+		// GetPrimitive fills this instead if the PrimitiveType property is PrimitiveType_Moving,
+		// every vertex moves linearly from _pN when the shutter opens to _pN + _motionN when it closes
+		struct PrimitiveMoving
+		{
+			Vector3		_p1,_p2,_p3;
+			Vector3		_motion1,_motion2,_motion3;
+			int			_material;
+		};
+
 		struct MaterialData
 		{
 			Real	_ior;
@@ -65,9 +100,19 @@ namespace Raytrace {
 
 		struct LightData
 		{
-			// only point lights supported
+			enum Type
+			{
+				LIGHT_POINT,	// _color is the intensity, emitted in every direction from _location
+				LIGHT_AREA		// a parallelogram with corner _location and edges _edge1, _edge2,
+								// _color is the radiance leaving the side _edge1 x _edge2 points to
+			};
+
+			LightData() : _type(LIGHT_POINT) {}
+
+			Type		_type;
 			Vector3		_color;
 			Vector3		_location;
+			Vector3		_edge1,_edge2;
 		};
 		
 		enum Format
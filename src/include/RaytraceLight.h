@@ -10,3 +10,60 @@
 // a letter to Creative Commons, 444 Castro Street, 
 // Suite 900, Mountain View, California, 94041, USA.
 /********************************************************/
+
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#ifndef RAYTRACE_LIGHT_GUARD
+#define RAYTRACE_LIGHT_GUARD
+
+#include <RaytraceCommon.h>
+#include <RaytraceObject.h>
+
+namespace Raytrace {
+
+/******************************************/
+// Raytracer Light Interface
+/******************************************/
+// point lights shine from Position in every direction,
+// area lights are parallelograms with a corner at Position
+// spanned by Edge1 and Edge2, lit on the side Edge1 x Edge2 faces
+/******************************************/
+
+	extern Light CreateLight(const String& name = String());
+
+	class ILight : public virtual IObject
+	{
+	public:
+		// property Type/String, point or area
+		virtual void SetLightType(const String& type) = 0;
+		virtual String GetLightType() const = 0;
+
+		// property Color/Vector4
+		virtual void SetColor(const Vector4& color) = 0;
+		virtual Vector4 GetColor() const = 0;
+
+		// property Intensity/Real, scales Color
+		virtual void SetIntensity(const Real& intensity) = 0;
+		virtual Real GetIntensity() const = 0;
+
+		// property Position/Vector3
+		virtual void SetPosition(const Vector3& position) = 0;
+		virtual Vector3 GetPosition() const = 0;
+
+		// property Edge1/Vector3, area lights only
+		virtual void SetEdge1(const Vector3& edge) = 0;
+		virtual Vector3 GetEdge1() const = 0;
+
+		// property Edge2/Vector3, area lights only
+		virtual void SetEdge2(const Vector3& edge) = 0;
+		virtual Vector3 GetEdge2() const = 0;
+
+		static RObjectType ObjectType;
+	};
+
+}
+
+#endif
@@ -29,6 +29,7 @@ namespace Raytrace {
 		static const ObjectType Output;
 		static const ObjectType TriMesh;
 		static const ObjectType Material;
+		static const ObjectType Light;
 
 		explicit ObjectType(int v,const String& name) : _value(v),_name(name) { }
 
@@ -64,6 +64,11 @@
     #error UNKNOWN COMPILER
 #endif
 
+// AVX2 has to be enabled for the whole build (-mavx2, /arch:AVX2), 8 wide simd types depend on it
+#if defined(__AVX2__)
+    #define SIMD_AVX2
+#endif
+
 #if defined(_WIN64) || defined(__LP64__)
     #define TARGET_X64
 #else